@@ -54,6 +54,8 @@ typedef struct
   // SVG sources (optional - if empty, use primitive rendering)
   char cross_svg_path[256];
   char circle_svg_path[256];
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } crosshair_config_t;
 
 // Timestamp configuration
@@ -65,6 +67,8 @@ typedef struct
   int pos_x;
   int pos_y;
   char font_path[256];
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } timestamp_config_t;
 
 // Speed indicators configuration
@@ -88,6 +92,8 @@ typedef struct
   uint32_t color;
   int font_size;
   char font_path[256];
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } variant_info_config_t;
 
 // Nav ball skin types
@@ -123,6 +129,11 @@ typedef struct
   bool show_center_indicator;
   float center_indicator_scale; // Scale factor (1.0 = 100% of navball size)
   char center_indicator_svg_path[256];
+
+  // Render cache: orientation quantization step in degrees (0 = disabled)
+  float cache_epsilon;
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } navball_config_t;
 
 // Celestial indicators configuration (sun and moon on navball)
@@ -138,6 +149,8 @@ typedef struct
   char sun_back_svg_path[256];   // Sun behind horizon (altitude < 0)
   char moon_front_svg_path[256]; // Moon visible
   char moon_back_svg_path[256];  // Moon behind horizon
+  int update_interval;           // Ephemeris cache segment (s, 0 = off)
+  float observer_threshold;      // Observer move (m) forcing recomputation
 } celestial_indicators_config_t;
 
 // Sharpness heatmap widget configuration
@@ -149,6 +162,8 @@ typedef struct
   int cell_size;   // Pixels per cell
   bool show_label; // "Sharp: 0.XXX" above grid
   int label_font_size;
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } sharpness_heatmap_config_t;
 
 // YOLO detections overlay configuration
@@ -160,6 +175,8 @@ typedef struct
   bool per_class_color; // Cycle 8-color palette by class_id
   int label_font_size;
   float min_confidence; // Display threshold [0.0-1.0]
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } detections_config_t;
 
 // ROI overlay configuration
@@ -172,6 +189,8 @@ typedef struct
   uint32_t color_track;
   uint32_t color_zoom;
   uint32_t color_fx;
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } roi_config_t;
 
 // Autofocus debug panel configuration
@@ -183,8 +202,17 @@ typedef struct
   int bar_height;        // Position bar height (default 80)
   int heatmap_cell_size; // Heatmap cell size in pixels (default 12)
   int chart_width;       // Chart width in pixels (default 180)
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } autofocus_debug_config_t;
 
+// SAM mask overlay style
+typedef enum
+{
+  SAM_MASK_RENDER_FILL,   // Translucent fill over every mask pixel
+  SAM_MASK_RENDER_CONTOUR // Mask outline in the box color
+} sam_mask_render_mode_t;
+
 // SAM tracking overlay configuration
 typedef struct
 {
@@ -196,8 +224,22 @@ typedef struct
   int centroid_radius; // Centroid marker size in px
   bool mask_enabled;   // Enable mask overlay rendering
   uint8_t mask_alpha;  // Mask transparency (0-255, default 128)
+  sam_mask_render_mode_t render_mode;
+  float contour_thickness; // Outline width px (contour mode)
+  float contour_simplify;  // Outline tolerance in mask px (0 = exact)
+
+  float max_rate_hz; // Max redraws per second (0 = every frame)
 } sam_mask_config_t;
 
+// Frame-budget governor (see render_budget.h)
+typedef struct
+{
+  int budget_us;       // Widget time per frame to stay under (0 = off)
+  int window_frames;   // Frames averaged and held between level changes
+  float step_up_ratio; // Restore a level when under budget * ratio
+  int max_level;       // Deepest reduction level used (0-5)
+} render_budget_config_t;
+
 // Full OSD configuration
 typedef struct
 {
@@ -212,6 +254,7 @@ typedef struct
   roi_config_t roi;
   autofocus_debug_config_t autofocus_debug;
   sam_mask_config_t sam_mask;
+  render_budget_config_t render_budget;
 } osd_config_t;
 
 #endif // OSD_CONFIG_H
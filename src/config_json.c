@@ -133,6 +133,19 @@ get_color(cJSON *obj, const char *key, uint32_t default_value)
   return default_value;
 }
 
+/**
+ * Get the widget scheduler rate cap of a widget section
+ *
+ * @param obj Widget section
+ * @return max_rate_hz, or 0 (redraw every frame) if missing or negative
+ */
+static float
+get_max_rate(cJSON *obj)
+{
+  double rate = get_double(obj, "max_rate_hz", 0.0);
+  return rate > 0.0 ? (float)rate : 0.0f;
+}
+
 // ════════════════════════════════════════════════════════════
 // JSON PARSING HELPERS
 // ════════════════════════════════════════════════════════════
@@ -213,7 +226,8 @@ parse_crosshair_config(cJSON *root, crosshair_config_t *config)
   if (!crosshair)
     return;
 
-  config->enabled = get_bool(crosshair, "enabled", true);
+  config->enabled     = get_bool(crosshair, "enabled", true);
+  config->max_rate_hz = get_max_rate(crosshair);
 
   // Parse orientation
   const char *orientation = get_string(crosshair, "orientation", "vertical");
@@ -274,6 +288,8 @@ parse_timestamp_config(cJSON *root, timestamp_config_t *config)
   config->color     = get_color(timestamp, "color", COLOR_CYAN);
   config->font_size = get_int(timestamp, "font_size", 14);
 
+  config->max_rate_hz = get_max_rate(timestamp);
+
   // Parse font name and resolve to path using registry
   const char *font_name = get_string(timestamp, "font", "liberation_sans_bold");
   const char *font_path = get_font_path(font_name);
@@ -328,6 +344,8 @@ parse_variant_info_config(cJSON *root, variant_info_config_t *config)
   config->color     = get_color(variant_info, "color", COLOR_YELLOW);
   config->font_size = get_int(variant_info, "font_size", 14);
 
+  config->max_rate_hz = get_max_rate(variant_info);
+
   // Parse font name and resolve to path using registry
   const char *font_name
     = get_string(variant_info, "font", "liberation_sans_bold");
@@ -358,6 +376,11 @@ parse_navball_config(cJSON *root, navball_config_t *config)
   config->skin          = get_navball_skin_by_name(skin_name);
 
   config->show_level_marker = get_bool(navball, "show_level_marker", false);
+  config->cache_epsilon = (float)get_double(navball, "cache_epsilon", 0.05);
+  if (config->cache_epsilon < 0.0f)
+    config->cache_epsilon = 0.0f;
+
+  config->max_rate_hz = get_max_rate(navball);
 
   // Parse center indicator configuration
   cJSON *center_indicator = cJSON_GetObjectItem(navball, "center_indicator");
@@ -396,8 +419,11 @@ parse_celestial_indicators_config(cJSON *root,
   cJSON *celestial = cJSON_GetObjectItem(root, "celestial_indicators");
   if (!celestial)
     {
-      // Default: disabled if not present
-      config->enabled = false;
+      // Default: disabled if not present; the ephemeris cache settings
+      // still get the defaults a present section would
+      config->enabled            = false;
+      config->update_interval    = 60;
+      config->observer_threshold = 100.0f;
       return;
     }
 
@@ -428,6 +454,16 @@ parse_celestial_indicators_config(cJSON *root,
     celestial, "moon_back_svg", "resources/navball_indicators/moon_back.svg");
   strncpy(config->moon_back_svg_path, moon_back_path,
           sizeof(config->moon_back_svg_path) - 1);
+
+  // Ephemeris cache: recompute every update_interval seconds, interpolate
+  // in between
+  config->update_interval = get_int(celestial, "update_interval", 60);
+  if (config->update_interval < 0)
+    config->update_interval = 0;
+  config->observer_threshold
+    = (float)get_double(celestial, "observer_threshold", 100.0);
+  if (config->observer_threshold < 0.0f)
+    config->observer_threshold = 0.0f;
 }
 
 /**
@@ -449,6 +485,8 @@ parse_sharpness_heatmap_config(cJSON *root, sharpness_heatmap_config_t *config)
   config->cell_size       = get_int(heatmap, "cell_size", 12);
   config->show_label      = get_bool(heatmap, "show_label", true);
   config->label_font_size = get_int(heatmap, "label_font_size", 16);
+
+  config->max_rate_hz = get_max_rate(heatmap);
 }
 
 /**
@@ -471,6 +509,8 @@ parse_detections_config(cJSON *root, detections_config_t *config)
   config->label_font_size = get_int(detections, "label_font_size", 16);
   config->min_confidence
     = (float)get_double(detections, "min_confidence", 0.25);
+
+  config->max_rate_hz = get_max_rate(detections);
 }
 
 /**
@@ -499,6 +539,8 @@ parse_roi_config(cJSON *root, roi_config_t *config)
   config->color_track     = get_color(roi, "color_track", 0xFF00FFFF);
   config->color_zoom      = get_color(roi, "color_zoom", 0xFFFF00FF);
   config->color_fx        = get_color(roi, "color_fx", 0xFFFFFF00);
+
+  config->max_rate_hz = get_max_rate(roi);
 }
 
 /**
@@ -520,6 +562,8 @@ parse_autofocus_debug_config(cJSON *root, autofocus_debug_config_t *config)
   config->bar_height        = get_int(af_debug, "bar_height", 80);
   config->heatmap_cell_size = get_int(af_debug, "heatmap_cell_size", 12);
   config->chart_width       = get_int(af_debug, "chart_width", 180);
+
+  config->max_rate_hz = get_max_rate(af_debug);
 }
 
 /**
@@ -543,6 +587,38 @@ parse_sam_mask_config(cJSON *root, sam_mask_config_t *config)
   config->centroid_radius = get_int(sam_mask, "centroid_radius", 8);
   config->mask_enabled    = get_bool(sam_mask, "mask_enabled", true);
   config->mask_alpha      = (uint8_t)get_int(sam_mask, "mask_alpha", 128);
+
+  const char *render_mode = get_string(sam_mask, "render_mode", "fill");
+  if (strcmp(render_mode, "contour") == 0)
+    {
+      config->render_mode = SAM_MASK_RENDER_CONTOUR;
+    }
+  else
+    {
+      config->render_mode = SAM_MASK_RENDER_FILL;
+    }
+  config->contour_thickness
+    = (float)get_double(sam_mask, "contour_thickness", 2.0);
+  config->contour_simplify
+    = (float)get_double(sam_mask, "contour_simplify", 1.0);
+
+  config->max_rate_hz = get_max_rate(sam_mask);
+}
+
+/**
+ * Parse frame-budget governor configuration
+ *
+ * Ranges are enforced by render_budget_init().
+ */
+static void
+parse_render_budget_config(cJSON *root, render_budget_config_t *config)
+{
+  cJSON *budget = cJSON_GetObjectItem(root, "render_budget");
+
+  config->budget_us     = get_int(budget, "budget_us", 0);
+  config->window_frames = get_int(budget, "window_frames", 30);
+  config->step_up_ratio = (float)get_double(budget, "step_up_ratio", 0.7);
+  config->max_level     = get_int(budget, "max_level", 5);
 }
 
 // ════════════════════════════════════════════════════════════
@@ -578,6 +654,7 @@ config_parse_json(osd_config_t *config, const char *json_path)
   parse_roi_config(root, &config->roi);
   parse_autofocus_debug_config(root, &config->autofocus_debug);
   parse_sam_mask_config(root, &config->sam_mask);
+  parse_render_budget_config(root, &config->render_budget);
 
   // Clean up
   cJSON_Delete(root);
@@ -44,6 +44,117 @@ framebuffer_clear(framebuffer_t *fb, uint32_t color)
     }
 }
 
+// True if any pixel of row[x0, x1) is set
+static bool
+row_has_content(const uint32_t *row, int x0, int x1)
+{
+  for (int x = x0; x < x1; x++)
+    {
+      if (row[x])
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+bool
+framebuffer_content_bounds(const framebuffer_t *fb, framebuffer_rect_t *out)
+{
+  framebuffer_rect_t all = { 0, 0, (int)fb->width, (int)fb->height };
+  return framebuffer_content_bounds_in(fb, all, out);
+}
+
+bool
+framebuffer_content_bounds_in(const framebuffer_t *fb,
+                              framebuffer_rect_t area,
+                              framebuffer_rect_t *out)
+{
+  int w      = (int)fb->width;
+  int left   = area.x > 0 ? area.x : 0;
+  int top    = area.y > 0 ? area.y : 0;
+  int right  = area.x + area.width < w ? area.x + area.width : w;
+  int bottom = area.y + area.height < (int)fb->height ? area.y + area.height
+                                                      : (int)fb->height;
+
+  memset(out, 0, sizeof(*out));
+  if (left >= right)
+    {
+      return false;
+    }
+
+  // First and last rows with content
+  int y0 = top;
+  while (y0 < bottom
+         && !row_has_content(&fb->data[(size_t)y0 * w], left, right))
+    {
+      y0++;
+    }
+  if (y0 >= bottom)
+    {
+      return false;
+    }
+
+  int y1 = bottom - 1;
+  while (!row_has_content(&fb->data[(size_t)y1 * w], left, right))
+    {
+      y1--;
+    }
+
+  // Column extent: each row only needs checking left of x0 / right of x1
+  int x0 = right;
+  int x1 = left - 1;
+  for (int y = y0; y <= y1; y++)
+    {
+      const uint32_t *row = &fb->data[(size_t)y * w];
+
+      for (int x = left; x < x0; x++)
+        {
+          if (row[x])
+            {
+              x0 = x;
+              break;
+            }
+        }
+      for (int x = right - 1; x > x1; x--)
+        {
+          if (row[x])
+            {
+              x1 = x;
+              break;
+            }
+        }
+    }
+
+  out->x      = x0;
+  out->y      = y0;
+  out->width  = x1 - x0 + 1;
+  out->height = y1 - y0 + 1;
+  return true;
+}
+
+framebuffer_rect_t
+framebuffer_rect_union(framebuffer_rect_t a, framebuffer_rect_t b)
+{
+  if (a.width <= 0 || a.height <= 0)
+    {
+      return b;
+    }
+  if (b.width <= 0 || b.height <= 0)
+    {
+      return a;
+    }
+
+  int x0 = a.x < b.x ? a.x : b.x;
+  int y0 = a.y < b.y ? a.y : b.y;
+  int x1 = (a.x + a.width > b.x + b.width) ? a.x + a.width : b.x + b.width;
+  int y1 = (a.y + a.height > b.y + b.height) ? a.y + a.height
+                                             : b.y + b.height;
+
+  framebuffer_rect_t r = { x0, y0, x1 - x0, y1 - y0 };
+  return r;
+}
+
 // ════════════════════════════════════════════════════════════
 // PIXEL ACCESS IMPLEMENTATION
 // ════════════════════════════════════════════════════════════
@@ -91,3 +202,61 @@ framebuffer_blend_pixel(framebuffer_t *fb, int x, int y, uint32_t color)
   // Alpha blend: result = blend_argb(background, foreground)
   fb->data[idx] = blend_argb(fb->data[idx], color);
 }
+
+void
+framebuffer_blend_span(framebuffer_t *fb, int x, int y, int len, uint32_t color)
+{
+  // Clip to framebuffer
+  if (y < 0 || y >= (int)fb->height)
+    {
+      return;
+    }
+
+  int x_end = x + len;
+  if (x < 0)
+    {
+      x = 0;
+    }
+  if (x_end > (int)fb->width)
+    {
+      x_end = (int)fb->width;
+    }
+  if (x >= x_end)
+    {
+      return;
+    }
+
+  uint32_t *row  = &fb->data[(size_t)y * fb->width];
+  uint32_t alpha = (color >> 24) & 0xFF;
+  uint32_t inv_a = 255 - alpha;
+
+  // Fast paths (as in blend_argb)
+  if (alpha == 0)
+    {
+      return;
+    }
+  if (alpha == 255)
+    {
+      for (int px = x; px < x_end; px++)
+        {
+          row[px] = color;
+        }
+      return;
+    }
+
+  // Foreground terms are constant along the span; per pixel the result is
+  // identical to blend_argb(row[px], color)
+  uint32_t fg_r = (color & 0xFF) * alpha;
+  uint32_t fg_g = ((color >> 8) & 0xFF) * alpha;
+  uint32_t fg_b = ((color >> 16) & 0xFF) * alpha;
+
+  for (int px = x; px < x_end; px++)
+    {
+      uint32_t bg = row[px];
+      uint32_t r  = (fg_r + (bg & 0xFF) * inv_a) / 255;
+      uint32_t g  = (fg_g + ((bg >> 8) & 0xFF) * inv_a) / 255;
+      uint32_t b  = (fg_b + ((bg >> 16) & 0xFF) * inv_a) / 255;
+      uint32_t a  = alpha + (((bg >> 24) & 0xFF) * inv_a) / 255;
+      row[px]     = (a << 24) | (b << 16) | (g << 8) | r;
+    }
+}
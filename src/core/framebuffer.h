@@ -43,6 +43,15 @@ typedef struct
   size_t stride;   // Bytes per row (usually width * 4)
 } framebuffer_t;
 
+// Axis-aligned pixel rectangle; empty when width or height is 0
+typedef struct
+{
+  int x;
+  int y;
+  int width;
+  int height;
+} framebuffer_rect_t;
+
 // ════════════════════════════════════════════════════════════
 // LIFECYCLE
 // ════════════════════════════════════════════════════════════
@@ -71,6 +80,26 @@ void framebuffer_init(framebuffer_t *fb,
 //   framebuffer_clear(&fb, 0xFF000000);  // Opaque black
 void framebuffer_clear(framebuffer_t *fb, uint32_t color);
 
+// Bounding box of all pixels that are not fully transparent black
+//
+// Rows above and below the content are scanned once; inside the content
+// each row is only scanned outside the box found so far, so a frame whose
+// content spans the full width costs little more than its empty margins.
+//
+// Returns false (and an empty rect) if every pixel is 0x00000000
+bool framebuffer_content_bounds(const framebuffer_t *fb,
+                                framebuffer_rect_t *out);
+
+// Same as framebuffer_content_bounds(), looking only inside area (clipped
+// to the framebuffer); pixels outside it are assumed transparent
+bool framebuffer_content_bounds_in(const framebuffer_t *fb,
+                                   framebuffer_rect_t area,
+                                   framebuffer_rect_t *out);
+
+// Smallest rectangle containing both a and b (either may be empty)
+framebuffer_rect_t framebuffer_rect_union(framebuffer_rect_t a,
+                                          framebuffer_rect_t b);
+
 // ════════════════════════════════════════════════════════════
 // PIXEL ACCESS
 // ════════════════════════════════════════════════════════════
@@ -104,6 +133,16 @@ void framebuffer_set_pixel(framebuffer_t *fb, int x, int y, uint32_t color);
 //   framebuffer_blend_pixel(&fb, 100, 100, 0x80FF0000);
 void framebuffer_blend_pixel(framebuffer_t *fb, int x, int y, uint32_t color);
 
+// Blend a horizontal run of pixels [x, x + len) on row y
+//
+// Same result as framebuffer_blend_pixel() for each pixel, with the bounds
+// check done once per run. Out-of-bounds parts are clipped.
+void framebuffer_blend_span(framebuffer_t *fb,
+                            int x,
+                            int y,
+                            int len,
+                            uint32_t color);
+
 // ════════════════════════════════════════════════════════════
 // DIRECT ACCESS (UNSAFE - USE WITH CAUTION)
 // ════════════════════════════════════════════════════════════
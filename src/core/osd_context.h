@@ -10,6 +10,7 @@
 #include "../config/osd_config.h"
 #include "../resources/font.h"
 #include "../resources/svg.h"
+#include "../utils/grow_buffer.h"
 #include "framebuffer.h"
 
 #include <stdbool.h>
@@ -24,7 +25,32 @@
 #define OSD_SAM_MASK_WIDTH 256
 #define OSD_SAM_MASK_HEIGHT 256
 #define OSD_SAM_MASK_SIZE (OSD_SAM_MASK_WIDTH * OSD_SAM_MASK_HEIGHT)
-#define OSD_SAM_MAX_RLE_SIZE 65536
+
+// SAM RLE storage: a 16 KB inline block covers typical masks; the limit
+// fits any valid mask (one 3-byte run per pixel at worst)
+#define OSD_SAM_RLE_INLINE_SIZE 16384
+#define OSD_SAM_MAX_RLE_SIZE (3 * OSD_SAM_MASK_SIZE)
+
+// State input buffer (wasm_osd_get_state_buffer): inline block and the
+// largest state a host may write into it
+#define OSD_STATE_INLINE_SIZE 16384
+#define OSD_STATE_MAX_SIZE (1024 * 1024)
+
+// Video frame buffer (wasm_osd_get_video_buffer): largest frame a host may
+// write into it (4:2:0 up to 4K)
+#define OSD_VIDEO_MAX_SIZE (32 * 1024 * 1024)
+
+// Render quality reductions (osd_context_t.quality), switched on by the
+// frame-budget governor when widgets take longer than the budget
+#define OSD_QUALITY_SKIP_DEBUG 0x01u       // Debug widgets are not drawn
+#define OSD_QUALITY_NAVBALL_NEAREST 0x02u  // Nav ball skin point-sampled
+#define OSD_QUALITY_OUTLINE_SINGLE 0x04u   // Text outlines in one pass
+#define OSD_QUALITY_SAM_CONTOUR 0x08u      // SAM mask outlined, not filled
+#define OSD_QUALITY_NAVBALL_HALF_RES 0x10u // Nav ball shaded per 2x2 block
+
+// Bit for a top-level JonGUIState field (tag n) in field masks and the
+// state change bitmap. All JonGUIState tags are < 32.
+#define OSD_STATE_FIELD(tag) (UINT32_C(1) << (tag))
 
 // ════════════════════════════════════════════════════════════
 // OSD CONTEXT
@@ -68,10 +94,26 @@ typedef struct osd_context
   // INTERNAL STATE (managed by framework - widgets read-only)
   // ──────────────────────────────────────────────────────────
 
-  // Proto buffer (internal - use osd_state.h accessors instead)
-  uint8_t proto_buffer[16384];
+  // Proto input (internal - use osd_state.h accessors instead).
+  // proto_data points at the bytes of the update being decoded; they are
+  // not retained after the update call returns.
+  const uint8_t *proto_data;
   size_t proto_size;
+  grow_buffer_t proto_input;   // Host-written states (get/commit API)
+  grow_buffer_t sam_rle_input; // Storage behind sam_tracking.mask_rle
   bool proto_valid;
+  uint32_t proto_field_mask; // JonGUIState tags to decode (bit n = tag n,
+                             // UINT32_MAX = all)
+
+  // Fields that changed since the current frame started (OSD_STATE_FIELD
+  // bits). The opaque_payloads bit is set when any payload-derived data
+  // below changed.
+  uint32_t state_changed;
+
+  // state_changed as it was when the current frame started: what changed
+  // since the previous frame was drawn. Widgets test it with
+  // osd_ctx_state_changed().
+  uint32_t frame_changed;
 
   // Client metadata from opaque payload (canvas info from frontend)
   struct
@@ -115,6 +157,7 @@ typedef struct osd_context
       int class_id;
     } items[OSD_MAX_DETECTIONS];
     int count;
+    int dropped; // Detections past OSD_MAX_DETECTIONS (not stored)
     int status; // ser_DetectionStatus enum
     bool valid;
   } detections;
@@ -129,10 +172,9 @@ typedef struct osd_context
     float centroid_x, centroid_y; // Centroid in NDC [-1.0, 1.0]
     float confidence;             // Tracking confidence [0.0, 1.0]
     // Static buffers for mask data (single object tracking)
-    uint8_t mask_rle[OSD_SAM_MAX_RLE_SIZE]; // RLE-encoded bytes from proto
-    size_t mask_rle_len;                    // Actual RLE data length
-    uint8_t mask_data[OSD_SAM_MASK_SIZE];   // Decoded binary mask
-    uint32_t mask_width;                    // Mask dimensions
+    const uint8_t *mask_rle; // RLE-encoded bytes (in sam_rle_input)
+    size_t mask_rle_len;     // Actual RLE data length
+    uint32_t mask_width;     // Mask dimensions
     uint32_t mask_height;
     uint32_t mask_pixels; // Non-zero pixel count
     // Kalman prediction
@@ -151,6 +193,10 @@ typedef struct osd_context
   bool navball_show_level_marker;
   void *navball_texture; // Pointer to texture_t (opaque)
   void *navball_lut;     // Pointer to navball_lut_t (opaque)
+  void *navball_cache;   // Pointer to navball_cache_t (opaque)
+  float navball_cache_epsilon;   // Orientation quantization step (degrees)
+  uint32_t navball_cache_hits;   // Frames served from the cached layer
+  uint32_t navball_cache_misses; // Frames that re-rendered the layer
 
   // Nav ball center indicator
   bool navball_show_center_indicator;
@@ -167,10 +213,12 @@ typedef struct osd_context
   svg_resource_t celestial_sun_back_svg;
   svg_resource_t celestial_moon_front_svg;
   svg_resource_t celestial_moon_back_svg;
+  void *celestial_cache; // Pointer to celestial_cache_t (opaque)
 
   // Rendering state
   bool needs_render;
   uint32_t frame_count;
+  uint32_t quality; // OSD_QUALITY_* reductions in effect (0 = full quality)
 } osd_context_t;
 
 // ════════════════════════════════════════════════════════════
@@ -190,6 +238,18 @@ osd_ctx_get_framebuffer(osd_context_t *ctx)
   return fb;
 }
 
+// Check whether any of the given state fields changed since the last frame
+// was drawn
+//
+// Usage:
+//   if (osd_ctx_state_changed(ctx, OSD_STATE_FIELD(ser_JonGUIState_cv_tag)))
+//     rebuild_cached_geometry(...);
+static inline bool
+osd_ctx_state_changed(const osd_context_t *ctx, uint32_t fields)
+{
+  return (ctx->frame_changed & fields) != 0;
+}
+
 // Get screen center coordinates
 static inline void
 osd_ctx_get_center(const osd_context_t *ctx, int *cx, int *cy)
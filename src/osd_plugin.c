@@ -19,6 +19,7 @@
 #include "rendering/blending.h"
 #include "rendering/primitives.h"
 #include "rendering/text.h"
+#include "rendering/yuv_blend.h"
 
 // Resource management
 #include "resources/font.h"
@@ -37,8 +38,14 @@
 
 // Configuration
 #include "config_json.h"
+#include "render_budget.h"
+#include "sparse_frame.h"
+#include "state_history.h"
+#include "widget_scheduler.h"
 
 // Utilities
+#include "utils/clock.h"
+#include "utils/hash.h"
 #include "utils/logging.h"
 #include "utils/math.h"
 #include "utils/resource_lookup.h"
@@ -65,7 +72,9 @@
 // Protocol buffer support
 #include "jon_shared_data.pb.h"
 #include "jon_shared_data_types.pb.h"
+#include "pb_common.h"
 #include "pb_decode.h"
+#include "pb_fastdec.h"
 
 // Opaque payload protos
 // Note: First sync with `make proto` if this include fails
@@ -89,13 +98,6 @@
 #define SAM_TRACKING_DAY_UUID "019f4a7c-8b2d-7a1e-9c3f-2e8d5f1a4b6e"
 #define SAM_TRACKING_HEAT_UUID "019f4a7c-8b2e-7f3c-a1d2-4e9b7c5f8a3d"
 
-// Opaque payload type IDs for dispatch
-#define OPAQUE_TYPE_NONE 0
-#define OPAQUE_TYPE_CLIENT_META 1
-#define OPAQUE_TYPE_CV_META 2
-#define OPAQUE_TYPE_DETECTIONS 3
-#define OPAQUE_TYPE_SAM_TRACKING 4
-
 // Mini XML parser (will include if available)
 // #include <mxml.h>
 
@@ -106,6 +108,65 @@
 static osd_context_t g_osd_ctx             = { 0 };
 static uint32_t g_framebuffer[1920 * 1080] = { 0 }; // Max size
 
+// Content bounds of the last rendered frame (for dirty regions)
+static framebuffer_rect_t g_content_bounds;
+
+// Incremented whenever the framebuffer content is replaced
+static uint32_t g_framebuffer_generation = 0;
+
+// Filled by wasm_osd_frame() when the host passes no info pointer
+static wasm_osd_frame_info_t g_frame_info;
+
+// Decoded state, double-buffered: updates decode into the back slot and
+// swap on success. A failed decode invalidates the front slot, so widgets
+// render without state (and the next delta has nothing to build on) until
+// a good update arrives
+static ser_JonGUIState g_pb_states[2];
+static int g_pb_front          = 0;
+static bool g_pb_front_valid   = false;
+
+// Recent decoded states for wasm_osd_render_at(), and the state it built
+// last (double-buffered to detect changes)
+static state_history_t g_state_history;
+static ser_JonGUIState g_pb_display[2];
+static int g_display_cur       = 0;
+static bool g_display_valid    = false;
+
+// Sequence number of the last state taken by wasm_osd_commit_delta();
+// deltas apply only on top of the update numbered one less
+static uint32_t g_state_seq    = 0;
+static bool g_state_seq_valid  = false;
+static uint64_t g_payload_hash = 0; // Hash of payload-derived ctx data
+
+// Incremented by every wasm_osd_init() (configuration load)
+static uint32_t g_config_generation = 0;
+
+// Signature of the frame in the framebuffer (see frame_signature()); not
+// valid while a frame is half drawn or its pixels are not predictable
+static uint64_t g_frame_signature   = 0;
+static bool g_frame_signature_valid = false;
+static uint64_t g_next_signature    = 0; // Of the frame being drawn
+static bool g_next_signature_valid  = false;
+
+// Frame being drawn by wasm_osd_render_step(), and its copy of the state
+static bool g_step_active = false;
+static ser_JonGUIState g_pb_step;
+static ser_JonGUIState *g_step_state = NULL; // &g_pb_step, or NULL
+
+// Latest-wins state mailbox (wasm_osd_get_state_mailbox()); slots live in
+// one heap block, NULL while there is no mailbox
+static wasm_osd_mailbox_t g_mailbox;
+static uint8_t *g_mailbox_slots = NULL;
+
+// Video frame buffer (wasm_osd_get_video_buffer()), NULL until requested
+static uint8_t *g_video_buffer         = NULL;
+static uint32_t g_video_buffer_capacity = 0;
+
+// Inline blocks of ctx->proto_input and ctx->sam_rle_input; inputs larger
+// than these move to a heap block (bounded by OSD_*_MAX_SIZE)
+static uint8_t g_state_inline[OSD_STATE_INLINE_SIZE];
+static uint8_t g_sam_rle_inline[OSD_SAM_RLE_INLINE_SIZE];
+
 // ════════════════════════════════════════════════════════════
 // RENDERING HELPERS
 // ════════════════════════════════════════════════════════════
@@ -141,116 +202,6 @@ load_config_xml(osd_context_t *ctx, const char *path)
 // Font and SVG loading now handled by resource modules (resources/font.c,
 // resources/svg.c) See font_load() and svg_load() for implementation
 
-// ════════════════════════════════════════════════════════════
-// OPAQUE PAYLOAD PARSING
-// ════════════════════════════════════════════════════════════
-
-// Struct to hold callback context for opaque payload parsing
-typedef struct
-{
-  osd_context_t *ctx;
-  char uuid_buffer[64];
-  uint8_t payload_buffer[4096];
-  size_t payload_size;
-  bool uuid_matched;
-  int matched_type; // OPAQUE_TYPE_* constants
-} opaque_payload_ctx_t;
-
-// Callback for type_uuid string field in JonOpaquePayload
-static bool
-opaque_uuid_decode_callback(pb_istream_t *stream,
-                            const pb_field_t *field,
-                            void **arg)
-{
-  opaque_payload_ctx_t *cb_ctx = (opaque_payload_ctx_t *)*arg;
-  (void)field; // unused
-
-  size_t len = stream->bytes_left;
-  if (len >= sizeof(cb_ctx->uuid_buffer))
-    {
-      len = sizeof(cb_ctx->uuid_buffer) - 1;
-    }
-
-  if (!pb_read(stream, (pb_byte_t *)cb_ctx->uuid_buffer, len))
-    {
-      return false;
-    }
-
-  cb_ctx->uuid_buffer[len] = '\0';
-
-  // Check UUID against known opaque payload types
-  cb_ctx->uuid_matched = false;
-  cb_ctx->matched_type = OPAQUE_TYPE_NONE;
-
-  if (strcmp(cb_ctx->uuid_buffer, OSD_CLIENT_METADATA_UUID) == 0)
-    {
-      cb_ctx->uuid_matched = true;
-      cb_ctx->matched_type = OPAQUE_TYPE_CLIENT_META;
-    }
-  else if (strcmp(cb_ctx->uuid_buffer, CV_META_UUID) == 0)
-    {
-      cb_ctx->uuid_matched = true;
-      cb_ctx->matched_type = OPAQUE_TYPE_CV_META;
-    }
-#ifdef OSD_STREAM_DAY
-  else if (strcmp(cb_ctx->uuid_buffer, OBJECT_DETECTIONS_DAY_UUID) == 0)
-    {
-      cb_ctx->uuid_matched = true;
-      cb_ctx->matched_type = OPAQUE_TYPE_DETECTIONS;
-    }
-#endif
-#ifdef OSD_STREAM_THERMAL
-  else if (strcmp(cb_ctx->uuid_buffer, OBJECT_DETECTIONS_HEAT_UUID) == 0)
-    {
-      cb_ctx->uuid_matched = true;
-      cb_ctx->matched_type = OPAQUE_TYPE_DETECTIONS;
-    }
-#endif
-#ifdef OSD_STREAM_DAY
-  else if (strcmp(cb_ctx->uuid_buffer, SAM_TRACKING_DAY_UUID) == 0)
-    {
-      cb_ctx->uuid_matched = true;
-      cb_ctx->matched_type = OPAQUE_TYPE_SAM_TRACKING;
-    }
-#endif
-#ifdef OSD_STREAM_THERMAL
-  else if (strcmp(cb_ctx->uuid_buffer, SAM_TRACKING_HEAT_UUID) == 0)
-    {
-      cb_ctx->uuid_matched = true;
-      cb_ctx->matched_type = OPAQUE_TYPE_SAM_TRACKING;
-    }
-#endif
-
-  return true;
-}
-
-// Callback for payload bytes field in JonOpaquePayload
-static bool
-opaque_payload_decode_callback(pb_istream_t *stream,
-                               const pb_field_t *field,
-                               void **arg)
-{
-  opaque_payload_ctx_t *cb_ctx = (opaque_payload_ctx_t *)*arg;
-  (void)field; // unused
-
-  cb_ctx->payload_size = stream->bytes_left;
-  if (cb_ctx->payload_size > sizeof(cb_ctx->payload_buffer))
-    {
-      // Payload too large, skip with warning
-      LOG_WARN("Oversized opaque payload (%zu > %zu max), skipping",
-               cb_ctx->payload_size, sizeof(cb_ctx->payload_buffer));
-      cb_ctx->payload_size = 0;
-      return pb_read(stream, NULL, stream->bytes_left);
-    }
-
-  if (!pb_read(stream, cb_ctx->payload_buffer, cb_ctx->payload_size))
-    {
-      return false;
-    }
-
-  return true;
-}
-
 // ════════════════════════════════════════════════════════════
 // NANOPB CALLBACKS FOR CV DATA
 // ════════════════════════════════════════════════════════════
@@ -303,13 +254,17 @@ detections_decode_callback(pb_istream_t *stream,
   (void)field;
 
   ser_ObjectDetection det = ser_ObjectDetection_init_zero;
-  if (!pb_decode(stream, ser_ObjectDetection_fields, &det))
+  if (!pbfast_decode_ser_ObjectDetection(stream, &det, PBFAST_ALL_FIELDS))
     {
       return false;
     }
 
   int idx = det_ctx->ctx->detections.count;
-  if (idx < OSD_MAX_DETECTIONS)
+  if (idx >= OSD_MAX_DETECTIONS)
+    {
+      det_ctx->ctx->detections.dropped++;
+    }
+  else
     {
       det_ctx->ctx->detections.items[idx].x1         = det.x1;
       det_ctx->ctx->detections.items[idx].y1         = det.y1;
@@ -323,7 +278,7 @@ detections_decode_callback(pb_istream_t *stream,
   return true;
 }
 
-// Callback to capture mask_rle bytes from proto into static buffer
+// Callback to capture mask_rle bytes from proto into ctx->sam_rle_input
 static bool
 sam_mask_rle_decode_callback(pb_istream_t *stream,
                              const pb_field_t *field,
@@ -334,7 +289,7 @@ sam_mask_rle_decode_callback(pb_istream_t *stream,
 
   size_t len = stream->bytes_left;
 
-  // Reset length (static buffer, no free needed)
+  // Reset length (buffer is reused, no free needed)
   ctx->sam_tracking.mask_rle_len = 0;
 
   if (len == 0)
@@ -342,667 +297,2170 @@ sam_mask_rle_decode_callback(pb_istream_t *stream,
       return true; // Empty mask is valid
     }
 
-  // Clamp to static buffer size
-  if (len > OSD_SAM_MAX_RLE_SIZE)
+  // Larger than any valid mask: drop it whole rather than truncate
+  if (!grow_buffer_reserve(&ctx->sam_rle_input, len))
     {
-      len = OSD_SAM_MAX_RLE_SIZE;
+      LOG_WARN("SAM mask RLE dropped: %zu bytes (max %d)", len,
+               OSD_SAM_MAX_RLE_SIZE);
+      return pb_read(stream, NULL, len);
     }
 
-  // Copy directly into static buffer
+  // Copy straight from the payload sub-stream
+  ctx->sam_tracking.mask_rle     = ctx->sam_rle_input.data;
   ctx->sam_tracking.mask_rle_len = len;
-  return pb_read(stream, ctx->sam_tracking.mask_rle, len);
+  return pb_read(stream, ctx->sam_rle_input.data, len);
 }
 
-// Callback for opaque_payloads repeated field in JonGUIState
-static bool
-opaque_payloads_decode_callback(pb_istream_t *stream,
-                                const pb_field_t *field,
-                                void **arg)
-{
-  osd_context_t *ctx = (osd_context_t *)*arg;
-  (void)field; // unused
-
-  // Set up context for nested callbacks
-  opaque_payload_ctx_t cb_ctx = { 0 };
-  cb_ctx.ctx                  = ctx;
-  cb_ctx.uuid_matched         = false;
-
-  // Set up JonOpaquePayload with callbacks for its fields
-  ser_JonOpaquePayload opaque_payload   = ser_JonOpaquePayload_init_zero;
-  opaque_payload.type_uuid.funcs.decode = opaque_uuid_decode_callback;
-  opaque_payload.type_uuid.arg          = &cb_ctx;
-  opaque_payload.payload.funcs.decode   = opaque_payload_decode_callback;
-  opaque_payload.payload.arg            = &cb_ctx;
+// ════════════════════════════════════════════════════════════
+// OPAQUE PAYLOAD DECODERS
+// ════════════════════════════════════════════════════════════
+//
+// One function per payload type. Each decodes straight from the payload
+// sub-stream of the enclosing JonOpaquePayload into the context; bytes
+// left over after a failed decode are skipped by the caller.
 
-  // Decode the JonOpaquePayload submessage
-  if (!pb_decode(stream, ser_JonOpaquePayload_fields, &opaque_payload))
-    {
-      LOG_WARN("Failed to decode opaque payload");
-      return false;
-    }
+// OsdClientMetadata: canvas/proxy geometry and theme from the frontend
+static void
+decode_client_metadata_payload(osd_context_t *ctx, pb_istream_t *stream)
+{
+  ser_OsdClientMetadata client_metadata = ser_OsdClientMetadata_init_zero;
 
-  // Dispatch based on matched type
-  if (!cb_ctx.uuid_matched || cb_ctx.payload_size == 0)
+  if (pbfast_decode_ser_OsdClientMetadata(stream, &client_metadata,
+                                          PBFAST_ALL_FIELDS))
     {
-      // Rate-limited log for unmatched UUIDs
-      static int unmatched_log_counter = 0;
-      if (unmatched_log_counter++ % 300 == 0 && !cb_ctx.uuid_matched)
+      // Validate ranges to prevent overflow or division by zero
+      if (client_metadata.canvas_width_px == 0
+          || client_metadata.canvas_width_px > 40960
+          || client_metadata.canvas_height_px == 0
+          || client_metadata.canvas_height_px > 40960
+          || client_metadata.device_pixel_ratio <= 0.0f
+          || client_metadata.device_pixel_ratio > 10.0f
+          || client_metadata.device_pixel_ratio
+               != client_metadata.device_pixel_ratio)
         {
-          LOG_WARN("[det-debug] Unmatched opaque UUID: %s (size=%zu)",
-                   cb_ctx.uuid_buffer, cb_ctx.payload_size);
+          LOG_WARN("Invalid OsdClientMetadata: w=%u h=%u dpr=%f",
+                   client_metadata.canvas_width_px,
+                   client_metadata.canvas_height_px,
+                   client_metadata.device_pixel_ratio);
+          return;
         }
-      return true;
-    }
-
-  pb_istream_t payload_stream
-    = pb_istream_from_buffer(cb_ctx.payload_buffer, cb_ctx.payload_size);
-
-  if (cb_ctx.matched_type == OPAQUE_TYPE_CLIENT_META)
-    {
-      ser_OsdClientMetadata client_metadata = ser_OsdClientMetadata_init_zero;
-
-      if (pb_decode(&payload_stream, ser_OsdClientMetadata_fields,
-                    &client_metadata))
-        {
-          // Validate ranges to prevent overflow or division by zero
-          if (client_metadata.canvas_width_px == 0
-              || client_metadata.canvas_width_px > 40960
-              || client_metadata.canvas_height_px == 0
-              || client_metadata.canvas_height_px > 40960
-              || client_metadata.device_pixel_ratio <= 0.0f
-              || client_metadata.device_pixel_ratio > 10.0f
-              || client_metadata.device_pixel_ratio
-                   != client_metadata.device_pixel_ratio)
-            {
-              LOG_WARN("Invalid OsdClientMetadata: w=%u h=%u dpr=%f",
-                       client_metadata.canvas_width_px,
-                       client_metadata.canvas_height_px,
-                       client_metadata.device_pixel_ratio);
-              return true;
-            }
 
-          ctx->client_metadata.canvas_width_px
-            = client_metadata.canvas_width_px;
-          ctx->client_metadata.canvas_height_px
-            = client_metadata.canvas_height_px;
-          ctx->client_metadata.device_pixel_ratio
-            = client_metadata.device_pixel_ratio;
-          ctx->client_metadata.osd_buffer_width
-            = client_metadata.osd_buffer_width;
-          ctx->client_metadata.osd_buffer_height
-            = client_metadata.osd_buffer_height;
-          ctx->client_metadata.video_proxy_ndc_x
-            = client_metadata.video_proxy_ndc_x;
-          ctx->client_metadata.video_proxy_ndc_y
-            = client_metadata.video_proxy_ndc_y;
-          ctx->client_metadata.video_proxy_ndc_width
-            = client_metadata.video_proxy_ndc_width;
-          ctx->client_metadata.video_proxy_ndc_height
-            = client_metadata.video_proxy_ndc_height;
-          ctx->client_metadata.scale_factor  = client_metadata.scale_factor;
-          ctx->client_metadata.is_sharp_mode = client_metadata.is_sharp_mode;
-          ctx->client_metadata.theme_hue     = client_metadata.theme_hue;
-          ctx->client_metadata.theme_chroma  = client_metadata.theme_chroma;
-          ctx->client_metadata.theme_lightness
-            = client_metadata.theme_lightness;
-          ctx->client_metadata.valid = true;
-
-          LOG_DEBUG(
-            "Parsed OsdClientMetadata: canvas=%ux%u @%.2fx -> %ux%u, "
-            "proxy=(%.2f,%.2f,%.2f,%.2f) s:%.2f, "
-            "theme=%s H:%.0f C:%.2f L:%.0f",
-            client_metadata.canvas_width_px, client_metadata.canvas_height_px,
-            client_metadata.device_pixel_ratio,
-            client_metadata.osd_buffer_width, client_metadata.osd_buffer_height,
-            client_metadata.video_proxy_ndc_x,
-            client_metadata.video_proxy_ndc_y,
-            client_metadata.video_proxy_ndc_width,
-            client_metadata.video_proxy_ndc_height,
-            client_metadata.scale_factor,
-            client_metadata.is_sharp_mode ? "Sharp" : "Default",
-            client_metadata.theme_hue, client_metadata.theme_chroma,
-            client_metadata.theme_lightness);
-        }
-      else
-        {
-          LOG_WARN("Failed to decode OsdClientMetadata payload");
-        }
+      ctx->client_metadata.canvas_width_px  = client_metadata.canvas_width_px;
+      ctx->client_metadata.canvas_height_px = client_metadata.canvas_height_px;
+      ctx->client_metadata.device_pixel_ratio
+        = client_metadata.device_pixel_ratio;
+      ctx->client_metadata.osd_buffer_width = client_metadata.osd_buffer_width;
+      ctx->client_metadata.osd_buffer_height
+        = client_metadata.osd_buffer_height;
+      ctx->client_metadata.video_proxy_ndc_x
+        = client_metadata.video_proxy_ndc_x;
+      ctx->client_metadata.video_proxy_ndc_y
+        = client_metadata.video_proxy_ndc_y;
+      ctx->client_metadata.video_proxy_ndc_width
+        = client_metadata.video_proxy_ndc_width;
+      ctx->client_metadata.video_proxy_ndc_height
+        = client_metadata.video_proxy_ndc_height;
+      ctx->client_metadata.scale_factor    = client_metadata.scale_factor;
+      ctx->client_metadata.is_sharp_mode   = client_metadata.is_sharp_mode;
+      ctx->client_metadata.theme_hue       = client_metadata.theme_hue;
+      ctx->client_metadata.theme_chroma    = client_metadata.theme_chroma;
+      ctx->client_metadata.theme_lightness = client_metadata.theme_lightness;
+      ctx->client_metadata.valid           = true;
+
+      LOG_DEBUG(
+        "Parsed OsdClientMetadata: canvas=%ux%u @%.2fx -> %ux%u, "
+        "proxy=(%.2f,%.2f,%.2f,%.2f) s:%.2f, "
+        "theme=%s H:%.0f C:%.2f L:%.0f",
+        client_metadata.canvas_width_px, client_metadata.canvas_height_px,
+        client_metadata.device_pixel_ratio, client_metadata.osd_buffer_width,
+        client_metadata.osd_buffer_height, client_metadata.video_proxy_ndc_x,
+        client_metadata.video_proxy_ndc_y,
+        client_metadata.video_proxy_ndc_width,
+        client_metadata.video_proxy_ndc_height, client_metadata.scale_factor,
+        client_metadata.is_sharp_mode ? "Sharp" : "Default",
+        client_metadata.theme_hue, client_metadata.theme_chroma,
+        client_metadata.theme_lightness);
     }
-  else if (cb_ctx.matched_type == OPAQUE_TYPE_CV_META)
+  else
     {
-      ser_CvMeta cv_meta = ser_CvMeta_init_zero;
+      LOG_WARN("Failed to decode OsdClientMetadata payload");
+    }
+}
+
+// CvMeta: sharpness score and 8x8 grid for this variant's stream
+static void
+decode_cv_meta_payload(osd_context_t *ctx, pb_istream_t *stream)
+{
+  ser_CvMeta cv_meta = ser_CvMeta_init_zero;
 
-      // Wire sharpness_level3 callback for the appropriate channel
-      float_array_ctx_t level3_ctx = { .dest  = ctx->cv_meta.sharpness_level3,
-                                       .count = 0,
-                                       .max_count = 64 };
+  // Wire sharpness_level3 callback for the appropriate channel
+  float_array_ctx_t level3_ctx = { .dest  = ctx->cv_meta.sharpness_level3,
+                                   .count = 0,
+                                   .max_count = 64 };
 
 #ifdef OSD_STREAM_DAY
-      cv_meta.channel_day.sharpness_level3.funcs.decode
-        = sharpness_level3_decode_callback;
-      cv_meta.channel_day.sharpness_level3.arg = &level3_ctx;
+  cv_meta.channel_day.sharpness_level3.funcs.decode
+    = sharpness_level3_decode_callback;
+  cv_meta.channel_day.sharpness_level3.arg = &level3_ctx;
 #endif
 #ifdef OSD_STREAM_THERMAL
-      cv_meta.channel_heat.sharpness_level3.funcs.decode
-        = sharpness_level3_decode_callback;
-      cv_meta.channel_heat.sharpness_level3.arg = &level3_ctx;
+  cv_meta.channel_heat.sharpness_level3.funcs.decode
+    = sharpness_level3_decode_callback;
+  cv_meta.channel_heat.sharpness_level3.arg = &level3_ctx;
 #endif
 
-      if (pb_decode(&payload_stream, ser_CvMeta_fields, &cv_meta))
-        {
+  if (pbfast_decode_ser_CvMeta(stream, &cv_meta, PBFAST_ALL_FIELDS))
+    {
 #ifdef OSD_STREAM_DAY
-          if (cv_meta.has_channel_day && cv_meta.channel_day.sharpness_valid)
-            {
-              ctx->cv_meta.sharpness_level0
-                = cv_meta.channel_day.sharpness_level0;
-              ctx->cv_meta.sharpness_level3_count = level3_ctx.count;
-              ctx->cv_meta.sharpness_valid        = true;
-              LOG_DEBUG("CvMeta day: sharpness=%.3f grid=%d",
-                        ctx->cv_meta.sharpness_level0,
-                        ctx->cv_meta.sharpness_level3_count);
-            }
+      if (cv_meta.has_channel_day && cv_meta.channel_day.sharpness_valid)
+        {
+          ctx->cv_meta.sharpness_level0
+            = cv_meta.channel_day.sharpness_level0;
+          ctx->cv_meta.sharpness_level3_count = level3_ctx.count;
+          ctx->cv_meta.sharpness_valid        = true;
+          LOG_DEBUG("CvMeta day: sharpness=%.3f grid=%d",
+                    ctx->cv_meta.sharpness_level0,
+                    ctx->cv_meta.sharpness_level3_count);
+        }
 #endif
 #ifdef OSD_STREAM_THERMAL
-          if (cv_meta.has_channel_heat && cv_meta.channel_heat.sharpness_valid)
-            {
-              ctx->cv_meta.sharpness_level0
-                = cv_meta.channel_heat.sharpness_level0;
-              ctx->cv_meta.sharpness_level3_count = level3_ctx.count;
-              ctx->cv_meta.sharpness_valid        = true;
-              LOG_DEBUG("CvMeta heat: sharpness=%.3f grid=%d",
-                        ctx->cv_meta.sharpness_level0,
-                        ctx->cv_meta.sharpness_level3_count);
-            }
-#endif
-        }
-      else
+      if (cv_meta.has_channel_heat && cv_meta.channel_heat.sharpness_valid)
         {
-          LOG_WARN("Failed to decode CvMeta payload");
+          ctx->cv_meta.sharpness_level0
+            = cv_meta.channel_heat.sharpness_level0;
+          ctx->cv_meta.sharpness_level3_count = level3_ctx.count;
+          ctx->cv_meta.sharpness_valid        = true;
+          LOG_DEBUG("CvMeta heat: sharpness=%.3f grid=%d",
+                    ctx->cv_meta.sharpness_level0,
+                    ctx->cv_meta.sharpness_level3_count);
         }
+#endif
     }
-  else if (cb_ctx.matched_type == OPAQUE_TYPE_DETECTIONS)
+  else
     {
-      // Wire detections callback
-      detections_ctx_t det_ctx = { .ctx = ctx };
-      ctx->detections.count    = 0;
+      LOG_WARN("Failed to decode CvMeta payload");
+    }
+}
+
+// ObjectDetectionsDay/Heat: YOLO detections for this variant's stream
+static void
+decode_detections_payload(osd_context_t *ctx, pb_istream_t *stream)
+{
+  size_t payload_size = stream->bytes_left;
+
+  // Wire detections callback
+  detections_ctx_t det_ctx = { .ctx = ctx };
+  ctx->detections.count    = 0;
+  ctx->detections.dropped  = 0;
 
-      // Rate-limited detection debug logging (every 150 frames ≈ 5s at 30Hz)
-      static int det_log_counter = 0;
-      bool det_should_log        = (det_log_counter++ % 150 == 0);
+  // Rate-limited detection debug logging (every 150 frames ≈ 5s at 30Hz)
+  static int det_log_counter = 0;
+  bool det_should_log        = (det_log_counter++ % 150 == 0);
 
 #ifdef OSD_STREAM_DAY
-      ser_ObjectDetectionsDay det_msg = ser_ObjectDetectionsDay_init_zero;
-      det_msg.detections.funcs.decode = detections_decode_callback;
-      det_msg.detections.arg          = &det_ctx;
+  ser_ObjectDetectionsDay det_msg = ser_ObjectDetectionsDay_init_zero;
+  det_msg.detections.funcs.decode = detections_decode_callback;
+  det_msg.detections.arg          = &det_ctx;
 
-      if (pb_decode(&payload_stream, ser_ObjectDetectionsDay_fields, &det_msg))
+  if (pbfast_decode_ser_ObjectDetectionsDay(stream, &det_msg,
+                                            PBFAST_ALL_FIELDS))
+    {
+      ctx->detections.status = (int)det_msg.status;
+      ctx->detections.valid  = true;
+      if (det_should_log)
         {
-          ctx->detections.status = (int)det_msg.status;
-          ctx->detections.valid  = true;
-          if (det_should_log)
+          LOG_WARN("[det-debug] DAY: status=%d count=%d payload=%zu "
+                   "enabled=%d",
+                   ctx->detections.status, ctx->detections.count,
+                   payload_size, ctx->config.detections.enabled);
+          for (int i = 0; i < ctx->detections.count && i < 3; i++)
             {
-              LOG_WARN("[det-debug] DAY: status=%d count=%d payload=%zu "
-                       "enabled=%d",
-                       ctx->detections.status, ctx->detections.count,
-                       cb_ctx.payload_size, ctx->config.detections.enabled);
-              for (int i = 0; i < ctx->detections.count && i < 3; i++)
-                {
-                  LOG_WARN(
-                    "[det-debug]   [%d] class=%d conf=%.2f "
-                    "box=(%.3f,%.3f)-(%.3f,%.3f)",
-                    i, ctx->detections.items[i].class_id,
-                    ctx->detections.items[i].confidence,
-                    ctx->detections.items[i].x1, ctx->detections.items[i].y1,
-                    ctx->detections.items[i].x2, ctx->detections.items[i].y2);
-                }
+              LOG_WARN(
+                "[det-debug]   [%d] class=%d conf=%.2f "
+                "box=(%.3f,%.3f)-(%.3f,%.3f)",
+                i, ctx->detections.items[i].class_id,
+                ctx->detections.items[i].confidence,
+                ctx->detections.items[i].x1, ctx->detections.items[i].y1,
+                ctx->detections.items[i].x2, ctx->detections.items[i].y2);
             }
         }
-      else
-        {
-          LOG_WARN("Failed to decode ObjectDetectionsDay payload");
-        }
+    }
+  else
+    {
+      LOG_WARN("Failed to decode ObjectDetectionsDay payload");
+    }
 #endif
 
 #ifdef OSD_STREAM_THERMAL
-      ser_ObjectDetectionsHeat det_msg = ser_ObjectDetectionsHeat_init_zero;
-      det_msg.detections.funcs.decode  = detections_decode_callback;
-      det_msg.detections.arg           = &det_ctx;
+  ser_ObjectDetectionsHeat det_msg = ser_ObjectDetectionsHeat_init_zero;
+  det_msg.detections.funcs.decode  = detections_decode_callback;
+  det_msg.detections.arg           = &det_ctx;
 
-      if (pb_decode(&payload_stream, ser_ObjectDetectionsHeat_fields, &det_msg))
+  if (pbfast_decode_ser_ObjectDetectionsHeat(stream, &det_msg,
+                                             PBFAST_ALL_FIELDS))
+    {
+      ctx->detections.status = (int)det_msg.status;
+      ctx->detections.valid  = true;
+      if (det_should_log)
         {
-          ctx->detections.status = (int)det_msg.status;
-          ctx->detections.valid  = true;
-          if (det_should_log)
+          LOG_WARN("[det-debug] HEAT: status=%d count=%d payload=%zu "
+                   "enabled=%d",
+                   ctx->detections.status, ctx->detections.count,
+                   payload_size, ctx->config.detections.enabled);
+          for (int i = 0; i < ctx->detections.count && i < 3; i++)
             {
-              LOG_WARN("[det-debug] HEAT: status=%d count=%d payload=%zu "
-                       "enabled=%d",
-                       ctx->detections.status, ctx->detections.count,
-                       cb_ctx.payload_size, ctx->config.detections.enabled);
-              for (int i = 0; i < ctx->detections.count && i < 3; i++)
-                {
-                  LOG_WARN(
-                    "[det-debug]   [%d] class=%d conf=%.2f "
-                    "box=(%.3f,%.3f)-(%.3f,%.3f)",
-                    i, ctx->detections.items[i].class_id,
-                    ctx->detections.items[i].confidence,
-                    ctx->detections.items[i].x1, ctx->detections.items[i].y1,
-                    ctx->detections.items[i].x2, ctx->detections.items[i].y2);
-                }
+              LOG_WARN(
+                "[det-debug]   [%d] class=%d conf=%.2f "
+                "box=(%.3f,%.3f)-(%.3f,%.3f)",
+                i, ctx->detections.items[i].class_id,
+                ctx->detections.items[i].confidence,
+                ctx->detections.items[i].x1, ctx->detections.items[i].y1,
+                ctx->detections.items[i].x2, ctx->detections.items[i].y2);
             }
         }
-      else
-        {
-          LOG_WARN("Failed to decode ObjectDetectionsHeat payload");
-        }
-#endif
     }
-  else if (cb_ctx.matched_type == OPAQUE_TYPE_SAM_TRACKING)
+  else
+    {
+      LOG_WARN("Failed to decode ObjectDetectionsHeat payload");
+    }
+#endif
+
+  if (ctx->detections.dropped > 0 && det_should_log)
     {
-      // Rate-limited SAM tracking debug logging
-      static int sam_log_counter = 0;
-      bool sam_should_log        = (sam_log_counter++ % 150 == 0);
+      LOG_WARN("Detections: %d beyond the %d-entry limit not shown",
+               ctx->detections.dropped, OSD_MAX_DETECTIONS);
+    }
+}
+
+// SamTrackingDay/Heat: SAM tracking state and RLE mask
+static void
+decode_sam_tracking_payload(osd_context_t *ctx, pb_istream_t *stream)
+{
+  // Rate-limited SAM tracking debug logging
+  static int sam_log_counter = 0;
+  bool sam_should_log        = (sam_log_counter++ % 150 == 0);
 
 #ifdef OSD_STREAM_DAY
-      ser_SamTrackingDay sam_msg    = ser_SamTrackingDay_init_zero;
-      sam_msg.mask_rle.funcs.decode = sam_mask_rle_decode_callback;
-      sam_msg.mask_rle.arg          = ctx;
+  ser_SamTrackingDay sam_msg    = ser_SamTrackingDay_init_zero;
+  sam_msg.mask_rle.funcs.decode = sam_mask_rle_decode_callback;
+  sam_msg.mask_rle.arg          = ctx;
 
-      if (pb_decode(&payload_stream, ser_SamTrackingDay_fields, &sam_msg))
-        {
-          ctx->sam_tracking.status      = (int)sam_msg.status;
-          ctx->sam_tracking.state       = (int)sam_msg.state;
-          ctx->sam_tracking.bbox_x1     = (float)sam_msg.bbox_x1;
-          ctx->sam_tracking.bbox_y1     = (float)sam_msg.bbox_y1;
-          ctx->sam_tracking.bbox_x2     = (float)sam_msg.bbox_x2;
-          ctx->sam_tracking.bbox_y2     = (float)sam_msg.bbox_y2;
-          ctx->sam_tracking.centroid_x  = (float)sam_msg.centroid_x;
-          ctx->sam_tracking.centroid_y  = (float)sam_msg.centroid_y;
-          ctx->sam_tracking.confidence  = sam_msg.confidence;
-          ctx->sam_tracking.mask_width  = sam_msg.mask_width;
-          ctx->sam_tracking.mask_height = sam_msg.mask_height;
-          ctx->sam_tracking.mask_pixels = sam_msg.mask_pixels;
-          ctx->sam_tracking.kf_predicted_x
-            = sam_msg.has_kalman ? (float)sam_msg.kalman.predicted_x : 0.0f;
-          ctx->sam_tracking.kf_predicted_y
-            = sam_msg.has_kalman ? (float)sam_msg.kalman.predicted_y : 0.0f;
-          ctx->sam_tracking.lost_frame_count = sam_msg.lost_frame_count;
-          ctx->sam_tracking.valid            = true;
-          // Note: mask_rle decoding deferred to widget (if needed)
-
-          if (sam_should_log)
-            {
-              LOG_WARN("[sam-debug] DAY: status=%d state=%d conf=%.2f "
-                       "box=(%.3f,%.3f)-(%.3f,%.3f)",
-                       ctx->sam_tracking.status, ctx->sam_tracking.state,
-                       ctx->sam_tracking.confidence, ctx->sam_tracking.bbox_x1,
-                       ctx->sam_tracking.bbox_y1, ctx->sam_tracking.bbox_x2,
-                       ctx->sam_tracking.bbox_y2);
-            }
-        }
-      else
+  if (pbfast_decode_ser_SamTrackingDay(stream, &sam_msg, PBFAST_ALL_FIELDS))
+    {
+      ctx->sam_tracking.status      = (int)sam_msg.status;
+      ctx->sam_tracking.state       = (int)sam_msg.state;
+      ctx->sam_tracking.bbox_x1     = (float)sam_msg.bbox_x1;
+      ctx->sam_tracking.bbox_y1     = (float)sam_msg.bbox_y1;
+      ctx->sam_tracking.bbox_x2     = (float)sam_msg.bbox_x2;
+      ctx->sam_tracking.bbox_y2     = (float)sam_msg.bbox_y2;
+      ctx->sam_tracking.centroid_x  = (float)sam_msg.centroid_x;
+      ctx->sam_tracking.centroid_y  = (float)sam_msg.centroid_y;
+      ctx->sam_tracking.confidence  = sam_msg.confidence;
+      ctx->sam_tracking.mask_width  = sam_msg.mask_width;
+      ctx->sam_tracking.mask_height = sam_msg.mask_height;
+      ctx->sam_tracking.mask_pixels = sam_msg.mask_pixels;
+      ctx->sam_tracking.kf_predicted_x
+        = sam_msg.has_kalman ? (float)sam_msg.kalman.predicted_x : 0.0f;
+      ctx->sam_tracking.kf_predicted_y
+        = sam_msg.has_kalman ? (float)sam_msg.kalman.predicted_y : 0.0f;
+      ctx->sam_tracking.lost_frame_count = sam_msg.lost_frame_count;
+      ctx->sam_tracking.valid            = true;
+      // Note: mask_rle decoding deferred to widget (if needed)
+
+      if (sam_should_log)
         {
-          LOG_WARN("Failed to decode SamTrackingDay payload");
+          LOG_WARN("[sam-debug] DAY: status=%d state=%d conf=%.2f "
+                   "box=(%.3f,%.3f)-(%.3f,%.3f)",
+                   ctx->sam_tracking.status, ctx->sam_tracking.state,
+                   ctx->sam_tracking.confidence, ctx->sam_tracking.bbox_x1,
+                   ctx->sam_tracking.bbox_y1, ctx->sam_tracking.bbox_x2,
+                   ctx->sam_tracking.bbox_y2);
         }
+    }
+  else
+    {
+      LOG_WARN("Failed to decode SamTrackingDay payload");
+    }
 #endif
 
 #ifdef OSD_STREAM_THERMAL
-      ser_SamTrackingHeat sam_msg   = ser_SamTrackingHeat_init_zero;
-      sam_msg.mask_rle.funcs.decode = sam_mask_rle_decode_callback;
-      sam_msg.mask_rle.arg          = ctx;
+  ser_SamTrackingHeat sam_msg   = ser_SamTrackingHeat_init_zero;
+  sam_msg.mask_rle.funcs.decode = sam_mask_rle_decode_callback;
+  sam_msg.mask_rle.arg          = ctx;
 
-      if (pb_decode(&payload_stream, ser_SamTrackingHeat_fields, &sam_msg))
-        {
-          ctx->sam_tracking.status      = (int)sam_msg.status;
-          ctx->sam_tracking.state       = (int)sam_msg.state;
-          ctx->sam_tracking.bbox_x1     = (float)sam_msg.bbox_x1;
-          ctx->sam_tracking.bbox_y1     = (float)sam_msg.bbox_y1;
-          ctx->sam_tracking.bbox_x2     = (float)sam_msg.bbox_x2;
-          ctx->sam_tracking.bbox_y2     = (float)sam_msg.bbox_y2;
-          ctx->sam_tracking.centroid_x  = (float)sam_msg.centroid_x;
-          ctx->sam_tracking.centroid_y  = (float)sam_msg.centroid_y;
-          ctx->sam_tracking.confidence  = sam_msg.confidence;
-          ctx->sam_tracking.mask_width  = sam_msg.mask_width;
-          ctx->sam_tracking.mask_height = sam_msg.mask_height;
-          ctx->sam_tracking.mask_pixels = sam_msg.mask_pixels;
-          ctx->sam_tracking.kf_predicted_x
-            = sam_msg.has_kalman ? (float)sam_msg.kalman.predicted_x : 0.0f;
-          ctx->sam_tracking.kf_predicted_y
-            = sam_msg.has_kalman ? (float)sam_msg.kalman.predicted_y : 0.0f;
-          ctx->sam_tracking.lost_frame_count = sam_msg.lost_frame_count;
-          ctx->sam_tracking.valid            = true;
-
-          if (sam_should_log)
-            {
-              LOG_WARN("[sam-debug] HEAT: status=%d state=%d conf=%.2f "
-                       "box=(%.3f,%.3f)-(%.3f,%.3f)",
-                       ctx->sam_tracking.status, ctx->sam_tracking.state,
-                       ctx->sam_tracking.confidence, ctx->sam_tracking.bbox_x1,
-                       ctx->sam_tracking.bbox_y1, ctx->sam_tracking.bbox_x2,
-                       ctx->sam_tracking.bbox_y2);
-            }
-        }
-      else
+  if (pbfast_decode_ser_SamTrackingHeat(stream, &sam_msg, PBFAST_ALL_FIELDS))
+    {
+      ctx->sam_tracking.status      = (int)sam_msg.status;
+      ctx->sam_tracking.state       = (int)sam_msg.state;
+      ctx->sam_tracking.bbox_x1     = (float)sam_msg.bbox_x1;
+      ctx->sam_tracking.bbox_y1     = (float)sam_msg.bbox_y1;
+      ctx->sam_tracking.bbox_x2     = (float)sam_msg.bbox_x2;
+      ctx->sam_tracking.bbox_y2     = (float)sam_msg.bbox_y2;
+      ctx->sam_tracking.centroid_x  = (float)sam_msg.centroid_x;
+      ctx->sam_tracking.centroid_y  = (float)sam_msg.centroid_y;
+      ctx->sam_tracking.confidence  = sam_msg.confidence;
+      ctx->sam_tracking.mask_width  = sam_msg.mask_width;
+      ctx->sam_tracking.mask_height = sam_msg.mask_height;
+      ctx->sam_tracking.mask_pixels = sam_msg.mask_pixels;
+      ctx->sam_tracking.kf_predicted_x
+        = sam_msg.has_kalman ? (float)sam_msg.kalman.predicted_x : 0.0f;
+      ctx->sam_tracking.kf_predicted_y
+        = sam_msg.has_kalman ? (float)sam_msg.kalman.predicted_y : 0.0f;
+      ctx->sam_tracking.lost_frame_count = sam_msg.lost_frame_count;
+      ctx->sam_tracking.valid            = true;
+
+      if (sam_should_log)
         {
-          LOG_WARN("Failed to decode SamTrackingHeat payload");
+          LOG_WARN("[sam-debug] HEAT: status=%d state=%d conf=%.2f "
+                   "box=(%.3f,%.3f)-(%.3f,%.3f)",
+                   ctx->sam_tracking.status, ctx->sam_tracking.state,
+                   ctx->sam_tracking.confidence, ctx->sam_tracking.bbox_x1,
+                   ctx->sam_tracking.bbox_y1, ctx->sam_tracking.bbox_x2,
+                   ctx->sam_tracking.bbox_y2);
         }
-#endif
     }
+  else
+    {
+      LOG_WARN("Failed to decode SamTrackingHeat payload");
+    }
+#endif
+}
 
-  return true;
+// Per-frame payloads are dropped when a state arrives without them;
+// client metadata is kept until replaced
+
+static void
+reset_cv_meta_payload(osd_context_t *ctx)
+{
+  ctx->cv_meta.sharpness_valid = false;
+}
+
+static void
+reset_detections_payload(osd_context_t *ctx)
+{
+  ctx->detections.valid = false;
+}
+
+static void
+reset_sam_tracking_payload(osd_context_t *ctx)
+{
+  ctx->sam_tracking.valid = false;
 }
 
 // ════════════════════════════════════════════════════════════
-// PROTOCOL BUFFER DECODING
+// OPAQUE PAYLOAD REGISTRY
 // ════════════════════════════════════════════════════════════
+//
+// Payload decoders keyed by binary type UUID. UUID strings are parsed once
+// at init into an open-addressed table; incoming type_uuid fields are
+// parsed to 16 bytes and looked up by hash, no string compares.
+//
+// To support a new payload type, add one line to g_opaque_decoder_defs.
 
-bool
-decode_proto_state(osd_context_t *ctx, ser_JonGUIState *pb_state)
-{
-  if (!ctx->proto_valid || ctx->proto_size == 0)
-    {
-      return false;
-    }
+typedef void (*opaque_decode_fn)(osd_context_t *ctx, pb_istream_t *stream);
+typedef void (*opaque_reset_fn)(osd_context_t *ctx);
 
-  // Reset per-frame CV data (will be repopulated if payloads are present)
-  ctx->cv_meta.sharpness_valid = false;
-  ctx->detections.valid        = false;
-  ctx->sam_tracking.valid      = false;
+typedef struct
+{
+  const char *uuid; // Canonical 8-4-4-4-12 hex form
+  const char *name; // For logs
+  opaque_decode_fn decode;
+  opaque_reset_fn reset; // Clears per-frame data (NULL = retained)
+} opaque_decoder_def_t;
+
+static const opaque_decoder_def_t g_opaque_decoder_defs[] = {
+  { OSD_CLIENT_METADATA_UUID, "OsdClientMetadata",
+    decode_client_metadata_payload, NULL },
+  { CV_META_UUID, "CvMeta", decode_cv_meta_payload, reset_cv_meta_payload },
+#ifdef OSD_STREAM_DAY
+  { OBJECT_DETECTIONS_DAY_UUID, "ObjectDetectionsDay",
+    decode_detections_payload, reset_detections_payload },
+  { SAM_TRACKING_DAY_UUID, "SamTrackingDay", decode_sam_tracking_payload,
+    reset_sam_tracking_payload },
+#endif
+#ifdef OSD_STREAM_THERMAL
+  { OBJECT_DETECTIONS_HEAT_UUID, "ObjectDetectionsHeat",
+    decode_detections_payload, reset_detections_payload },
+  { SAM_TRACKING_HEAT_UUID, "SamTrackingHeat", decode_sam_tracking_payload,
+    reset_sam_tracking_payload },
+#endif
+};
 
-  // Wire up callback for opaque_payloads to extract opaque payloads
-  pb_state->opaque_payloads.funcs.decode = opaque_payloads_decode_callback;
-  pb_state->opaque_payloads.arg          = ctx;
+#define OPAQUE_DECODER_COUNT                                                   \
+  (sizeof(g_opaque_decoder_defs) / sizeof(g_opaque_decoder_defs[0]))
 
-  pb_istream_t stream
-    = pb_istream_from_buffer(ctx->proto_buffer, ctx->proto_size);
-  bool status = pb_decode(&stream, ser_JonGUIState_fields, pb_state);
+// Table size: power of two, at least twice the decoder count
+#define OPAQUE_REGISTRY_SLOTS 16
+_Static_assert(OPAQUE_DECODER_COUNT * 2 <= OPAQUE_REGISTRY_SLOTS,
+               "grow OPAQUE_REGISTRY_SLOTS");
 
-  if (!status)
-    {
-      LOG_ERROR("Proto decode failed: %s", PB_GET_ERROR(&stream));
-      return false;
-    }
+#define OPAQUE_UUID_TEXT_LEN 36
 
-  return true;
-}
+typedef struct
+{
+  uint64_t hi, lo; // UUID bytes 0-7 and 8-15, big-endian
+} opaque_uuid_t;
 
-// ════════════════════════════════════════════════════════════
-// EXPORTED WASM FUNCTIONS
-// ════════════════════════════════════════════════════════════
+typedef struct
+{
+  opaque_uuid_t uuid;
+  const opaque_decoder_def_t *def; // NULL = empty slot
+} opaque_registry_slot_t;
 
-// Forward declare WASI libc initialization function
-extern void __wasm_call_ctors(void);
+static opaque_registry_slot_t g_opaque_registry[OPAQUE_REGISTRY_SLOTS];
 
-// WASI Reactor Pattern: _initialize() is called by WASI runtime before any
-// other functions This ensures libpreopen and WASI filesystem initialization
-// happens even with -nostartfiles
-__attribute__((export_name("_initialize"))) void
-_initialize(void)
+// Retained state of one payload type (indexed like g_opaque_decoder_defs).
+// While a channel is fed by wasm_osd_update_payload(), copies embedded in
+// JonGUIState updates are skipped.
+typedef struct
 {
-  // WASI runtime calls this to initialize the module
-  // This is critical for file access - it sets up preopened directories
+  bool direct;         // Fed by wasm_osd_update_payload() (until it expires)
+  uint64_t updated_us; // Monotonic time of the last decode (0 = never)
+  uint32_t updates;    // Payloads decoded so far
+} opaque_channel_t;
 
-  // Call WASI libc constructors which initializes:
-  // - __wasilibc_populate_preopens() - sets up preopened directory FD table
-  // - __wasilibc_initialize_environ_eagerly() - environment variables
-  __wasm_call_ctors();
-}
+static opaque_channel_t g_opaque_channels[OPAQUE_DECODER_COUNT];
 
-// Get variant-specific config path based on compile-time defines
-static const char *
-get_config_path(void)
+// Directly fed per-frame payloads older than this are dropped
+#define OPAQUE_CHANNEL_TIMEOUT_US 1000000
+
+static int
+hex_digit_value(char c)
 {
-#if defined(OSD_MODE_LIVE) && defined(OSD_STREAM_DAY)
-  return "build/resources/live_day_config.json";
-#elif defined(OSD_MODE_LIVE) && defined(OSD_STREAM_THERMAL)
-  return "build/resources/live_thermal_config.json";
-#elif defined(OSD_MODE_RECORDING) && defined(OSD_STREAM_DAY)
-  return "build/resources/recording_day_config.json";
-#elif defined(OSD_MODE_RECORDING) && defined(OSD_STREAM_THERMAL)
-  return "build/resources/recording_thermal_config.json";
-#else
-  return "build/resources/config.json"; // Fallback
-#endif
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
 }
 
 /**
- * Initialize OSD system
- *
- * Initializes the OSD context, loads configuration, fonts, and resources.
- * Must be called before any other OSD functions.
+ * Parse a canonical UUID string (8-4-4-4-12 hex digits)
+ *
+ * @param text Exactly OPAQUE_UUID_TEXT_LEN characters (not NUL-terminated)
+ * @param out  Parsed UUID
+ * @return false if the text is not a canonical UUID
+ */
+static bool
+opaque_uuid_parse(const char *text, opaque_uuid_t *out)
+{
+  uint64_t words[2] = { 0, 0 };
+  int nibbles       = 0;
+
+  for (int i = 0; i < OPAQUE_UUID_TEXT_LEN; i++)
+    {
+      if (i == 8 || i == 13 || i == 18 || i == 23)
+        {
+          if (text[i] != '-')
+            return false;
+          continue;
+        }
+
+      int v = hex_digit_value(text[i]);
+      if (v < 0)
+        return false;
+
+      words[nibbles / 16] = (words[nibbles / 16] << 4) | (uint64_t)v;
+      nibbles++;
+    }
+
+  out->hi = words[0];
+  out->lo = words[1];
+  return true;
+}
+
+static uint32_t
+opaque_uuid_slot(const opaque_uuid_t *uuid)
+{
+  // UUIDv7 puts the timestamp in hi and random bits in lo; mix both
+  uint64_t h = (uuid->hi ^ (uuid->lo * UINT64_C(0x9e3779b97f4a7c15)))
+               * UINT64_C(0xff51afd7ed558ccd);
+  return (uint32_t)(h >> 32) & (OPAQUE_REGISTRY_SLOTS - 1);
+}
+
+/**
+ * Build the UUID lookup table from g_opaque_decoder_defs
+ *
+ * @return false if a registered UUID is malformed or registered twice
+ */
+static bool
+opaque_registry_init(void)
+{
+  memset(g_opaque_registry, 0, sizeof(g_opaque_registry));
+  memset(g_opaque_channels, 0, sizeof(g_opaque_channels));
+
+  for (size_t i = 0; i < OPAQUE_DECODER_COUNT; i++)
+    {
+      const opaque_decoder_def_t *def = &g_opaque_decoder_defs[i];
+      opaque_uuid_t uuid;
+
+      if (strlen(def->uuid) != OPAQUE_UUID_TEXT_LEN
+          || !opaque_uuid_parse(def->uuid, &uuid))
+        {
+          LOG_ERROR("Malformed opaque payload UUID for %s: %s", def->name,
+                    def->uuid);
+          return false;
+        }
+
+      uint32_t slot = opaque_uuid_slot(&uuid);
+      while (g_opaque_registry[slot].def)
+        {
+          if (g_opaque_registry[slot].uuid.hi == uuid.hi
+              && g_opaque_registry[slot].uuid.lo == uuid.lo)
+            {
+              LOG_ERROR("Duplicate opaque payload UUID: %s", def->uuid);
+              return false;
+            }
+          slot = (slot + 1) & (OPAQUE_REGISTRY_SLOTS - 1);
+        }
+
+      g_opaque_registry[slot].uuid = uuid;
+      g_opaque_registry[slot].def  = def;
+    }
+
+  return true;
+}
+
+// Find the decoder registered for uuid (NULL if none)
+static const opaque_decoder_def_t *
+opaque_registry_find(const opaque_uuid_t *uuid)
+{
+  uint32_t slot = opaque_uuid_slot(uuid);
+
+  while (g_opaque_registry[slot].def)
+    {
+      if (g_opaque_registry[slot].uuid.hi == uuid->hi
+          && g_opaque_registry[slot].uuid.lo == uuid->lo)
+        {
+          return g_opaque_registry[slot].def;
+        }
+      slot = (slot + 1) & (OPAQUE_REGISTRY_SLOTS - 1);
+    }
+
+  return NULL;
+}
+
+static opaque_channel_t *
+opaque_channel_of(const opaque_decoder_def_t *def)
+{
+  return &g_opaque_channels[def - g_opaque_decoder_defs];
+}
+
+// Decode one payload into the context and stamp its channel
+static void
+opaque_channel_decode(osd_context_t *ctx,
+                      const opaque_decoder_def_t *def,
+                      pb_istream_t *stream)
+{
+  opaque_channel_t *channel = opaque_channel_of(def);
+
+  def->decode(ctx, stream);
+  channel->updated_us = monotonic_us();
+  channel->updates++;
+}
+
+// Expire directly fed channels whose producer stopped: data older than
+// OPAQUE_CHANNEL_TIMEOUT_US is dropped, so its last overlay does not stay
+// on screen, and the channel goes back to embedded copies.
+//
+// Returns true if any channel's data was dropped
+static bool
+opaque_channels_expire(osd_context_t *ctx)
+{
+  uint64_t now = monotonic_us();
+  bool expired = false;
+
+  for (size_t i = 0; i < OPAQUE_DECODER_COUNT; i++)
+    {
+      opaque_channel_t *channel = &g_opaque_channels[i];
+
+      if (!channel->direct
+          || now - channel->updated_us <= OPAQUE_CHANNEL_TIMEOUT_US)
+        {
+          continue;
+        }
+
+      channel->direct = false;
+      if (g_opaque_decoder_defs[i].reset)
+        {
+          g_opaque_decoder_defs[i].reset(ctx);
+          expired = true;
+        }
+    }
+
+  return expired;
+}
+
+// Drop per-frame payload data before a state's embedded payloads are read.
+// Directly fed channels keep theirs until it expires.
+static void
+opaque_channels_begin_state(osd_context_t *ctx)
+{
+  opaque_channels_expire(ctx);
+
+  for (size_t i = 0; i < OPAQUE_DECODER_COUNT; i++)
+    {
+      if (!g_opaque_channels[i].direct && g_opaque_decoder_defs[i].reset)
+        {
+          g_opaque_decoder_defs[i].reset(ctx);
+        }
+    }
+}
+
+// ════════════════════════════════════════════════════════════
+// OPAQUE PAYLOAD PARSING
+// ════════════════════════════════════════════════════════════
+
+// Callback context for one JonOpaquePayload
+typedef struct
+{
+  osd_context_t *ctx;
+  const opaque_decoder_def_t *decoder; // Set once type_uuid is seen
+  bool uuid_seen;
+  bool payload_seen;
+  char uuid_text[OPAQUE_UUID_TEXT_LEN + 1]; // For logging unknown types
+} opaque_payload_ctx_t;
+
+// Callback for type_uuid string field in JonOpaquePayload
+static bool
+opaque_uuid_decode_callback(pb_istream_t *stream,
+                            const pb_field_t *field,
+                            void **arg)
+{
+  opaque_payload_ctx_t *cb_ctx = (opaque_payload_ctx_t *)*arg;
+  (void)field; // unused
+
+  cb_ctx->uuid_seen    = true;
+  cb_ctx->decoder      = NULL;
+  cb_ctx->uuid_text[0] = '\0';
+
+  // Anything but the canonical 36-character form is an unknown type
+  if (stream->bytes_left != OPAQUE_UUID_TEXT_LEN)
+    {
+      return pb_read(stream, NULL, stream->bytes_left);
+    }
+
+  if (!pb_read(stream, (pb_byte_t *)cb_ctx->uuid_text, OPAQUE_UUID_TEXT_LEN))
+    {
+      return false;
+    }
+  cb_ctx->uuid_text[OPAQUE_UUID_TEXT_LEN] = '\0';
+
+  opaque_uuid_t uuid;
+  if (opaque_uuid_parse(cb_ctx->uuid_text, &uuid))
+    {
+      cb_ctx->decoder = opaque_registry_find(&uuid);
+    }
+
+  return true;
+}
+
+// Callback for payload bytes field in JonOpaquePayload
+//
+// Decodes in place from the field's sub-stream. Encoders write fields in
+// tag order, so type_uuid (tag 1) has been seen by now; a payload that
+// arrives first cannot be dispatched and is skipped.
+static bool
+opaque_payload_decode_callback(pb_istream_t *stream,
+                               const pb_field_t *field,
+                               void **arg)
+{
+  opaque_payload_ctx_t *cb_ctx = (opaque_payload_ctx_t *)*arg;
+  (void)field; // unused
+
+  cb_ctx->payload_seen = true;
+
+  // Channels fed through wasm_osd_update_payload() ignore embedded copies
+  if (cb_ctx->decoder && stream->bytes_left > 0
+      && !opaque_channel_of(cb_ctx->decoder)->direct)
+    {
+      opaque_channel_decode(cb_ctx->ctx, cb_ctx->decoder, stream);
+    }
+
+  // Skip unknown payloads and whatever a failed decode left behind
+  return pb_read(stream, NULL, stream->bytes_left);
+}
+
+// Callback for opaque_payloads repeated field in JonGUIState
+static bool
+opaque_payloads_decode_callback(pb_istream_t *stream,
+                                const pb_field_t *field,
+                                void **arg)
+{
+  osd_context_t *ctx = (osd_context_t *)*arg;
+  (void)field; // unused
+
+  // Set up context for nested callbacks
+  opaque_payload_ctx_t cb_ctx = { 0 };
+  cb_ctx.ctx                  = ctx;
+
+  // Set up JonOpaquePayload with callbacks for its fields
+  ser_JonOpaquePayload opaque_payload   = ser_JonOpaquePayload_init_zero;
+  opaque_payload.type_uuid.funcs.decode = opaque_uuid_decode_callback;
+  opaque_payload.type_uuid.arg          = &cb_ctx;
+  opaque_payload.payload.funcs.decode   = opaque_payload_decode_callback;
+  opaque_payload.payload.arg            = &cb_ctx;
+
+  // Decode the JonOpaquePayload submessage (payload decoded in its callback)
+  if (!pbfast_decode_ser_JonOpaquePayload(stream, &opaque_payload,
+                                          PBFAST_ALL_FIELDS))
+    {
+      LOG_WARN("Failed to decode opaque payload");
+      return false;
+    }
+
+  // Rate-limited log for unmatched UUIDs
+  if (cb_ctx.payload_seen && !cb_ctx.decoder)
+    {
+      static int unmatched_log_counter = 0;
+      if (unmatched_log_counter++ % 300 == 0)
+        {
+          LOG_WARN("[det-debug] Unmatched opaque UUID: %s%s",
+                   cb_ctx.uuid_text,
+                   cb_ctx.uuid_seen ? "" : "(payload before type_uuid)");
+        }
+    }
+
+  return true;
+}
+
+// ════════════════════════════════════════════════════════════
+// PROTOCOL BUFFER DECODING
+// ════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────
+// Selective decoding
+// ────────────────────────────────────────────────────────────
+//
+// Widgets read only a few JonGUIState submessages. The field mask (bit n =
+// top-level tag n) is derived from the enabled widgets at init; fields
+// outside it are skipped by tag without decoding their contents.
+
+// Top-level scalars (timestamps, protocol version). Only widgets that show
+// state timing read them; they change on every update, so leaving them out
+// otherwise keeps the change bitmap quiet for static scenes.
+#define PROTO_FIELDS_SCALARS                                                   \
+  (OSD_STATE_FIELD(ser_JonGUIState_protocol_version_tag)                       \
+   | OSD_STATE_FIELD(ser_JonGUIState_system_monotonic_time_us_tag)             \
+   | OSD_STATE_FIELD(ser_JonGUIState_state_source_tag)                         \
+   | OSD_STATE_FIELD(ser_JonGUIState_frame_pts_day_ns_tag)                     \
+   | OSD_STATE_FIELD(ser_JonGUIState_frame_pts_heat_ns_tag)                    \
+   | OSD_STATE_FIELD(ser_JonGUIState_frame_monotonic_day_us_tag)               \
+   | OSD_STATE_FIELD(ser_JonGUIState_frame_monotonic_heat_us_tag))
+
+/**
+ * Derive the JonGUIState field mask from enabled widgets
+ *
+ * Must be kept in sync with what each widget reads (directly or through
+ * osd_state.h accessors).
+ *
+ * @param config  Loaded OSD configuration
+ * @param widgets Bit (1 << WASM_OSD_WIDGET_*) per widget to include;
+ *                UINT32_MAX for all
+ * @return Bit mask of top-level tags to decode
+ */
+static uint32_t
+proto_field_mask_from_config(const osd_config_t *config, uint32_t widgets)
+{
+  uint32_t mask = 0;
+
+#define WIDGET_ON(name, index)                                              \
+  (config->name.enabled && (widgets & (1u << WASM_OSD_WIDGET_##index)))
+
+  // Crosshair: aim offset from rec_osd
+  if (WIDGET_ON(crosshair, CROSSHAIR))
+    mask |= OSD_STATE_FIELD(ser_JonGUIState_rec_osd_tag);
+
+  // Speed indicators: rotary speeds (drawn by the crosshair widget)
+  if (WIDGET_ON(crosshair, CROSSHAIR) && config->speed_indicators.enabled)
+    mask |= OSD_STATE_FIELD(ser_JonGUIState_rotary_tag);
+
+  if (WIDGET_ON(timestamp, TIMESTAMP))
+    mask |= OSD_STATE_FIELD(ser_JonGUIState_time_tag);
+
+  // Nav ball + celestial indicators: orientation, GPS and time
+  if (WIDGET_ON(navball, NAVBALL))
+    mask |= OSD_STATE_FIELD(ser_JonGUIState_actual_space_time_tag);
+
+  // Variant info: state timing, rotary speeds, day camera, client metadata
+  // + sharpness
+  if (WIDGET_ON(variant_info, VARIANT_INFO))
+    mask |= PROTO_FIELDS_SCALARS | OSD_STATE_FIELD(ser_JonGUIState_rotary_tag)
+            | OSD_STATE_FIELD(ser_JonGUIState_camera_day_tag)
+            | OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag);
+
+  // CV widgets: data arrives in opaque payloads
+  if (WIDGET_ON(sharpness_heatmap, SHARPNESS_HEATMAP)
+      || WIDGET_ON(detections, DETECTIONS) || WIDGET_ON(sam_mask, SAM_MASK)
+      || WIDGET_ON(autofocus_debug, AUTOFOCUS_DEBUG))
+    mask |= OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag);
+
+  // Autofocus debug: day camera + state time for the sharpness history
+  if (WIDGET_ON(autofocus_debug, AUTOFOCUS_DEBUG))
+    mask |= PROTO_FIELDS_SCALARS
+            | OSD_STATE_FIELD(ser_JonGUIState_camera_day_tag);
+
+  // ROI overlays: CV submessage
+  if (WIDGET_ON(roi, ROI))
+    mask |= OSD_STATE_FIELD(ser_JonGUIState_cv_tag);
+
+#undef WIDGET_ON
+  return mask;
+}
+
+/**
+ * Decode the given top-level fields of the current proto input
+ *
+ * Only fields also in ctx->proto_field_mask are decoded. Payload-derived
+ * context data is reset (and repopulated) only when opaque_payloads is
+ * among them, so delta updates without payloads keep the last ones.
+ */
+static bool
+decode_state_fields(osd_context_t *ctx,
+                    ser_JonGUIState *pb_state,
+                    uint32_t fields)
+{
+  // An empty delta is valid: it resets the fields it lists
+  if (!ctx->proto_valid || (ctx->proto_size == 0 && fields == UINT32_MAX))
+    {
+      return false;
+    }
+
+  uint32_t mask = ctx->proto_field_mask & fields;
+
+  // Reset per-frame CV data (will be repopulated if payloads are present)
+  if (mask & OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag))
+    {
+      opaque_channels_begin_state(ctx);
+    }
+
+  // Wire up callback for opaque_payloads to extract opaque payloads
+  pb_state->opaque_payloads.funcs.decode = opaque_payloads_decode_callback;
+  pb_state->opaque_payloads.arg          = ctx;
+
+  // Generated decoder (src/proto/pb_fastdec.c): unselected fields are
+  // skipped in the same pass, so no separate scan is needed
+  pb_istream_t stream = pb_istream_from_buffer(ctx->proto_data,
+                                               ctx->proto_size);
+  if (!pbfast_decode_ser_JonGUIState(&stream, pb_state, mask))
+    {
+      LOG_ERROR("Proto decode failed: %s", PB_GET_ERROR(&stream));
+      return false;
+    }
+  return true;
+}
+
+bool
+decode_proto_state(osd_context_t *ctx, ser_JonGUIState *pb_state)
+{
+  return decode_state_fields(ctx, pb_state, UINT32_MAX);
+}
+
+// ────────────────────────────────────────────────────────────
+// Decode-once state pipeline
+// ────────────────────────────────────────────────────────────
+//
+// Each state update is decoded once into the back state slot, diffed
+// against the front slot and swapped in. The differences accumulate in
+// ctx->state_changed until the next frame starts, which uses the front slot
+// as-is.
+
+/**
+ * Hash all context data filled from opaque payloads
+ *
+ * Only the used part of the SAM RLE buffer is included.
+ */
+static uint64_t
+hash_payload_state(const osd_context_t *ctx)
+{
+  uint64_t h = HASH_FNV1A_INIT;
+
+  h = hash_fnv1a(h, &ctx->client_metadata, sizeof(ctx->client_metadata));
+  h = hash_fnv1a(h, &ctx->cv_meta, sizeof(ctx->cv_meta));
+  h = hash_fnv1a(h, &ctx->detections, sizeof(ctx->detections));
+
+  // SAM: scalars before the RLE buffer, RLE bytes, scalars after it
+  const size_t sam_base = offsetof(osd_context_t, sam_tracking);
+  const size_t sam_head
+    = offsetof(osd_context_t, sam_tracking.mask_rle) - sam_base;
+  const size_t sam_tail
+    = offsetof(osd_context_t, sam_tracking.mask_width) - sam_base;
+  const uint8_t *sam = (const uint8_t *)&ctx->sam_tracking;
+
+  h = hash_fnv1a(h, sam, sam_head);
+  h = hash_fnv1a(h, ctx->sam_tracking.mask_rle, ctx->sam_tracking.mask_rle_len);
+  h = hash_fnv1a(h, &ctx->sam_tracking.mask_rle_len,
+                 sizeof(ctx->sam_tracking.mask_rle_len));
+  h = hash_fnv1a(h, sam + sam_tail, sizeof(ctx->sam_tracking) - sam_tail);
+  return h;
+}
+
+/**
+ * Compare two decoded states field by field
+ *
+ * Walks the nanopb field descriptors so new JonGUIState fields are covered
+ * without changes here. States must be zero-filled before decoding so
+ * padding compares equal. Callback fields (opaque_payloads) are skipped.
+ *
+ * @return OSD_STATE_FIELD bits of fields in mask that differ
+ */
+static uint32_t
+diff_proto_states(const ser_JonGUIState *prev,
+                  const ser_JonGUIState *next,
+                  uint32_t mask)
+{
+  pb_field_iter_t a, b;
+  uint32_t changed = 0;
+
+  if (!pb_field_iter_begin_const(&a, ser_JonGUIState_fields, prev)
+      || !pb_field_iter_begin_const(&b, ser_JonGUIState_fields, next))
+    {
+      return mask;
+    }
+
+  do
+    {
+      if (a.tag >= 32 || !(mask & OSD_STATE_FIELD(a.tag))
+          || PB_ATYPE(a.type) != PB_ATYPE_STATIC)
+        {
+          continue;
+        }
+
+      bool differs = false;
+      if (PB_HTYPE(a.type) == PB_HTYPE_OPTIONAL && a.pSize)
+        {
+          differs = *(const bool *)a.pSize != *(const bool *)b.pSize;
+        }
+
+      size_t size = a.data_size;
+      if (PB_HTYPE(a.type) == PB_HTYPE_REPEATED)
+        {
+          size *= a.array_size;
+        }
+
+      if (differs || memcmp(a.pData, b.pData, size) != 0)
+        {
+          changed |= OSD_STATE_FIELD(a.tag);
+        }
+    }
+  while (pb_field_iter_next(&a) && pb_field_iter_next(&b));
+
+  return changed;
+}
+
+/**
+ * Hash the given fields of a decoded state
+ *
+ * Covers the same bytes diff_proto_states() compares, so states it finds
+ * equal on mask hash equal.
+ */
+static uint64_t
+hash_proto_state(uint64_t h, const ser_JonGUIState *state, uint32_t mask)
+{
+  pb_field_iter_t it;
+
+  if (!pb_field_iter_begin_const(&it, ser_JonGUIState_fields, state))
+    {
+      return h;
+    }
+
+  do
+    {
+      if (it.tag >= 32 || !(mask & OSD_STATE_FIELD(it.tag))
+          || PB_ATYPE(it.type) != PB_ATYPE_STATIC)
+        {
+          continue;
+        }
+
+      if (PB_HTYPE(it.type) == PB_HTYPE_OPTIONAL && it.pSize)
+        {
+          h = hash_fnv1a(h, it.pSize, sizeof(bool));
+        }
+
+      size_t size = it.data_size;
+      if (PB_HTYPE(it.type) == PB_HTYPE_REPEATED)
+        {
+          size *= it.array_size;
+        }
+      h = hash_fnv1a(h, it.pData, size);
+    }
+  while (pb_field_iter_next(&it));
+
+  return h;
+}
+
+/**
+ * Reset the given top-level fields of a decoded state to their defaults
+ *
+ * Used before merging a delta: a field listed in the delta but absent from
+ * its bytes (proto3 omits default values) ends up at its default.
+ */
+static void
+clear_state_fields(ser_JonGUIState *state, uint32_t fields)
+{
+  pb_field_iter_t it;
+
+  if (!pb_field_iter_begin(&it, ser_JonGUIState_fields, state))
+    {
+      return;
+    }
+
+  do
+    {
+      if (it.tag >= 32 || !(fields & OSD_STATE_FIELD(it.tag))
+          || PB_ATYPE(it.type) != PB_ATYPE_STATIC)
+        {
+          continue;
+        }
+
+      size_t size = it.data_size;
+      if (PB_HTYPE(it.type) == PB_HTYPE_REPEATED)
+        {
+          size *= it.array_size;
+          *(pb_size_t *)it.pSize = 0;
+        }
+      else if (PB_HTYPE(it.type) == PB_HTYPE_OPTIONAL && it.pSize)
+        {
+          *(bool *)it.pSize = false;
+        }
+      memset(it.pData, 0, size);
+    }
+  while (pb_field_iter_next(&it));
+}
+
+/**
+ * Decode the current proto input into the back slot and swap
+ *
+ * A full update (fields == UINT32_MAX) decodes into a zeroed slot. A delta
+ * starts from a copy of the front slot, resets the listed fields and
+ * decodes only those on top, so unlisted fields keep their last values.
+ *
+ * On failure ctx->proto_valid is cleared and widgets render without
+ * state, as before the first update.
+ *
+ * @param fields OSD_STATE_FIELD bits replaced by this update
+ * @return Changed-field bits; all bits when there is no previous state to
+ *         compare against or decoding failed
+ */
+static uint32_t
+ingest_proto_state(osd_context_t *ctx, uint32_t fields)
+{
+  int back              = g_pb_front ^ 1;
+  ser_JonGUIState *next = &g_pb_states[back];
+
+  if (fields == UINT32_MAX || !g_pb_front_valid)
+    {
+      // Zero-fill (not just init_zero) so states compare bytewise
+      memset(next, 0, sizeof(*next));
+    }
+  else
+    {
+      *next = g_pb_states[g_pb_front];
+      clear_state_fields(next, fields);
+    }
+
+  if (!decode_state_fields(ctx, next, fields))
+    {
+      ctx->proto_valid = false;
+      g_pb_front_valid = false;
+      return UINT32_MAX;
+    }
+
+  uint32_t changed = UINT32_MAX;
+  if (g_pb_front_valid)
+    {
+      changed = diff_proto_states(&g_pb_states[g_pb_front], next,
+                                  ctx->proto_field_mask);
+    }
+
+  if (ctx->proto_field_mask & fields
+      & OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag))
+    {
+      uint64_t payload_hash = hash_payload_state(ctx);
+      if (payload_hash != g_payload_hash)
+        {
+          changed |= OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag);
+          g_payload_hash = payload_hash;
+        }
+    }
+
+  g_pb_front       = back;
+  g_pb_front_valid = true;
+  state_history_push(&g_state_history, next);
+  return changed;
+}
+
+// ════════════════════════════════════════════════════════════
+// EXPORTED WASM FUNCTIONS
+// ════════════════════════════════════════════════════════════
+
+// Forward declare WASI libc initialization function
+extern void __wasm_call_ctors(void);
+
+// WASI Reactor Pattern: _initialize() is called by WASI runtime before any
+// other functions This ensures libpreopen and WASI filesystem initialization
+// happens even with -nostartfiles
+__attribute__((export_name("_initialize"))) void
+_initialize(void)
+{
+  // WASI runtime calls this to initialize the module
+  // This is critical for file access - it sets up preopened directories
+
+  // Call WASI libc constructors which initializes:
+  // - __wasilibc_populate_preopens() - sets up preopened directory FD table
+  // - __wasilibc_initialize_environ_eagerly() - environment variables
+  __wasm_call_ctors();
+}
+
+// Get variant-specific config path based on compile-time defines
+static const char *
+get_config_path(void)
+{
+#if defined(OSD_MODE_LIVE) && defined(OSD_STREAM_DAY)
+  return "build/resources/live_day_config.json";
+#elif defined(OSD_MODE_LIVE) && defined(OSD_STREAM_THERMAL)
+  return "build/resources/live_thermal_config.json";
+#elif defined(OSD_MODE_RECORDING) && defined(OSD_STREAM_DAY)
+  return "build/resources/recording_day_config.json";
+#elif defined(OSD_MODE_RECORDING) && defined(OSD_STREAM_THERMAL)
+  return "build/resources/recording_thermal_config.json";
+#else
+  return "build/resources/config.json"; // Fallback
+#endif
+}
+
+/**
+ * Initialize OSD system
+ *
+ * Initializes the OSD context, loads configuration, fonts, and resources.
+ * Must be called before any other OSD functions.
  *
  * @return 0 on success, -1 on error
  */
 __attribute__((visibility("default"))) int
-wasm_osd_init(void)
+wasm_osd_init(void)
+{
+  LOG_FUNC_INFO("Initializing OSD");
+
+  // Initialize context with compile-time resolution
+  g_osd_ctx.framebuffer  = g_framebuffer;
+  g_osd_ctx.width        = CURRENT_FRAMEBUFFER_WIDTH;
+  g_osd_ctx.height       = CURRENT_FRAMEBUFFER_HEIGHT;
+  g_osd_ctx.needs_render = true;
+  g_osd_ctx.frame_count  = 0;
+
+  // Load variant-specific configuration
+  const char *config_path = get_config_path();
+  LOG_INFO("Loading config from: %s", config_path);
+  if (!load_config_xml(&g_osd_ctx, config_path))
+    {
+      LOG_ERROR("Failed to load config");
+      return -1;
+    }
+
+  // Load per-widget fonts
+  // Each text-rendering widget has its own font for flexibility
+  if (g_osd_ctx.config.timestamp.font_path[0])
+    {
+      LOG_INFO("Loading timestamp font: %s",
+               g_osd_ctx.config.timestamp.font_path);
+      if (!font_load(&g_osd_ctx.font_timestamp,
+                     g_osd_ctx.config.timestamp.font_path))
+        {
+          LOG_ERROR("Timestamp font loading FAILED");
+          return -1;
+        }
+    }
+  else
+    {
+      LOG_ERROR("No timestamp font configured");
+      return -1;
+    }
+
+  if (g_osd_ctx.config.speed_indicators.font_path[0])
+    {
+      LOG_INFO("Loading speed indicators font: %s",
+               g_osd_ctx.config.speed_indicators.font_path);
+      if (!font_load(&g_osd_ctx.font_speed_indicators,
+                     g_osd_ctx.config.speed_indicators.font_path))
+        {
+          LOG_ERROR("Speed indicators font loading FAILED");
+          return -1;
+        }
+    }
+  else
+    {
+      LOG_ERROR("No speed indicators font configured");
+      return -1;
+    }
+
+  if (g_osd_ctx.config.variant_info.font_path[0])
+    {
+      LOG_INFO("Loading variant info font: %s",
+               g_osd_ctx.config.variant_info.font_path);
+      if (!font_load(&g_osd_ctx.font_variant_info,
+                     g_osd_ctx.config.variant_info.font_path))
+        {
+          LOG_ERROR("Variant info font loading FAILED");
+          return -1;
+        }
+    }
+  else
+    {
+      LOG_ERROR("No variant info font configured");
+      return -1;
+    }
+
+  LOG_INFO("All fonts loaded successfully");
+
+  // Copy celestial indicators configuration to context
+  g_osd_ctx.celestial_enabled  = g_osd_ctx.config.celestial_indicators.enabled;
+  g_osd_ctx.celestial_show_sun = g_osd_ctx.config.celestial_indicators.show_sun;
+  g_osd_ctx.celestial_show_moon
+    = g_osd_ctx.config.celestial_indicators.show_moon;
+  g_osd_ctx.celestial_indicator_scale
+    = g_osd_ctx.config.celestial_indicators.indicator_scale;
+  g_osd_ctx.celestial_visibility_threshold
+    = g_osd_ctx.config.celestial_indicators.visibility_threshold;
+
+  // Initialize nav ball widget (REQUIRED - fail if initialization fails)
+  // Note: navball_init() will load celestial SVGs if celestial_enabled is true
+  LOG_INFO("Initializing nav ball widget...");
+  if (!navball_init(&g_osd_ctx, &g_osd_ctx.config.navball))
+    {
+      LOG_ERROR("Nav ball initialization FAILED");
+      return -1;
+    }
+  LOG_INFO("Nav ball initialized successfully");
+
+  // Initialize proto input
+  grow_buffer_init(&g_osd_ctx.proto_input, g_state_inline,
+                   sizeof(g_state_inline), OSD_STATE_MAX_SIZE);
+  grow_buffer_init(&g_osd_ctx.sam_rle_input, g_sam_rle_inline,
+                   sizeof(g_sam_rle_inline), OSD_SAM_MAX_RLE_SIZE);
+  g_osd_ctx.proto_data    = NULL;
+  g_osd_ctx.proto_size    = 0;
+  g_osd_ctx.proto_valid   = false;
+  g_osd_ctx.state_changed = 0;
+  g_osd_ctx.frame_changed = 0;
+  g_pb_front_valid        = false;
+  g_state_seq_valid       = false;
+  g_payload_hash          = 0;
+  g_display_valid         = false;
+  g_step_active           = false;
+  g_frame_signature_valid = false;
+  g_config_generation++;
+  state_history_reset(&g_state_history);
+
+  // Opaque payload decoders by type UUID
+  if (!opaque_registry_init())
+    {
+      LOG_ERROR("Opaque payload registry initialization FAILED");
+      return -1;
+    }
+
+  // Decode only the JonGUIState submessages enabled widgets read
+  g_osd_ctx.proto_field_mask
+    = proto_field_mask_from_config(&g_osd_ctx.config, UINT32_MAX);
+  LOG_INFO("Proto field mask: 0x%08x", g_osd_ctx.proto_field_mask);
+
+  // Per-widget update rates (max_rate_hz) and layers
+  widget_scheduler_init(&g_osd_ctx);
+
+  // Quality levels traded for render time (render_budget section)
+  render_budget_init(&g_osd_ctx.config.render_budget);
+
+  // Clear framebuffer
+  memset(g_framebuffer, 0, sizeof(g_framebuffer));
+  memset(&g_content_bounds, 0, sizeof(g_content_bounds));
+  g_framebuffer_generation++;
+
+  LOG_INFO("OSD initialized: %dx%d", g_osd_ctx.width, g_osd_ctx.height);
+  return 0;
+}
+
+/**
+ * Decode and publish one state update
+ *
+ * Shared tail of the state update exports. The bytes are decoded in place
+ * and not referenced after this returns.
+ *
+ * @param data       Protobuf bytes
+ * @param state_size Size of protobuf data in bytes
+ * @param fields     OSD_STATE_FIELD bits the update replaces (UINT32_MAX
+ *                   for a full state)
+ * @return 0 on success, -1 on error (invalid size or decode failure)
+ */
+static int
+ingest_state_bytes(const uint8_t *data, uint32_t state_size, uint32_t fields)
+{
+  if (state_size == 0 && fields == UINT32_MAX)
+    {
+      LOG_WARN("Empty state update");
+      return -1;
+    }
+
+  g_osd_ctx.proto_data  = data;
+  g_osd_ctx.proto_size  = state_size;
+  g_osd_ctx.proto_valid = true;
+  g_osd_ctx.frame_count++;
+
+  // Decode once here; wasm_osd_render() uses the decoded front state
+  uint32_t changed = ingest_proto_state(&g_osd_ctx, fields);
+  g_osd_ctx.state_changed |= changed;
+  g_osd_ctx.proto_data = NULL;
+
+  // Variant info shows the update counter, so it needs every update
+  if ((changed & g_osd_ctx.proto_field_mask) != 0
+      || g_osd_ctx.config.variant_info.enabled)
+    {
+      g_osd_ctx.needs_render = true;
+    }
+
+  if ((g_osd_ctx.frame_count % 60) == 0)
+    {
+      uint32_t cache_hits, cache_misses;
+      navball_get_cache_stats(&g_osd_ctx, &cache_hits, &cache_misses);
+      LOG_INFO("State update #%d (proto size=%u bytes, navball cache "
+               "hits=%u misses=%u)",
+               g_osd_ctx.frame_count, state_size, cache_hits, cache_misses);
+    }
+
+  return g_osd_ctx.proto_valid ? 0 : -1;
+}
+
+/**
+ * Get the plugin-owned state input buffer
+ *
+ * Hosts serialize (or copy) the JonGUIState straight into this region and
+ * call wasm_osd_commit_state(), so the bytes are decoded where they were
+ * written. States up to OSD_STATE_INLINE_SIZE use a preallocated block;
+ * larger ones (up to OSD_STATE_MAX_SIZE) move the buffer to the heap, so
+ * an address is valid until the next call. Hosts may keep using it for
+ * states that fit the capacity they asked for.
+ *
+ * @param capacity Number of bytes the host intends to write
+ * @return Pointer to the buffer in WASM memory, or 0 if capacity exceeds
+ *         OSD_STATE_MAX_SIZE or cannot be allocated
+ */
+__attribute__((visibility("default"))) uint32_t
+wasm_osd_get_state_buffer(uint32_t capacity)
+{
+  if (!grow_buffer_reserve(&g_osd_ctx.proto_input, capacity))
+    {
+      LOG_ERROR("State buffer unavailable: %u bytes requested (max %d)",
+                capacity, OSD_STATE_MAX_SIZE);
+      return 0;
+    }
+
+  return (uint32_t)((uintptr_t)g_osd_ctx.proto_input.data);
+}
+
+/**
+ * Decode a state written into the state input buffer
+ *
+ * The next wasm_osd_render() call re-renders only if a field read by an
+ * enabled widget changed (see ctx->state_changed).
+ *
+ * @param state_size Size of protobuf data written at
+ *                   wasm_osd_get_state_buffer()
+ * @return 0 on success, -1 on error (invalid size or decode failure)
+ */
+__attribute__((visibility("default"))) int
+wasm_osd_commit_state(uint32_t state_size)
 {
-  LOG_FUNC_INFO("Initializing OSD");
+  if (state_size > g_osd_ctx.proto_input.capacity)
+    {
+      LOG_ERROR("State larger than its buffer: %u bytes (reserved %zu)",
+                state_size, g_osd_ctx.proto_input.capacity);
+      return -1;
+    }
 
-  // Initialize context with compile-time resolution
-  g_osd_ctx.framebuffer  = g_framebuffer;
-  g_osd_ctx.width        = CURRENT_FRAMEBUFFER_WIDTH;
-  g_osd_ctx.height       = CURRENT_FRAMEBUFFER_HEIGHT;
-  g_osd_ctx.needs_render = true;
-  g_osd_ctx.frame_count  = 0;
+  // Unsequenced full state: later deltas need a new sequenced baseline
+  g_state_seq_valid = false;
+  return ingest_state_bytes(g_osd_ctx.proto_input.data, state_size,
+                            UINT32_MAX);
+}
 
-  // Load variant-specific configuration
-  const char *config_path = get_config_path();
-  LOG_INFO("Loading config from: %s", config_path);
-  if (!load_config_xml(&g_osd_ctx, config_path))
+/**
+ * Apply a sequenced full or delta state written into the state input buffer
+ *
+ * A delta carries only the top-level JonGUIState fields named in `fields`;
+ * each listed field is replaced as a whole (a listed field missing from the
+ * bytes resets to its default) and all others keep their last values.
+ * Deltas apply only on top of update seq - 1, so a lost or reordered
+ * update is detected instead of silently merged.
+ *
+ * @param state_size Size of protobuf data written at
+ *                   wasm_osd_get_state_buffer()
+ * @param fields     OSD_STATE_FIELD bits of the fields carried, or
+ *                   UINT32_MAX for a full state (always accepted)
+ * @param seq        Update sequence number, incremented per update
+ * @return 0 on success, 1 if the host must resend a full state (no
+ *         baseline or sequence gap; nothing was applied), -1 on error
+ *         (invalid size or decode failure; the baseline is dropped)
+ */
+__attribute__((visibility("default"))) int
+wasm_osd_commit_delta(uint32_t state_size, uint32_t fields, uint32_t seq)
+{
+  if (state_size > g_osd_ctx.proto_input.capacity)
     {
-      LOG_ERROR("Failed to load config");
+      LOG_ERROR("State larger than its buffer: %u bytes (reserved %zu)",
+                state_size, g_osd_ctx.proto_input.capacity);
+      g_state_seq_valid = false;
       return -1;
     }
 
-  // Load per-widget fonts
-  // Each text-rendering widget has its own font for flexibility
-  if (g_osd_ctx.config.timestamp.font_path[0])
+  if (fields != UINT32_MAX
+      && (!g_state_seq_valid || !g_pb_front_valid || seq != g_state_seq + 1))
     {
-      LOG_INFO("Loading timestamp font: %s",
-               g_osd_ctx.config.timestamp.font_path);
-      if (!font_load(&g_osd_ctx.font_timestamp,
-                     g_osd_ctx.config.timestamp.font_path))
+      static int resync_log_counter = 0;
+      if (resync_log_counter++ % 60 == 0)
         {
-          LOG_ERROR("Timestamp font loading FAILED");
-          return -1;
+          LOG_WARN("State delta #%u rejected, full state needed", seq);
         }
+      return 1;
     }
-  else
+
+  int result = ingest_state_bytes(g_osd_ctx.proto_input.data, state_size,
+                                  fields);
+
+  g_state_seq       = seq;
+  g_state_seq_valid = (result == 0);
+  return result;
+}
+
+/**
+ * Update OSD state from protobuf data
+ *
+ * Decodes protobuf state data directly from the given location in WASM
+ * memory; there is no copy and no size limit beyond the data itself.
+ *
+ * @param state_ptr Pointer to protobuf data in WASM memory
+ * @param state_size Size of protobuf data in bytes
+ * @return 0 on success, -1 on error (invalid size or decode failure)
+ */
+__attribute__((visibility("default"))) int
+wasm_osd_update_state(uint32_t state_ptr, uint32_t state_size)
+{
+  g_state_seq_valid = false;
+  return ingest_state_bytes((const uint8_t *)(uintptr_t)state_ptr,
+                            state_size, UINT32_MAX);
+}
+
+/**
+ * Schedule a render if payload-derived context data changed outside a
+ * state update
+ */
+static void
+payload_state_refresh(void)
+{
+  uint64_t payload_hash = hash_payload_state(&g_osd_ctx);
+  if (payload_hash != g_payload_hash)
+    {
+      g_osd_ctx.state_changed
+        |= OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag);
+      g_osd_ctx.needs_render = true;
+      g_payload_hash         = payload_hash;
+    }
+}
+
+/**
+ * Update one opaque payload channel outside of JonGUIState
+ *
+ * Producers push their payload (detections, SAM tracking, CvMeta, client
+ * metadata) on their own schedule; it is decoded once and retained until
+ * the next push on the same channel. While pushes keep coming, copies of
+ * that payload embedded in JonGUIState updates are skipped, so GUI state
+ * updates stop re-decoding it. A channel with no push for a second is
+ * cleared and goes back to the embedded copies.
+ *
+ * @param uuid_ptr Pointer to the 16-byte binary type UUID in WASM memory
+ *                 (RFC 4122 byte order)
+ * @param data_ptr Pointer to the encoded payload message in WASM memory
+ * @param size     Size of the payload in bytes (0 = all fields default)
+ * @return 0 on success, -1 if the type is unknown to this variant
+ */
+__attribute__((visibility("default"))) int
+wasm_osd_update_payload(uint32_t uuid_ptr, uint32_t data_ptr, uint32_t size)
+{
+  const uint8_t *bytes = (const uint8_t *)(uintptr_t)uuid_ptr;
+  opaque_uuid_t uuid   = { 0, 0 };
+
+  for (int i = 0; i < 8; i++)
+    {
+      uuid.hi = (uuid.hi << 8) | bytes[i];
+      uuid.lo = (uuid.lo << 8) | bytes[8 + i];
+    }
+
+  const opaque_decoder_def_t *def = opaque_registry_find(&uuid);
+  if (!def)
+    {
+      static int unknown_log_counter = 0;
+      if (unknown_log_counter++ % 300 == 0)
+        {
+          LOG_WARN("Payload update for unknown type %016llx%016llx",
+                   (unsigned long long)uuid.hi, (unsigned long long)uuid.lo);
+        }
+      return -1;
+    }
+
+  opaque_channel_of(def)->direct = true;
+
+  // No enabled widget reads payloads: nothing to decode
+  uint32_t payload_bit = OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag);
+  if (!(g_osd_ctx.proto_field_mask & payload_bit))
+    {
+      return 0;
+    }
+
+  // A push replaces the channel's data as a whole
+  if (def->reset)
+    {
+      def->reset(&g_osd_ctx);
+    }
+
+  pb_istream_t stream
+    = pb_istream_from_buffer((const pb_byte_t *)(uintptr_t)data_ptr, size);
+  opaque_channel_decode(&g_osd_ctx, def, &stream);
+
+  payload_state_refresh();
+  return 0;
+}
+
+// ────────────────────────────────────────────────────────────
+// Latest-wins state mailbox
+// ────────────────────────────────────────────────────────────
+//
+// Triple buffer: the producer owns one slot, `latest` holds the last
+// published one and the module owns the slot it decoded last. Slots
+// change hands only through the atomic exchange on `latest`, so the
+// module decodes in place without copying and without a torn read.
+
+static wasm_osd_mailbox_slot_t *
+mailbox_slot(uint32_t index)
+{
+  return (wasm_osd_mailbox_slot_t *)(g_mailbox_slots
+                                     + (size_t)index * g_mailbox.slot_stride);
+}
+
+/**
+ * Decode the newest state published to the mailbox, if any
+ *
+ * States published since the last call other than the newest are never
+ * decoded; they are counted in g_mailbox.skipped.
+ */
+static void
+mailbox_consume(void)
+{
+  if (!g_mailbox_slots
+      || !(__atomic_load_n(&g_mailbox.latest, __ATOMIC_ACQUIRE)
+           & WASM_OSD_MAILBOX_FRESH))
+    {
+      return;
+    }
+
+  // Hand back the slot decoded last, take the published one
+  uint32_t taken = __atomic_exchange_n(
+      &g_mailbox.latest, g_mailbox.consumer_slot, __ATOMIC_ACQ_REL);
+  uint32_t index = taken & WASM_OSD_MAILBOX_INDEX_MASK;
+  if (index >= WASM_OSD_MAILBOX_SLOTS)
+    {
+      // Corrupted by the host: keep our slot, drop the state
+      __atomic_store_n(&g_mailbox.latest, g_mailbox.consumer_slot,
+                       __ATOMIC_RELEASE);
+      g_mailbox.rejected++;
+      LOG_ERROR("State mailbox: invalid slot index %u", index);
+      return;
+    }
+  g_mailbox.consumer_slot = index;
+
+  const wasm_osd_mailbox_slot_t *slot = mailbox_slot(index);
+  int32_t gap = (int32_t)(slot->seq - g_mailbox.consumed_seq);
+  if (g_mailbox.consumed > 0 && gap > 1)
+    {
+      g_mailbox.skipped += (uint32_t)(gap - 1);
+    }
+  g_mailbox.consumed_seq = slot->seq;
+  g_mailbox.consumed++;
+
+  if (slot->size > g_mailbox.slot_capacity)
+    {
+      g_mailbox.rejected++;
+      LOG_ERROR("State mailbox: state #%u larger than its slot (%u bytes)",
+                slot->seq, slot->size);
+      return;
+    }
+
+  // Mailbox states are full states: deltas need a new sequenced baseline
+  g_state_seq_valid = false;
+  if (ingest_state_bytes((const uint8_t *)(slot + 1), slot->size,
+                         UINT32_MAX)
+      != 0)
+    {
+      g_mailbox.rejected++;
+    }
+}
+
+static void
+mailbox_free(void)
+{
+  free(g_mailbox_slots);
+  g_mailbox_slots = NULL;
+  memset(&g_mailbox, 0, sizeof(g_mailbox));
+}
+
+/**
+ * Create (or get) the latest-wins state mailbox
+ *
+ * Producers publish states into the mailbox without calling into the
+ * module (see wasm_osd_mailbox_t); wasm_osd_render() and wasm_osd_frame()
+ * then decode only the newest complete one. A mailbox that already has
+ * at least the requested capacity is returned as-is.
+ *
+ * @param slot_capacity Largest state the producer will write, or 0 to
+ *                      remove the mailbox
+ * @return Pointer to the wasm_osd_mailbox_t in WASM memory, or 0 if
+ *         removed, capacity exceeds OSD_STATE_MAX_SIZE or allocation failed
+ */
+__attribute__((visibility("default"))) uint32_t
+wasm_osd_get_state_mailbox(uint32_t slot_capacity)
+{
+  if (g_mailbox_slots && slot_capacity != 0
+      && slot_capacity <= g_mailbox.slot_capacity)
+    {
+      return (uint32_t)((uintptr_t)&g_mailbox);
+    }
+
+  mailbox_free();
+  if (slot_capacity == 0)
+    {
+      return 0;
+    }
+
+  if (slot_capacity > OSD_STATE_MAX_SIZE)
+    {
+      LOG_ERROR("State mailbox unavailable: %u bytes per slot (max %d)",
+                slot_capacity, OSD_STATE_MAX_SIZE);
+      return 0;
+    }
+
+  // Slot headers stay 8-byte aligned
+  uint32_t stride = (uint32_t)sizeof(wasm_osd_mailbox_slot_t)
+                    + ((slot_capacity + 7u) & ~7u);
+  g_mailbox_slots = calloc(WASM_OSD_MAILBOX_SLOTS, stride);
+  if (!g_mailbox_slots)
+    {
+      LOG_ERROR("State mailbox allocation failed (%u bytes)",
+                WASM_OSD_MAILBOX_SLOTS * stride);
+      return 0;
+    }
+
+  g_mailbox.magic         = WASM_OSD_MAILBOX_MAGIC;
+  g_mailbox.slot_count    = WASM_OSD_MAILBOX_SLOTS;
+  g_mailbox.slot_capacity = slot_capacity;
+  g_mailbox.slot_stride   = stride;
+  g_mailbox.slots         = (uint32_t)((uintptr_t)g_mailbox_slots);
+  g_mailbox.producer_slot = 0;
+  g_mailbox.latest        = 1;
+  g_mailbox.consumer_slot = 2;
+
+  LOG_INFO("State mailbox: %u slots of %u bytes", WASM_OSD_MAILBOX_SLOTS,
+           slot_capacity);
+  return (uint32_t)((uintptr_t)&g_mailbox);
+}
+
+// ════════════════════════════════════════════════════════════
+// RENDERING HELPERS
+// ════════════════════════════════════════════════════════════
+
+/**
+ * Render all widgets
+ *
+ * Each widget is drawn or served from its last drawn layer as scheduled
+ * by its max_rate_hz (see widget_scheduler.h), in this order: crosshair
+ * (with speed indicators), timestamp, navball, variant info, sharpness
+ * heatmap, autofocus debug, detections, SAM mask, ROI. Timestamp, navball
+ * and ROI need a decoded state.
+ *
+ * @param proto_state Proto state (may be NULL if not decoded)
+ */
+static void
+render_widgets(ser_JonGUIState *proto_state)
+{
+  widget_scheduler_render(&g_osd_ctx, proto_state);
+}
+
+// ════════════════════════════════════════════════════════════
+// MAIN RENDERING FUNCTION
+// ════════════════════════════════════════════════════════════
+
+// Last decoded state, or NULL before the first good update
+static ser_JonGUIState *
+front_state(void)
+{
+  if (g_osd_ctx.proto_valid && g_pb_front_valid)
+    {
+      return &g_pb_states[g_pb_front];
+    }
+  return NULL;
+}
+
+/**
+ * Signature of everything that affects the pixels of a frame
+ *
+ * The configuration generation, the quality level, the widget layers the
+ * frame will show (see widget_scheduler_signature()) and the decoded
+ * state fields and payload-derived data the widgets drawn from this state
+ * read. Widgets shown from a kept layer add only that layer, so state
+ * they alone read (e.g. the state time variant info shows) does not
+ * force a render.
+ *
+ * @param state     State the frame shows (NULL if none was decoded yet)
+ * @param signature Receives the signature
+ * @return false if the pixels cannot be predicted (a widget redraws from
+ *         data it keeps across frames)
+ */
+static bool
+frame_signature(const ser_JonGUIState *state, uint64_t *signature)
+{
+  uint32_t quality = render_budget_quality();
+  uint32_t fresh;
+  uint64_t h;
+
+  if (!widget_scheduler_signature(&g_osd_ctx, state, quality, &h, &fresh))
+    {
+      return false;
+    }
+
+  uint32_t mask = g_osd_ctx.proto_field_mask
+                  & proto_field_mask_from_config(&g_osd_ctx.config, fresh);
+  uint8_t has_state = state != NULL;
+
+  h = hash_fnv1a(h, &g_config_generation, sizeof(g_config_generation));
+  h = hash_fnv1a(h, &quality, sizeof(quality));
+  h = hash_fnv1a(h, &has_state, sizeof(has_state));
+  if (mask & OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag))
+    {
+      h = hash_fnv1a(h, &g_payload_hash, sizeof(g_payload_hash));
+    }
+  if (state)
+    {
+      h = hash_proto_state(h, state, mask);
+    }
+
+  *signature = h;
+  return true;
+}
+
+/**
+ * Start a frame: clear the framebuffer if anything changed
+ *
+ * A frame whose signature matches the one already in the framebuffer is
+ * not drawn at all; only the widgets' per-state bookkeeping runs.
+ *
+ * @param state State the frame shows (NULL if none was decoded yet)
+ * @return false if nothing needs rendering
+ */
+static bool
+frame_begin(ser_JonGUIState *state)
+{
+  // A stopped direct producer's overlay goes away without state updates too
+  if (opaque_channels_expire(&g_osd_ctx))
     {
-      LOG_ERROR("No timestamp font configured");
-      return -1;
+      payload_state_refresh();
     }
 
-  if (g_osd_ctx.config.speed_indicators.font_path[0])
+  if (!g_osd_ctx.needs_render)
     {
-      LOG_INFO("Loading speed indicators font: %s",
-               g_osd_ctx.config.speed_indicators.font_path);
-      if (!font_load(&g_osd_ctx.font_speed_indicators,
-                     g_osd_ctx.config.speed_indicators.font_path))
-        {
-          LOG_ERROR("Speed indicators font loading FAILED");
-          return -1;
-        }
+      return false;
     }
-  else
+
+  // Updates from here on are for the next frame; the widgets of this one
+  // see what changed before it started
+  g_osd_ctx.needs_render  = false;
+  g_osd_ctx.frame_changed = g_osd_ctx.state_changed;
+  g_osd_ctx.state_changed = 0;
+
+  g_next_signature_valid = frame_signature(state, &g_next_signature);
+  if (g_next_signature_valid && g_frame_signature_valid
+      && g_next_signature == g_frame_signature)
     {
-      LOG_ERROR("No speed indicators font configured");
-      return -1;
+      widget_scheduler_skip(&g_osd_ctx, state);
+
+      // No widget drew: the next frame that does must still see the changes
+      g_osd_ctx.state_changed |= g_osd_ctx.frame_changed;
+      return false;
     }
 
-  if (g_osd_ctx.config.variant_info.font_path[0])
+  // Clear framebuffer to transparent (alpha = 0)
+  memset(g_framebuffer, 0, sizeof(g_framebuffer));
+  g_frame_signature_valid = false;
+  return true;
+}
+
+/**
+ * Finish a frame: track content bounds for the dirty region
+ *
+ * @param dirty Set to the region that differs from the previous frame
+ *              (the old and new content bounds)
+ */
+static void
+frame_finish(framebuffer_rect_t *dirty)
+{
+  // Pixels outside both the old and new content are transparent in both
+  framebuffer_t fb;
+  framebuffer_rect_t bounds;
+  framebuffer_init(&fb, g_framebuffer, g_osd_ctx.width, g_osd_ctx.height);
+  framebuffer_content_bounds(&fb, &bounds);
+  *dirty           = framebuffer_rect_union(g_content_bounds, bounds);
+  g_content_bounds = bounds;
+  g_framebuffer_generation++;
+
+  g_frame_signature       = g_next_signature;
+  g_frame_signature_valid = g_next_signature_valid;
+}
+
+/**
+ * Render all widgets into a cleared framebuffer if anything changed
+ *
+ * Replaces a sliced frame in progress (wasm_osd_render_step()).
+ *
+ * @param pb_ptr State to render (NULL if none was decoded yet)
+ * @param dirty  Set to the region that differs from the previous frame
+ *               (the old and new content bounds); empty when skipped
+ * @return 1 if the framebuffer was re-rendered, 0 if nothing changed
+ */
+static int
+render_frame(ser_JonGUIState *pb_ptr, framebuffer_rect_t *dirty)
+{
+  memset(dirty, 0, sizeof(*dirty));
+
+  // A sliced frame in progress is half drawn; this render replaces it, and
+  // its widgets that did not draw yet must see what changed for it
+  if (g_step_active)
     {
-      LOG_INFO("Loading variant info font: %s",
-               g_osd_ctx.config.variant_info.font_path);
-      if (!font_load(&g_osd_ctx.font_variant_info,
-                     g_osd_ctx.config.variant_info.font_path))
-        {
-          LOG_ERROR("Variant info font loading FAILED");
-          return -1;
-        }
+      g_step_active           = false;
+      g_osd_ctx.needs_render  = true;
+      g_osd_ctx.state_changed |= g_osd_ctx.frame_changed;
     }
-  else
+
+  // Early return if nothing to render
+  if (!frame_begin(pb_ptr))
     {
-      LOG_ERROR("No variant info font configured");
-      return -1;
+      return 0;
     }
 
-  LOG_INFO("All fonts loaded successfully");
+  render_widgets(pb_ptr);
+  frame_finish(dirty);
+  return 1;
+}
 
-  // Copy celestial indicators configuration to context
-  g_osd_ctx.celestial_enabled  = g_osd_ctx.config.celestial_indicators.enabled;
-  g_osd_ctx.celestial_show_sun = g_osd_ctx.config.celestial_indicators.show_sun;
-  g_osd_ctx.celestial_show_moon
-    = g_osd_ctx.config.celestial_indicators.show_moon;
-  g_osd_ctx.celestial_indicator_scale
-    = g_osd_ctx.config.celestial_indicators.indicator_scale;
-  g_osd_ctx.celestial_visibility_threshold
-    = g_osd_ctx.config.celestial_indicators.visibility_threshold;
+/**
+ * Render OSD to framebuffer
+ *
+ * Renders all enabled widgets to the framebuffer. This function is idempotent -
+ * if needs_render is false, it returns immediately without rendering.
+ * The newest state published to the mailbox, if any, is decoded first.
+ * A frame whose signature (state fields, payloads, config, quality and
+ * widget layers) matches the framebuffer is not rendered either, so hosts
+ * can skip the texture upload whenever this returns 0.
+ *
+ * @return 1 if the framebuffer was re-rendered, 0 if it is unchanged
+ */
+__attribute__((visibility("default"))) int
+wasm_osd_render(void)
+{
+  mailbox_consume();
 
-  // Initialize nav ball widget (REQUIRED - fail if initialization fails)
-  // Note: navball_init() will load celestial SVGs if celestial_enabled is true
-  LOG_INFO("Initializing nav ball widget...");
-  if (!navball_init(&g_osd_ctx, &g_osd_ctx.config.navball))
+  // The frame shows the newest state, not the last display-time one
+  if (g_osd_ctx.needs_render)
     {
-      LOG_ERROR("Nav ball initialization FAILED");
-      return -1;
+      g_display_valid = false;
     }
-  LOG_INFO("Nav ball initialized successfully");
 
-  // Initialize proto buffer
-  // update)
-  g_osd_ctx.proto_size  = 0;
-  g_osd_ctx.proto_valid = false;
+  framebuffer_rect_t dirty;
+  return render_frame(front_state(), &dirty);
+}
 
-  // Clear framebuffer
-  memset(g_framebuffer, 0, sizeof(g_framebuffer));
+/**
+ * Render the state a display export built into the spare display slot
+ *
+ * Re-renders only if it differs from the last state rendered this way
+ * (or a plain render happened since).
+ */
+static int
+render_display_slot(void)
+{
+  int next                 = g_display_cur ^ 1;
+  ser_JonGUIState *display = &g_pb_display[next];
 
-  LOG_INFO("OSD initialized: %dx%d", g_osd_ctx.width, g_osd_ctx.height);
-  return 0;
+  if (!g_display_valid
+      || diff_proto_states(&g_pb_display[g_display_cur], display,
+                           g_osd_ctx.proto_field_mask)
+           != 0)
+    {
+      g_osd_ctx.needs_render = true;
+    }
+  g_display_cur   = next;
+  g_display_valid = true;
+
+  framebuffer_rect_t dirty;
+  return render_frame(display, &dirty);
 }
 
 /**
- * Update OSD state from protobuf data
+ * Render OSD as of a display time
  *
- * Copies protobuf state data from host memory into WASM module.
- * This triggers a re-render on the next wasm_osd_render() call.
+ * Builds the state for the time the frame will be shown from the recent
+ * states (see state_history.h): attitude and rotary speeds are
+ * interpolated between the states around it, or extrapolated up to
+ * STATE_HISTORY_MAX_EXTRAPOLATION_US past the newest one; all other
+ * fields are those of the state in effect. Called at the display rate,
+ * this moves the navball and speed indicators smoothly between ~30 Hz
+ * state updates and hides pipeline latency.
  *
- * @param state_ptr Pointer to protobuf data in host memory
- * @param state_size Size of protobuf data in bytes
- * @return 0 on success, -1 on error
+ * @param display_time_us Display time on the JonGUIState
+ *                        system_monotonic_time_us clock, or 0 for the
+ *                        newest state (same as wasm_osd_render())
+ * @return 1 if something was rendered, 0 if nothing changed or skipped
  */
 __attribute__((visibility("default"))) int
-wasm_osd_update_state(uint32_t state_ptr, uint32_t state_size)
+wasm_osd_render_at(uint64_t display_time_us)
 {
-  if (state_size > sizeof(g_osd_ctx.proto_buffer))
+  if (display_time_us == 0 || !front_state())
     {
-      LOG_ERROR("Proto too large: %u bytes (max %zu)", state_size,
-                sizeof(g_osd_ctx.proto_buffer));
-      return -1;
+      return wasm_osd_render();
     }
 
-  if (state_size == 0)
+  mailbox_consume();
+
+  if (!state_history_at_time(&g_state_history, display_time_us,
+                             &g_pb_display[g_display_cur ^ 1]))
     {
-      LOG_WARN("Empty state update");
-      return -1;
+      return wasm_osd_render();
     }
+  return render_display_slot();
+}
 
-  // Copy proto bytes from host memory into our pre-allocated buffer
-  memcpy(g_osd_ctx.proto_buffer, (void *)(uintptr_t)state_ptr, state_size);
-  g_osd_ctx.proto_size   = state_size;
-  g_osd_ctx.proto_valid  = true;
-  g_osd_ctx.needs_render = true;
-  g_osd_ctx.frame_count++;
-
-  if ((g_osd_ctx.frame_count % 60) == 0)
+/**
+ * Render OSD for a video frame
+ *
+ * Selects the recent state carrying the frame's PTS (frame_pts_heat_ns in
+ * thermal variants, frame_pts_day_ns otherwise), or interpolates between
+ * the two states around it, so a compositor can burn the overlay into
+ * frames ahead of or behind state ingestion without drifting. History
+ * covers the last STATE_HISTORY_DEPTH states; frames outside it get the
+ * nearest state.
+ *
+ * @param pts_ns Frame PTS in nanoseconds (pipeline clock of the states)
+ * @return 1 if something was rendered, 0 if nothing changed or skipped;
+ *         states without a PTS render like wasm_osd_render()
+ */
+__attribute__((visibility("default"))) int
+wasm_osd_render_for_pts(uint64_t pts_ns)
+{
+  if (!front_state())
     {
-      LOG_INFO("State update #%d (proto size=%u bytes)", g_osd_ctx.frame_count,
-               state_size);
+      return wasm_osd_render();
     }
 
-  return 0;
-}
+  mailbox_consume();
 
-// ════════════════════════════════════════════════════════════
-// RENDERING HELPERS
-// ════════════════════════════════════════════════════════════
+#ifdef OSD_STREAM_THERMAL
+  bool heat = true;
+#else
+  bool heat = false;
+#endif
+
+  if (!state_history_at_pts(&g_state_history, pts_ns, heat,
+                            &g_pb_display[g_display_cur ^ 1]))
+    {
+      return wasm_osd_render();
+    }
+  return render_display_slot();
+}
 
 /**
- * Render all widgets and return whether anything changed
+ * Render OSD in slices of bounded time
  *
- * @param proto_state Proto state (may be NULL if not decoded)
- * @return true if any widget rendered, false if nothing changed
+ * Each call draws widgets of the current frame until budget_us has
+ * passed, then returns so the host can yield (for example to the browser
+ * event loop) and call again. The frame in the framebuffer is complete,
+ * and identical to what wasm_osd_render() draws, only once a call returns
+ * something other than WASM_OSD_STEP_PENDING; publish it then.
+ *
+ * A frame shows the newest state when it starts, copied so later updates
+ * cannot change it half way. The mailbox is read only when a frame
+ * starts. Updates that arrive during a frame do not restart it (states
+ * may arrive faster than frames finish); the next frame starts as soon as
+ * it completes. Any other render call replaces the frame in progress.
+ *
+ * @param budget_us Time to spend in this call (0 = finish the frame).
+ *                  Widgets are not split: a call may overrun by the cost
+ *                  of one widget.
+ * @return WASM_OSD_STEP_PENDING if the frame is unfinished, otherwise
+ *         what wasm_osd_render() returns (1 rendered, 0 nothing changed)
  */
-static bool
-render_widgets(ser_JonGUIState *proto_state)
+__attribute__((visibility("default"))) int
+wasm_osd_render_step(uint32_t budget_us)
 {
-  bool changed = false;
+  uint64_t start = monotonic_us();
 
-  // Render crosshair (with or without speed indicators based on proto)
-  changed |= crosshair_render(&g_osd_ctx, proto_state);
-
-  // Render other widgets only if proto is available
-  if (proto_state)
+  if (!g_step_active)
     {
-      changed |= timestamp_render(&g_osd_ctx, proto_state);
-      changed |= navball_render(&g_osd_ctx, proto_state);
+      mailbox_consume();
+
+      // The frame shows the newest state, not the last display-time one
+      if (g_osd_ctx.needs_render)
+        {
+          g_display_valid = false;
+        }
+
+      ser_JonGUIState *front = front_state();
+      g_step_state           = NULL;
+      if (front)
+        {
+          memcpy(&g_pb_step, front, sizeof(g_pb_step));
+          g_step_state = &g_pb_step;
+        }
+
+      if (!frame_begin(g_step_state))
+        {
+          return 0;
+        }
+      widget_scheduler_begin(&g_osd_ctx, g_step_state);
+      g_step_active = true;
     }
 
-  // Variant info (needs proto for state time display)
-  changed |= variant_info_render(&g_osd_ctx, proto_state);
+  uint64_t deadline = budget_us ? start + budget_us : 0;
+  if (!widget_scheduler_step(&g_osd_ctx, g_step_state, deadline))
+    {
+      return WASM_OSD_STEP_PENDING;
+    }
 
-  // CV widgets (render with or without proto, data comes from opaque payloads)
-  changed |= sharpness_heatmap_render(&g_osd_ctx, proto_state);
-  changed |= autofocus_debug_render(&g_osd_ctx, proto_state);
-  changed |= detections_render(&g_osd_ctx, proto_state);
-  changed |= sam_mask_render(&g_osd_ctx, proto_state);
+  g_step_active = false;
+  widget_scheduler_end();
 
-  // ROI overlays (data from proto state CV fields)
-  if (proto_state)
+  // Payloads live in the context, so widgets drawn after an update during
+  // the frame may show it: the frame no longer matches its signature
+  if (g_osd_ctx.needs_render)
     {
-      changed |= roi_render(&g_osd_ctx, proto_state);
+      g_next_signature_valid = false;
     }
 
-  return changed;
+  framebuffer_rect_t dirty;
+  frame_finish(&dirty);
+  return 1;
 }
 
-// ════════════════════════════════════════════════════════════
-// MAIN RENDERING FUNCTION
-// ════════════════════════════════════════════════════════════
-
 /**
- * Render OSD to framebuffer
+ * Update state, render and report in one call
  *
- * Renders all enabled widgets to the framebuffer. This function is idempotent -
- * if needs_render is false, it returns immediately without rendering.
+ * Equivalent to wasm_osd_update_state() + wasm_osd_render() +
+ * wasm_osd_get_framebuffer(), plus dirty bounds and timing, for hosts
+ * where each call across the WASM boundary has a fixed cost. A state
+ * published to the mailbox is applied after the one passed here.
  *
- * @return 1 if something was rendered, 0 if nothing changed or skipped
+ * @param state_ptr    Pointer to protobuf data in WASM memory
+ * @param state_size   Size of protobuf data (0 = render only)
+ * @param flags        WASM_OSD_FRAME_* bits
+ * @param out_info_ptr wasm_osd_frame_info_t to fill, or 0 for g_frame_info
+ * @return 1 if rendered, 0 if unchanged, -1 if the state was rejected
  */
 __attribute__((visibility("default"))) int
-wasm_osd_render(void)
+wasm_osd_frame(uint32_t state_ptr,
+               uint32_t state_size,
+               uint32_t flags,
+               uint32_t out_info_ptr)
 {
-  // Early return if nothing to render
-  if (!g_osd_ctx.needs_render)
+  wasm_osd_frame_info_t *info
+    = out_info_ptr ? (wasm_osd_frame_info_t *)(uintptr_t)out_info_ptr
+                   : &g_frame_info;
+
+  uint64_t start   = monotonic_us();
+  int state_result = 0;
+  if (state_size > 0)
     {
-      return 0;
+      state_result = wasm_osd_update_state(state_ptr, state_size);
     }
+  mailbox_consume();
 
-  // Clear framebuffer to transparent (alpha = 0)
-  memset(g_framebuffer, 0, sizeof(g_framebuffer));
-
-  // Decode proto state if available
-  ser_JonGUIState pb_state = ser_JonGUIState_init_zero;
-  ser_JonGUIState *pb_ptr  = NULL;
+  // Forcing also gets past the signature check in frame_begin()
+  if (flags & WASM_OSD_FRAME_FORCE_RENDER)
+    {
+      g_osd_ctx.needs_render  = true;
+      g_frame_signature_valid = false;
+    }
 
-  if (g_osd_ctx.proto_valid && decode_proto_state(&g_osd_ctx, &pb_state))
+  if (g_osd_ctx.needs_render)
     {
-      pb_ptr = &pb_state; // Proto decoded successfully
+      g_display_valid = false;
     }
 
-  // Render widgets and check if anything changed
-  bool changed = render_widgets(pb_ptr);
+  uint64_t rendered_at = monotonic_us();
+  framebuffer_rect_t dirty;
+  int rendered = render_frame(front_state(), &dirty);
+  uint64_t end = monotonic_us();
+
+  info->framebuffer  = (uint32_t)((uintptr_t)g_framebuffer);
+  info->width        = (uint32_t)g_osd_ctx.width;
+  info->height       = (uint32_t)g_osd_ctx.height;
+  info->changed      = (uint32_t)rendered;
+  info->state_result = state_result;
+  info->dirty_x      = (uint32_t)dirty.x;
+  info->dirty_y      = (uint32_t)dirty.y;
+  info->dirty_width  = (uint32_t)dirty.width;
+  info->dirty_height = (uint32_t)dirty.height;
+  info->update_us    = (uint32_t)(rendered_at - start);
+  info->render_us    = (uint32_t)(end - rendered_at);
+  info->frame_count  = (uint32_t)g_osd_ctx.frame_count;
+
+  return (state_result < 0) ? -1 : rendered;
+}
+
+/**
+ * Get the module-owned frame info block
+ *
+ * Hosts without an allocator in WASM memory pass 0 as out_info_ptr and
+ * read the result here; the address never changes.
+ *
+ * @return Pointer to g_frame_info (as uint32_t for WASM compatibility)
+ */
+__attribute__((visibility("default"))) uint32_t
+wasm_osd_get_frame_info(void)
+{
+  return (uint32_t)((uintptr_t)&g_frame_info);
+}
+
+/**
+ * Get the per-widget render cost table
+ *
+ * WASM_OSD_WIDGET_COUNT wasm_osd_widget_stats_t entries indexed by
+ * WASM_OSD_WIDGET_*, updated by every render. The address never changes.
+ *
+ * @return Pointer to the table (as uint32_t for WASM compatibility)
+ */
+__attribute__((visibility("default"))) uint32_t
+wasm_osd_get_widget_stats(void)
+{
+  return (uint32_t)((uintptr_t)widget_scheduler_stats());
+}
 
-  g_osd_ctx.needs_render = false;
-  return changed ? 1 : 0;
+/**
+ * Get the frame-budget governor state
+ *
+ * A wasm_osd_budget_stats_t updated by every render. The address never
+ * changes.
+ *
+ * @return Pointer to the stats (as uint32_t for WASM compatibility)
+ */
+__attribute__((visibility("default"))) uint32_t
+wasm_osd_get_budget_stats(void)
+{
+  return (uint32_t)((uintptr_t)render_budget_stats());
 }
 
 /**
@@ -1019,6 +2477,169 @@ wasm_osd_get_framebuffer(void)
   return (uint32_t)((uintptr_t)g_framebuffer);
 }
 
+/**
+ * Encode the framebuffer in sparse transfer form
+ *
+ * Occupied tiles of the last finished frame, packed after an occupancy
+ * bitmap (see wasm_osd_sparse_frame_t). Re-encoded only when the
+ * framebuffer was re-rendered since the last call or the tile size
+ * changed.
+ *
+ * @param tile_size Tile edge, a power of two from 8 to 256 (0 = default)
+ * @return Pointer to the block (as uint32_t for WASM compatibility), or 0
+ *         if tile_size is invalid or the block cannot be allocated
+ */
+__attribute__((visibility("default"))) uint32_t
+wasm_osd_get_sparse_frame(uint32_t tile_size)
+{
+  framebuffer_t fb;
+  framebuffer_init(&fb, g_framebuffer, g_osd_ctx.width, g_osd_ctx.height);
+
+  const wasm_osd_sparse_frame_t *sparse = sparse_frame_encode(
+    &fb, g_content_bounds,
+    tile_size ? tile_size : WASM_OSD_SPARSE_TILE_DEFAULT,
+    g_framebuffer_generation);
+  if (!sparse)
+    {
+      LOG_ERROR("Sparse frame: cannot encode with tile size %u", tile_size);
+      return 0;
+    }
+  return (uint32_t)((uintptr_t)sparse);
+}
+
+/**
+ * Get the video frame buffer
+ *
+ * Heap block for hosts that copy or decode video frames into WASM memory
+ * before wasm_osd_blend_yuv(). A buffer that already has at least the
+ * requested capacity is returned as-is.
+ *
+ * @param capacity Frame bytes the host intends to write
+ * @return Pointer to the buffer (as uint32_t for WASM compatibility), or
+ *         0 if capacity exceeds OSD_VIDEO_MAX_SIZE or allocation failed
+ */
+__attribute__((visibility("default"))) uint32_t
+wasm_osd_get_video_buffer(uint32_t capacity)
+{
+  if (g_video_buffer && capacity <= g_video_buffer_capacity)
+    {
+      return (uint32_t)((uintptr_t)g_video_buffer);
+    }
+
+  if (capacity == 0 || capacity > OSD_VIDEO_MAX_SIZE)
+    {
+      LOG_ERROR("Video buffer unavailable: %u bytes (max %d)", capacity,
+                OSD_VIDEO_MAX_SIZE);
+      return 0;
+    }
+
+  // Old contents are not kept, so free + malloc rather than realloc
+  free(g_video_buffer);
+  g_video_buffer          = malloc(capacity);
+  g_video_buffer_capacity = g_video_buffer ? capacity : 0;
+  if (!g_video_buffer)
+    {
+      LOG_ERROR("Video buffer allocation failed (%u bytes)", capacity);
+      return 0;
+    }
+  return (uint32_t)((uintptr_t)g_video_buffer);
+}
+
+/**
+ * Check that a host-supplied region lies inside WASM linear memory
+ *
+ * @param ptr  Offset of the region
+ * @param size Bytes in the region
+ * @return true if [ptr, ptr + size) is addressable
+ */
+static bool
+linear_memory_contains(uint32_t ptr, uint64_t size)
+{
+#ifdef __wasm__
+  uint64_t memory_size = (uint64_t)__builtin_wasm_memory_size(0) * 65536;
+  return size <= memory_size && ptr <= memory_size - size;
+#else
+  // Native test builds pass process addresses: nothing to check against
+  (void)ptr;
+  (void)size;
+  return true;
+#endif
+}
+
+/**
+ * Blend the overlay into a 4:2:0 video frame in place
+ *
+ * Burns the last rendered frame into a host frame of the framebuffer size
+ * (see wasm_osd_blend_yuv() in wasm_exports.h for the plane layout). Only
+ * the content bounds are visited, and only samples under non-transparent
+ * overlay pixels are converted and written.
+ *
+ * @param format    WASM_OSD_YUV_I420 or WASM_OSD_YUV_NV12, optionally
+ *                  | WASM_OSD_YUV_BT601
+ * @param frame_ptr Pointer to the Y plane in WASM memory
+ * @param y_stride  Bytes per luma row
+ * @param uv_stride Bytes per chroma row
+ * @return 0 on success, -1 if the format or strides are invalid, the
+ *         frame does not fit in linear memory, or a sliced frame is in
+ *         progress
+ */
+__attribute__((visibility("default"))) int
+wasm_osd_blend_yuv(uint32_t format,
+                   uint32_t frame_ptr,
+                   uint32_t y_stride,
+                   uint32_t uv_stride)
+{
+  uint32_t layout    = format & ~WASM_OSD_YUV_BT601;
+  uint32_t width     = (uint32_t)g_osd_ctx.width;
+  uint32_t height    = (uint32_t)g_osd_ctx.height;
+  uint32_t uv_width  = (width + 1) / 2;
+  uint32_t uv_height = (height + 1) / 2;
+
+  if ((layout != WASM_OSD_YUV_I420 && layout != WASM_OSD_YUV_NV12)
+      || frame_ptr == 0 || y_stride < width
+      || uv_stride < (layout == WASM_OSD_YUV_NV12 ? 2 * uv_width : uv_width))
+    {
+      LOG_ERROR("Invalid YUV frame: format 0x%x, strides %u/%u for %ux%u",
+                format, y_stride, uv_stride, width, height);
+      return -1;
+    }
+
+  // All planes must be writable: Y, then one (NV12) or two (I420) chroma
+  // planes (64-bit, so huge strides cannot wrap)
+  uint64_t chroma_planes = layout == WASM_OSD_YUV_I420 ? 2 : 1;
+  uint64_t frame_size    = (uint64_t)y_stride * height
+                        + chroma_planes * uv_stride * uv_height;
+  if (!linear_memory_contains(frame_ptr, frame_size))
+    {
+      LOG_ERROR("YUV frame at 0x%x (%llu bytes) is outside linear memory",
+                frame_ptr, (unsigned long long)frame_size);
+      return -1;
+    }
+
+  // The framebuffer holds a half-drawn frame between render steps
+  if (g_step_active)
+    {
+      LOG_ERROR("YUV blend refused: a sliced frame is in progress");
+      return -1;
+    }
+
+  uint8_t *base = (uint8_t *)(uintptr_t)frame_ptr;
+  yuv_frame_t frame;
+  frame.y         = base;
+  frame.y_stride  = y_stride;
+  frame.u         = base + (size_t)y_stride * height;
+  frame.v         = layout == WASM_OSD_YUV_I420
+                      ? frame.u + (size_t)uv_stride * uv_height
+                      : NULL;
+  frame.uv_stride = uv_stride;
+  frame.bt601     = (format & WASM_OSD_YUV_BT601) != 0;
+
+  framebuffer_t fb;
+  framebuffer_init(&fb, g_framebuffer, width, height);
+  yuv_blend_framebuffer(&fb, g_content_bounds, &frame);
+  return 0;
+}
+
 /**
  * Destroy OSD system
  *
@@ -1044,6 +2665,23 @@ wasm_osd_destroy(void)
   // Cleanup nav ball resources
   navball_cleanup(&g_osd_ctx);
 
+  mailbox_free();
+  widget_scheduler_free();
+  sparse_frame_free();
+  text_cleanup();
+  grow_buffer_free(&g_osd_ctx.proto_input);
+  grow_buffer_free(&g_osd_ctx.sam_rle_input);
+
+  free(g_video_buffer);
+  g_video_buffer          = NULL;
+  g_video_buffer_capacity = 0;
+
   memset(&g_osd_ctx, 0, sizeof(g_osd_ctx));
+  g_pb_front_valid        = false;
+  g_state_seq_valid       = false;
+  g_display_valid         = false;
+  g_step_active           = false;
+  g_frame_signature_valid = false;
+  state_history_reset(&g_state_history);
   return 0;
 }
@@ -0,0 +1,4526 @@
+/* Automatically generated by tools/gen_fastdec.py - do not edit */
+/* Roots: ser_JonGUIState ser_JonOpaquePayload ser_OsdClientMetadata ser_CvMeta ser_ObjectDetectionsDay ser_ObjectDetectionsHeat ser_ObjectDetection ser_SamTrackingDay ser_SamTrackingHeat */
+
+#include "pb_fastdec.h"
+
+#include <pb_common.h>
+#include <string.h>
+
+/* Read position within a buffer stream */
+typedef struct
+{
+  const pb_byte_t *pos;
+  const char *errmsg;
+} pbfast_cursor_t;
+
+#define PBFAST_KEY(tag, wire) (((uint32_t)(tag) << 3) | (uint32_t)(wire))
+
+static bool
+pbfast_fail(pbfast_cursor_t *c, const char *errmsg)
+{
+  c->errmsg = errmsg;
+  return false;
+}
+
+/* pb_decode_varint32(): up to 10 bytes, upper bits only as sign extension */
+static bool
+pbfast_varint32_slow(pbfast_cursor_t *c,
+                      const pb_byte_t *end,
+                      uint32_t *dest)
+{
+  const pb_byte_t *p  = c->pos;
+  uint_fast8_t bitpos = 7;
+  uint32_t result     = *p++ & 0x7F;
+  pb_byte_t byte;
+
+  do
+    {
+      if (p >= end)
+        return pbfast_fail(c, "end-of-stream");
+      byte = *p++;
+
+      if (bitpos >= 32)
+        {
+          pb_byte_t sign_extension = (bitpos < 63) ? 0xFF : 0x01;
+          bool valid_extension
+            = ((byte & 0x7F) == 0x00
+               || ((result >> 31) != 0 && byte == sign_extension));
+
+          if (bitpos >= 64 || !valid_extension)
+            return pbfast_fail(c, "varint overflow");
+        }
+      else if (bitpos == 28)
+        {
+          if ((byte & 0x70) != 0 && (byte & 0x78) != 0x78)
+            return pbfast_fail(c, "varint overflow");
+          result |= (uint32_t)(byte & 0x0F) << bitpos;
+        }
+      else
+        {
+          result |= (uint32_t)(byte & 0x7F) << bitpos;
+        }
+      bitpos = (uint_fast8_t)(bitpos + 7);
+    }
+  while (byte & 0x80);
+
+  c->pos = p;
+  *dest  = result;
+  return true;
+}
+
+static inline bool
+pbfast_varint32(pbfast_cursor_t *c, const pb_byte_t *end, uint32_t *dest)
+{
+  if (c->pos >= end)
+    return pbfast_fail(c, "end-of-stream");
+  if (*c->pos < 0x80)
+    {
+      *dest = *c->pos++;
+      return true;
+    }
+  return pbfast_varint32_slow(c, end, dest);
+}
+
+/* pb_decode_varint(): up to 10 bytes, at most 64 significant bits */
+static inline bool
+pbfast_varint64(pbfast_cursor_t *c, const pb_byte_t *end, uint64_t *dest)
+{
+  const pb_byte_t *p  = c->pos;
+  uint_fast8_t bitpos = 0;
+  uint64_t result     = 0;
+  pb_byte_t byte;
+
+  do
+    {
+      if (p >= end)
+        return pbfast_fail(c, "end-of-stream");
+      byte = *p++;
+
+      if (bitpos >= 63 && (byte & 0xFE) != 0)
+        return pbfast_fail(c, "varint overflow");
+
+      result |= (uint64_t)(byte & 0x7F) << bitpos;
+      bitpos = (uint_fast8_t)(bitpos + 7);
+    }
+  while (byte & 0x80);
+
+  c->pos = p;
+  *dest  = result;
+  return true;
+}
+
+static inline bool
+pbfast_key(pbfast_cursor_t *c, const pb_byte_t *end, uint32_t *key)
+{
+  if (!pbfast_varint32(c, end, key))
+    return false;
+  if ((*key >> 3) == 0)
+    return pbfast_fail(c, "zero tag");
+  return true;
+}
+
+/* Length prefix of a length-delimited field; *sub_end is where it ends */
+static inline bool
+pbfast_length(pbfast_cursor_t *c,
+               const pb_byte_t *end,
+               const pb_byte_t **sub_end)
+{
+  uint32_t size;
+  if (!pbfast_varint32(c, end, &size))
+    return false;
+  if ((size_t)(end - c->pos) < size)
+    return pbfast_fail(c, "parent stream too short");
+  *sub_end = c->pos + size;
+  return true;
+}
+
+/* pb_skip_field() */
+static bool
+pbfast_skip(pbfast_cursor_t *c, const pb_byte_t *end, uint32_t key)
+{
+  const pb_byte_t *sub_end;
+
+  switch (key & 7)
+    {
+    case PB_WT_VARINT:
+      do
+        {
+          if (c->pos >= end)
+            return pbfast_fail(c, "end-of-stream");
+        }
+      while (*c->pos++ & 0x80);
+      return true;
+    case PB_WT_64BIT:
+      if (end - c->pos < 8)
+        return pbfast_fail(c, "end-of-stream");
+      c->pos += 8;
+      return true;
+    case PB_WT_STRING:
+      if (!pbfast_length(c, end, &sub_end))
+        return false;
+      c->pos = sub_end;
+      return true;
+    case PB_WT_32BIT:
+      if (end - c->pos < 4)
+        return pbfast_fail(c, "end-of-stream");
+      c->pos += 4;
+      return true;
+    default:
+      return pbfast_fail(c, "invalid wire_type");
+    }
+}
+
+static inline bool
+pbfast_bool(pbfast_cursor_t *c, const pb_byte_t *end, bool *dest)
+{
+  uint32_t value;
+  if (!pbfast_varint32(c, end, &value))
+    return false;
+  *dest = (value != 0);
+  return true;
+}
+
+static inline bool
+pbfast_uint64(pbfast_cursor_t *c, const pb_byte_t *end, uint64_t *dest)
+{
+  return pbfast_varint64(c, end, dest);
+}
+
+static inline bool
+pbfast_int64(pbfast_cursor_t *c, const pb_byte_t *end, int64_t *dest)
+{
+  uint64_t value;
+  if (!pbfast_varint64(c, end, &value))
+    return false;
+  *dest = (int64_t)value;
+  return true;
+}
+
+static inline bool
+pbfast_uint32(pbfast_cursor_t *c, const pb_byte_t *end, uint32_t *dest)
+{
+  uint64_t value;
+  if (!pbfast_varint64(c, end, &value))
+    return false;
+  if (value > UINT32_MAX)
+    return pbfast_fail(c, "integer too large");
+  *dest = (uint32_t)value;
+  return true;
+}
+
+/* Negative int32 values may be encoded in 5 or 10 bytes(nanopb issue 97) */
+static inline bool
+pbfast_int32(pbfast_cursor_t *c, const pb_byte_t *end, int32_t *dest)
+{
+  uint64_t value;
+  if (!pbfast_varint64(c, end, &value))
+    return false;
+  *dest = (int32_t)value;
+  return true;
+}
+
+static inline bool
+pbfast_sint64(pbfast_cursor_t *c, const pb_byte_t *end, int64_t *dest)
+{
+  uint64_t value;
+  if (!pbfast_varint64(c, end, &value))
+    return false;
+  *dest = (value & 1) ? (int64_t)(~(value >> 1)) : (int64_t)(value >> 1);
+  return true;
+}
+
+static inline bool
+pbfast_sint32(pbfast_cursor_t *c, const pb_byte_t *end, int32_t *dest)
+{
+  int64_t value;
+  if (!pbfast_sint64(c, end, &value))
+    return false;
+  if (value < INT32_MIN || value > INT32_MAX)
+    return pbfast_fail(c, "integer too large");
+  *dest = (int32_t)value;
+  return true;
+}
+
+static inline bool
+pbfast_fixed32(pbfast_cursor_t *c, const pb_byte_t *end, void *dest)
+{
+  if (end - c->pos < 4)
+    return pbfast_fail(c, "end-of-stream");
+#if defined(PB_LITTLE_ENDIAN_8BIT) && PB_LITTLE_ENDIAN_8BIT == 1
+  memcpy(dest, c->pos, 4);
+#else
+  uint32_t v = (uint32_t)c->pos[0] | ((uint32_t)c->pos[1] << 8)
+               | ((uint32_t)c->pos[2] << 16) | ((uint32_t)c->pos[3] << 24);
+  memcpy(dest, &v, 4);
+#endif
+  c->pos += 4;
+  return true;
+}
+
+static inline bool
+pbfast_fixed64(pbfast_cursor_t *c, const pb_byte_t *end, void *dest)
+{
+  if (end - c->pos < 8)
+    return pbfast_fail(c, "end-of-stream");
+#if defined(PB_LITTLE_ENDIAN_8BIT) && PB_LITTLE_ENDIAN_8BIT == 1
+  memcpy(dest, c->pos, 8);
+#else
+  uint64_t v = 0;
+  for (int i = 7; i >= 0; i--)
+    v = (v << 8) | c->pos[i];
+  memcpy(dest, &v, 8);
+#endif
+  c->pos += 8;
+  return true;
+}
+
+/* decode_callback_field(): hand the field to the message's field callback
+ * (pb_default_field_callback calls the pb_callback_t stored in msg) */
+static bool
+pbfast_callback(pbfast_cursor_t *c,
+                 const pb_byte_t *end,
+                 uint32_t key,
+                 const pb_msgdesc_t *desc,
+                 void *msg)
+{
+  pb_field_iter_t iter;
+  pb_istream_t sub;
+
+  if (!pb_field_iter_begin(&iter, desc, msg)
+      || !pb_field_iter_find(&iter, key >> 3))
+    return pbfast_fail(c, "invalid field descriptor");
+
+  if ((key & 7) == PB_WT_STRING)
+    {
+      const pb_byte_t *sub_end;
+      size_t prev_bytes_left;
+
+      if (!pbfast_length(c, end, &sub_end))
+        return false;
+
+      sub = pb_istream_from_buffer(c->pos, (size_t)(sub_end - c->pos));
+      do
+        {
+          prev_bytes_left = sub.bytes_left;
+          if (!desc->field_callback(&sub, NULL, &iter))
+            {
+#ifndef PB_NO_ERRMSG
+              if (sub.errmsg)
+                return pbfast_fail(c, sub.errmsg);
+#endif
+              return pbfast_fail(c, "callback failed");
+            }
+        }
+      while (sub.bytes_left > 0 && sub.bytes_left < prev_bytes_left);
+
+      c->pos = sub_end;
+      return true;
+    }
+
+  /* Scalars are passed as a substream of their raw bytes */
+  const pb_byte_t *start = c->pos;
+  switch (key & 7)
+    {
+    case PB_WT_VARINT:
+      do
+        {
+          if (c->pos - start >= 10)
+            return pbfast_fail(c, "varint overflow");
+          if (c->pos >= end)
+            return pbfast_fail(c, "end-of-stream");
+        }
+      while (*c->pos++ & 0x80);
+      break;
+    case PB_WT_64BIT:
+    case PB_WT_32BIT:
+      {
+        size_t size = ((key & 7) == PB_WT_64BIT) ? 8 : 4;
+        if ((size_t)(end - c->pos) < size)
+          return pbfast_fail(c, "end-of-stream");
+        c->pos += size;
+        break;
+      }
+    default:
+      return pbfast_fail(c, "invalid wire_type");
+    }
+
+  sub = pb_istream_from_buffer(start, (size_t)(c->pos - start));
+  return desc->field_callback(&sub, NULL, &iter);
+}
+
+static bool
+pbfast_begin(pb_istream_t *stream,
+              pbfast_cursor_t *c,
+              const pb_byte_t **end)
+{
+#ifndef PB_BUFFER_ONLY
+  pb_istream_t probe = pb_istream_from_buffer(NULL, 0);
+  if (stream->callback != probe.callback)
+    PB_RETURN_ERROR(stream, "not a buffer stream");
+#endif
+  c->pos    = (const pb_byte_t *)stream->state;
+  c->errmsg = NULL;
+  *end      = c->pos + stream->bytes_left;
+  return true;
+}
+
+static bool
+pbfast_end(pb_istream_t *stream,
+            const pbfast_cursor_t *c,
+            const pb_byte_t *end,
+            bool status)
+{
+  stream->state      = (void *)(uintptr_t)c->pos;
+  stream->bytes_left = (size_t)(end - c->pos);
+  if (!status)
+    PB_RETURN_ERROR(stream, c->errmsg ? c->errmsg : "callback failed");
+  return true;
+}
+
+_Static_assert(sizeof(((ser_JonGUIState *)0)->state_source) == 4,
+                "ser_JonGUIState.state_source: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataSystem *)0)->loc) == 4,
+                "ser_JonGuiDataSystem.loc: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataSystem *)0)->accumulator_state) == 4,
+                "ser_JonGuiDataSystem.accumulator_state: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataSystem *)0)->ext_bat_status) == 4,
+                "ser_JonGuiDataSystem.ext_bat_status: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataLrf *)0)->pointer_mode) == 4,
+                "ser_JonGuiDataLrf.pointer_mode: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataTarget *)0)->observer_fix_type) == 4,
+                "ser_JonGuiDataTarget.observer_fix_type: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataGps *)0)->fix_type) == 4,
+                "ser_JonGuiDataGps.fix_type: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataRotary *)0)->mode) == 4,
+                "ser_JonGuiDataRotary.mode: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCameraDay *)0)->fx_mode) == 4,
+                "ser_JonGuiDataCameraDay.fx_mode: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCameraHeat *)0)->agc_mode) == 4,
+                "ser_JonGuiDataCameraHeat.agc_mode: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCameraHeat *)0)->filter) == 4,
+                "ser_JonGuiDataCameraHeat.filter: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCameraHeat *)0)->fx_mode) == 4,
+                "ser_JonGuiDataCameraHeat.fx_mode: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCompassCalibration *)0)->status) == 4,
+                "ser_JonGuiDataCompassCalibration.status: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataRecOsd *)0)->screen) == 4,
+                "ser_JonGuiDataRecOsd.screen: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataPower *)0)->accumulator_state) == 4,
+                "ser_JonGuiDataPower.accumulator_state: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataPower *)0)->ext_bat_status) == 4,
+                "ser_JonGuiDataPower.ext_bat_status: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCV *)0)->autofocus_state_day) == 4,
+                "ser_JonGuiDataCV.autofocus_state_day: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCV *)0)->autofocus_state_heat) == 4,
+                "ser_JonGuiDataCV.autofocus_state_heat: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCV *)0)->bridge_status) == 4,
+                "ser_JonGuiDataCV.bridge_status: 32-bit enum expected");
+_Static_assert(sizeof(((ser_JonGuiDataCV *)0)->last_exit_reason) == 4,
+                "ser_JonGuiDataCV.last_exit_reason: 32-bit enum expected");
+_Static_assert(sizeof(((ser_ObjectDetectionsDay *)0)->status) == 4,
+                "ser_ObjectDetectionsDay.status: 32-bit enum expected");
+_Static_assert(sizeof(((ser_ObjectDetectionsHeat *)0)->status) == 4,
+                "ser_ObjectDetectionsHeat.status: 32-bit enum expected");
+_Static_assert(sizeof(((ser_SamTrackingDay *)0)->status) == 4,
+                "ser_SamTrackingDay.status: 32-bit enum expected");
+_Static_assert(sizeof(((ser_SamTrackingDay *)0)->state) == 4,
+                "ser_SamTrackingDay.state: 32-bit enum expected");
+_Static_assert(sizeof(((ser_SamTrackingHeat *)0)->status) == 4,
+                "ser_SamTrackingHeat.status: 32-bit enum expected");
+_Static_assert(sizeof(((ser_SamTrackingHeat *)0)->state) == 4,
+                "ser_SamTrackingHeat.state: 32-bit enum expected");
+
+static bool
+pbfast_msg_ser_JonGUIState(pbfast_cursor_t *c,
+                           const pb_byte_t *end,
+                           ser_JonGUIState *msg,
+                           uint32_t fields);
+static bool
+pbfast_msg_ser_JonGuiDataSystem(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataSystem *msg);
+static bool
+pbfast_msg_ser_JonGuiDataMeteo(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_JonGuiDataMeteo *msg);
+static bool
+pbfast_msg_ser_JonGuiDataLrf(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_JonGuiDataLrf *msg);
+static bool
+pbfast_msg_ser_JonGuiDataTarget(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataTarget *msg);
+static bool
+pbfast_msg_ser_RgbColor(pbfast_cursor_t *c,
+                        const pb_byte_t *end,
+                        ser_RgbColor *msg);
+static bool
+pbfast_msg_ser_JonGuiDataTime(pbfast_cursor_t *c,
+                              const pb_byte_t *end,
+                              ser_JonGuiDataTime *msg);
+static bool
+pbfast_msg_ser_JonGuiDataGps(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_JonGuiDataGps *msg);
+static bool
+pbfast_msg_ser_JonGuiDataCompass(pbfast_cursor_t *c,
+                                 const pb_byte_t *end,
+                                 ser_JonGuiDataCompass *msg);
+static bool
+pbfast_msg_ser_JonGuiDataRotary(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataRotary *msg);
+static bool
+pbfast_msg_ser_ScanNode(pbfast_cursor_t *c,
+                        const pb_byte_t *end,
+                        ser_ScanNode *msg);
+static bool
+pbfast_msg_ser_JonGuiDataCameraDay(pbfast_cursor_t *c,
+                                   const pb_byte_t *end,
+                                   ser_JonGuiDataCameraDay *msg);
+static bool
+pbfast_msg_ser_JonGuiDataCameraHeat(pbfast_cursor_t *c,
+                                    const pb_byte_t *end,
+                                    ser_JonGuiDataCameraHeat *msg);
+static bool
+pbfast_msg_ser_JonGuiDataCompassCalibration(pbfast_cursor_t *c,
+                                            const pb_byte_t *end,
+                                            ser_JonGuiDataCompassCalibration *msg);
+static bool
+pbfast_msg_ser_JonGuiDataRecOsd(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataRecOsd *msg);
+static bool
+pbfast_msg_ser_JonGuiDataActualSpaceTime(pbfast_cursor_t *c,
+                                         const pb_byte_t *end,
+                                         ser_JonGuiDataActualSpaceTime *msg);
+static bool
+pbfast_msg_ser_JonGuiDataPower(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_JonGuiDataPower *msg);
+static bool
+pbfast_msg_ser_JonGuiDataPowerModule(pbfast_cursor_t *c,
+                                     const pb_byte_t *end,
+                                     ser_JonGuiDataPowerModule *msg);
+static bool
+pbfast_msg_ser_JonGuiDataCV(pbfast_cursor_t *c,
+                            const pb_byte_t *end,
+                            ser_JonGuiDataCV *msg);
+static bool
+pbfast_msg_ser_JonGuiDataROI(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_JonGuiDataROI *msg);
+static bool
+pbfast_msg_ser_JonGuiDataSharpness(pbfast_cursor_t *c,
+                                   const pb_byte_t *end,
+                                   ser_JonGuiDataSharpness *msg);
+static bool
+pbfast_msg_ser_JonGuiDataTransform3D(pbfast_cursor_t *c,
+                                     const pb_byte_t *end,
+                                     ser_JonGuiDataTransform3D *msg);
+static bool
+pbfast_msg_ser_JonGuiDataVector3(pbfast_cursor_t *c,
+                                 const pb_byte_t *end,
+                                 ser_JonGuiDataVector3 *msg);
+static bool
+pbfast_msg_ser_JonGuiDataQuaternion(pbfast_cursor_t *c,
+                                    const pb_byte_t *end,
+                                    ser_JonGuiDataQuaternion *msg);
+static bool
+pbfast_msg_ser_JonGuiDataPMU(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_JonGuiDataPMU *msg);
+static bool
+pbfast_msg_ser_JonGuiDataHeater(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataHeater *msg);
+static bool
+pbfast_msg_ser_JonGuiDataHeaterChannelStatus(pbfast_cursor_t *c,
+                                             const pb_byte_t *end,
+                                             ser_JonGuiDataHeaterChannelStatus *msg);
+static bool
+pbfast_msg_ser_JonOpaquePayload(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonOpaquePayload *msg,
+                                uint32_t fields);
+static bool
+pbfast_msg_ser_JonOpaquePayloadVersion(pbfast_cursor_t *c,
+                                       const pb_byte_t *end,
+                                       ser_JonOpaquePayloadVersion *msg);
+static bool
+pbfast_msg_ser_OsdClientMetadata(pbfast_cursor_t *c,
+                                 const pb_byte_t *end,
+                                 ser_OsdClientMetadata *msg,
+                                 uint32_t fields);
+static bool
+pbfast_msg_ser_CvMeta(pbfast_cursor_t *c,
+                      const pb_byte_t *end,
+                      ser_CvMeta *msg,
+                      uint32_t fields);
+static bool
+pbfast_msg_ser_CvChannelMeta(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_CvChannelMeta *msg);
+static bool
+pbfast_msg_ser_ObjectDetectionsDay(pbfast_cursor_t *c,
+                                   const pb_byte_t *end,
+                                   ser_ObjectDetectionsDay *msg,
+                                   uint32_t fields);
+static bool
+pbfast_msg_ser_DetectionFrameMeta(pbfast_cursor_t *c,
+                                  const pb_byte_t *end,
+                                  ser_DetectionFrameMeta *msg);
+static bool
+pbfast_msg_ser_DetectionConfig(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_DetectionConfig *msg);
+static bool
+pbfast_msg_ser_ObjectDetectionsHeat(pbfast_cursor_t *c,
+                                    const pb_byte_t *end,
+                                    ser_ObjectDetectionsHeat *msg,
+                                    uint32_t fields);
+static bool
+pbfast_msg_ser_ObjectDetection(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_ObjectDetection *msg,
+                               uint32_t fields);
+static bool
+pbfast_msg_ser_SamTrackingDay(pbfast_cursor_t *c,
+                              const pb_byte_t *end,
+                              ser_SamTrackingDay *msg,
+                              uint32_t fields);
+static bool
+pbfast_msg_ser_SamTrackingFrameMeta(pbfast_cursor_t *c,
+                                    const pb_byte_t *end,
+                                    ser_SamTrackingFrameMeta *msg);
+static bool
+pbfast_msg_ser_SamTrackingKalmanState(pbfast_cursor_t *c,
+                                      const pb_byte_t *end,
+                                      ser_SamTrackingKalmanState *msg);
+static bool
+pbfast_msg_ser_SamTrackingHeat(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_SamTrackingHeat *msg,
+                               uint32_t fields);
+
+static inline bool
+pbfast_known_ser_JonGUIState(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataSystem(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataMeteo(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataLrf(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataTarget(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_RgbColor(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataTime(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataGps(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataCompass(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataRotary(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_ScanNode(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataCameraDay(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataCameraHeat(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataCompassCalibration(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataRecOsd(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataActualSpaceTime(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataPower(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataPowerModule(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataCV(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 30:
+    case 31:
+    case 32:
+    case 33:
+    case 40:
+    case 41:
+    case 42:
+    case 43:
+    case 50:
+    case 51:
+    case 52:
+    case 53:
+    case 60:
+    case 61:
+    case 70:
+    case 71:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataROI(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataSharpness(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataTransform3D(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataVector3(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataQuaternion(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataPMU(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataHeater(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonGuiDataHeaterChannelStatus(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonOpaquePayload(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 2:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_JonOpaquePayloadVersion(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_OsdClientMetadata(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_CvMeta(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_CvChannelMeta(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_ObjectDetectionsDay(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_DetectionFrameMeta(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_DetectionConfig(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_ObjectDetectionsHeat(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_ObjectDetection(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_SamTrackingDay(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_SamTrackingFrameMeta(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_SamTrackingKalmanState(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static inline bool
+pbfast_known_ser_SamTrackingHeat(uint32_t tag)
+{
+  switch (tag)
+    {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+      return true;
+    default:
+      return false;
+    }
+}
+
+static bool
+pbfast_msg_ser_JonGUIState(pbfast_cursor_t *c,
+                           const pb_byte_t *end,
+                           ser_JonGUIState *msg,
+                           uint32_t fields)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* protocol_version */
+          if (!pbfast_uint32(c, end, &msg->protocol_version))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* system_monotonic_time_us */
+          if (!pbfast_uint64(c, end, &msg->system_monotonic_time_us))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* state_source */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->state_source))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* frame_pts_day_ns */
+          if (!pbfast_uint64(c, end, &msg->frame_pts_day_ns))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_VARINT): /* frame_pts_heat_ns */
+          if (!pbfast_uint64(c, end, &msg->frame_pts_heat_ns))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* frame_monotonic_day_us */
+          if (!pbfast_uint64(c, end, &msg->frame_monotonic_day_us))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* frame_monotonic_heat_us */
+          if (!pbfast_uint64(c, end, &msg->frame_monotonic_heat_us))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_STRING): /* system */
+          msg->has_system = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataSystem(c, sub_end, &msg->system))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_STRING): /* meteo_internal */
+          msg->has_meteo_internal = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo_internal))
+            return false;
+          break;
+        case PBFAST_KEY(15, PB_WT_STRING): /* lrf */
+          msg->has_lrf = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataLrf(c, sub_end, &msg->lrf))
+            return false;
+          break;
+        case PBFAST_KEY(16, PB_WT_STRING): /* time */
+          msg->has_time = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataTime(c, sub_end, &msg->time))
+            return false;
+          break;
+        case PBFAST_KEY(17, PB_WT_STRING): /* gps */
+          msg->has_gps = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataGps(c, sub_end, &msg->gps))
+            return false;
+          break;
+        case PBFAST_KEY(18, PB_WT_STRING): /* compass */
+          msg->has_compass = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataCompass(c, sub_end, &msg->compass))
+            return false;
+          break;
+        case PBFAST_KEY(19, PB_WT_STRING): /* rotary */
+          msg->has_rotary = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataRotary(c, sub_end, &msg->rotary))
+            return false;
+          break;
+        case PBFAST_KEY(20, PB_WT_STRING): /* camera_day */
+          msg->has_camera_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataCameraDay(c, sub_end, &msg->camera_day))
+            return false;
+          break;
+        case PBFAST_KEY(21, PB_WT_STRING): /* camera_heat */
+          msg->has_camera_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataCameraHeat(c, sub_end, &msg->camera_heat))
+            return false;
+          break;
+        case PBFAST_KEY(22, PB_WT_STRING): /* compass_calibration */
+          msg->has_compass_calibration = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataCompassCalibration(c, sub_end, &msg->compass_calibration))
+            return false;
+          break;
+        case PBFAST_KEY(23, PB_WT_STRING): /* rec_osd */
+          msg->has_rec_osd = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataRecOsd(c, sub_end, &msg->rec_osd))
+            return false;
+          break;
+        case PBFAST_KEY(25, PB_WT_STRING): /* actual_space_time */
+          msg->has_actual_space_time = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataActualSpaceTime(c, sub_end, &msg->actual_space_time))
+            return false;
+          break;
+        case PBFAST_KEY(26, PB_WT_STRING): /* power */
+          msg->has_power = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPower(c, sub_end, &msg->power))
+            return false;
+          break;
+        case PBFAST_KEY(27, PB_WT_STRING): /* cv */
+          msg->has_cv = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataCV(c, sub_end, &msg->cv))
+            return false;
+          break;
+        case PBFAST_KEY(28, PB_WT_STRING): /* pmu */
+          msg->has_pmu = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPMU(c, sub_end, &msg->pmu))
+            return false;
+          break;
+        case PBFAST_KEY(29, PB_WT_STRING): /* heater */
+          msg->has_heater = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataHeater(c, sub_end, &msg->heater))
+            return false;
+          break;
+        default:
+          switch (key >> 3)
+            {
+            case 8: /* opaque_payloads */
+              if (msg->opaque_payloads.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_JonGUIState_msg, msg))
+                return false;
+              break;
+            default:
+              if (pbfast_known_ser_JonGUIState(key >> 3))
+                return pbfast_fail(c, "wrong wire type");
+              if (!pbfast_skip(c, end, key))
+                return false;
+              break;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataSystem(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataSystem *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* cpu_temperature */
+          if (!pbfast_fixed64(c, end, &msg->cpu_temperature))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* gpu_temperature */
+          if (!pbfast_fixed64(c, end, &msg->gpu_temperature))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* gpu_load */
+          if (!pbfast_fixed64(c, end, &msg->gpu_load))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* cpu_load */
+          if (!pbfast_fixed64(c, end, &msg->cpu_load))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* power_consumption */
+          if (!pbfast_fixed64(c, end, &msg->power_consumption))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* loc */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->loc))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* cur_video_rec_dir_year */
+          if (!pbfast_int32(c, end, &msg->cur_video_rec_dir_year))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_VARINT): /* cur_video_rec_dir_month */
+          if (!pbfast_int32(c, end, &msg->cur_video_rec_dir_month))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_VARINT): /* cur_video_rec_dir_day */
+          if (!pbfast_int32(c, end, &msg->cur_video_rec_dir_day))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_VARINT): /* cur_video_rec_dir_hour */
+          if (!pbfast_int32(c, end, &msg->cur_video_rec_dir_hour))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_VARINT): /* cur_video_rec_dir_minute */
+          if (!pbfast_int32(c, end, &msg->cur_video_rec_dir_minute))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_VARINT): /* cur_video_rec_dir_second */
+          if (!pbfast_int32(c, end, &msg->cur_video_rec_dir_second))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_VARINT): /* rec_enabled */
+          if (!pbfast_bool(c, end, &msg->rec_enabled))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_VARINT): /* important_rec_enabled */
+          if (!pbfast_bool(c, end, &msg->important_rec_enabled))
+            return false;
+          break;
+        case PBFAST_KEY(15, PB_WT_VARINT): /* low_disk_space */
+          if (!pbfast_bool(c, end, &msg->low_disk_space))
+            return false;
+          break;
+        case PBFAST_KEY(16, PB_WT_VARINT): /* no_disk_space */
+          if (!pbfast_bool(c, end, &msg->no_disk_space))
+            return false;
+          break;
+        case PBFAST_KEY(17, PB_WT_VARINT): /* disk_space */
+          if (!pbfast_int32(c, end, &msg->disk_space))
+            return false;
+          break;
+        case PBFAST_KEY(18, PB_WT_VARINT): /* tracking */
+          if (!pbfast_bool(c, end, &msg->tracking))
+            return false;
+          break;
+        case PBFAST_KEY(19, PB_WT_VARINT): /* vampire_mode */
+          if (!pbfast_bool(c, end, &msg->vampire_mode))
+            return false;
+          break;
+        case PBFAST_KEY(20, PB_WT_VARINT): /* stabilization_mode */
+          if (!pbfast_bool(c, end, &msg->stabilization_mode))
+            return false;
+          break;
+        case PBFAST_KEY(21, PB_WT_VARINT): /* geodesic_mode */
+          if (!pbfast_bool(c, end, &msg->geodesic_mode))
+            return false;
+          break;
+        case PBFAST_KEY(22, PB_WT_VARINT): /* cv_dumping */
+          if (!pbfast_bool(c, end, &msg->cv_dumping))
+            return false;
+          break;
+        case PBFAST_KEY(23, PB_WT_VARINT): /* recognition_mode */
+          if (!pbfast_bool(c, end, &msg->recognition_mode))
+            return false;
+          break;
+        case PBFAST_KEY(24, PB_WT_VARINT): /* accumulator_state */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->accumulator_state))
+            return false;
+          break;
+        case PBFAST_KEY(25, PB_WT_VARINT): /* ext_bat_capacity */
+          if (!pbfast_int32(c, end, &msg->ext_bat_capacity))
+            return false;
+          break;
+        case PBFAST_KEY(26, PB_WT_VARINT): /* ext_bat_status */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->ext_bat_status))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataSystem(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataMeteo(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_JonGuiDataMeteo *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* temperature */
+          if (!pbfast_fixed64(c, end, &msg->temperature))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* humidity */
+          if (!pbfast_fixed64(c, end, &msg->humidity))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* pressure */
+          if (!pbfast_fixed64(c, end, &msg->pressure))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataMeteo(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataLrf(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_JonGuiDataLrf *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* is_scanning */
+          if (!pbfast_bool(c, end, &msg->is_scanning))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* is_measuring */
+          if (!pbfast_bool(c, end, &msg->is_measuring))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* measure_id */
+          if (!pbfast_int32(c, end, &msg->measure_id))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_STRING): /* target */
+          msg->has_target = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataTarget(c, sub_end, &msg->target))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_VARINT): /* pointer_mode */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->pointer_mode))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* fogModeEnabled */
+          if (!pbfast_bool(c, end, &msg->fogModeEnabled))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* is_refining */
+          if (!pbfast_bool(c, end, &msg->is_refining))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_VARINT): /* is_continuous_measuring */
+          if (!pbfast_bool(c, end, &msg->is_continuous_measuring))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_VARINT): /* is_started */
+          if (!pbfast_bool(c, end, &msg->is_started))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_STRING): /* meteo */
+          msg->has_meteo = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_VARINT): /* scan_mode */
+          if (!pbfast_int32(c, end, &msg->scan_mode))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataLrf(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataTarget(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataTarget *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* timestamp */
+          if (!pbfast_int64(c, end, &msg->timestamp))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* target_longitude */
+          if (!pbfast_fixed64(c, end, &msg->target_longitude))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* target_latitude */
+          if (!pbfast_fixed64(c, end, &msg->target_latitude))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* target_altitude */
+          if (!pbfast_fixed64(c, end, &msg->target_altitude))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* observer_longitude */
+          if (!pbfast_fixed64(c, end, &msg->observer_longitude))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_64BIT): /* observer_latitude */
+          if (!pbfast_fixed64(c, end, &msg->observer_latitude))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_64BIT): /* observer_altitude */
+          if (!pbfast_fixed64(c, end, &msg->observer_altitude))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_64BIT): /* observer_azimuth */
+          if (!pbfast_fixed64(c, end, &msg->observer_azimuth))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_64BIT): /* observer_elevation */
+          if (!pbfast_fixed64(c, end, &msg->observer_elevation))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_64BIT): /* observer_bank */
+          if (!pbfast_fixed64(c, end, &msg->observer_bank))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_64BIT): /* distance_2d */
+          if (!pbfast_fixed64(c, end, &msg->distance_2d))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_64BIT): /* distance_3b */
+          if (!pbfast_fixed64(c, end, &msg->distance_3b))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_VARINT): /* observer_fix_type */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->observer_fix_type))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_VARINT): /* session_id */
+          if (!pbfast_int32(c, end, &msg->session_id))
+            return false;
+          break;
+        case PBFAST_KEY(15, PB_WT_VARINT): /* target_id */
+          if (!pbfast_int32(c, end, &msg->target_id))
+            return false;
+          break;
+        case PBFAST_KEY(16, PB_WT_STRING): /* target_color */
+          msg->has_target_color = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_RgbColor(c, sub_end, &msg->target_color))
+            return false;
+          break;
+        case PBFAST_KEY(17, PB_WT_VARINT): /* type */
+          if (!pbfast_uint32(c, end, &msg->type))
+            return false;
+          break;
+        case PBFAST_KEY(18, PB_WT_VARINT): /* uuid_part1 */
+          if (!pbfast_int32(c, end, &msg->uuid_part1))
+            return false;
+          break;
+        case PBFAST_KEY(19, PB_WT_VARINT): /* uuid_part2 */
+          if (!pbfast_int32(c, end, &msg->uuid_part2))
+            return false;
+          break;
+        case PBFAST_KEY(20, PB_WT_VARINT): /* uuid_part3 */
+          if (!pbfast_int32(c, end, &msg->uuid_part3))
+            return false;
+          break;
+        case PBFAST_KEY(21, PB_WT_VARINT): /* uuid_part4 */
+          if (!pbfast_int32(c, end, &msg->uuid_part4))
+            return false;
+          break;
+        case PBFAST_KEY(22, PB_WT_64BIT): /* distance_c */
+          if (!pbfast_fixed64(c, end, &msg->distance_c))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataTarget(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_RgbColor(pbfast_cursor_t *c,
+                        const pb_byte_t *end,
+                        ser_RgbColor *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* red */
+          if (!pbfast_uint32(c, end, &msg->red))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* green */
+          if (!pbfast_uint32(c, end, &msg->green))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* blue */
+          if (!pbfast_uint32(c, end, &msg->blue))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_RgbColor(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataTime(pbfast_cursor_t *c,
+                              const pb_byte_t *end,
+                              ser_JonGuiDataTime *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* timestamp */
+          if (!pbfast_int64(c, end, &msg->timestamp))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* manual_timestamp */
+          if (!pbfast_int64(c, end, &msg->manual_timestamp))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* zone_id */
+          if (!pbfast_int32(c, end, &msg->zone_id))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* use_manual_time */
+          if (!pbfast_bool(c, end, &msg->use_manual_time))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataTime(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataGps(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_JonGuiDataGps *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* longitude */
+          if (!pbfast_fixed64(c, end, &msg->longitude))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* latitude */
+          if (!pbfast_fixed64(c, end, &msg->latitude))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* altitude */
+          if (!pbfast_fixed64(c, end, &msg->altitude))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* manual_longitude */
+          if (!pbfast_fixed64(c, end, &msg->manual_longitude))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* manual_latitude */
+          if (!pbfast_fixed64(c, end, &msg->manual_latitude))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_64BIT): /* manual_altitude */
+          if (!pbfast_fixed64(c, end, &msg->manual_altitude))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* fix_type */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->fix_type))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_VARINT): /* use_manual */
+          if (!pbfast_bool(c, end, &msg->use_manual))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_VARINT): /* timestamp */
+          if (!pbfast_int64(c, end, &msg->timestamp))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_VARINT): /* is_started */
+          if (!pbfast_bool(c, end, &msg->is_started))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_STRING): /* meteo */
+          msg->has_meteo = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataGps(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataCompass(pbfast_cursor_t *c,
+                                 const pb_byte_t *end,
+                                 ser_JonGuiDataCompass *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* azimuth */
+          if (!pbfast_fixed64(c, end, &msg->azimuth))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* elevation */
+          if (!pbfast_fixed64(c, end, &msg->elevation))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* bank */
+          if (!pbfast_fixed64(c, end, &msg->bank))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* offsetAzimuth */
+          if (!pbfast_fixed64(c, end, &msg->offsetAzimuth))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* offsetElevation */
+          if (!pbfast_fixed64(c, end, &msg->offsetElevation))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_64BIT): /* magneticDeclination */
+          if (!pbfast_fixed64(c, end, &msg->magneticDeclination))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* calibrating */
+          if (!pbfast_bool(c, end, &msg->calibrating))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_VARINT): /* is_started */
+          if (!pbfast_bool(c, end, &msg->is_started))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_STRING): /* meteo */
+          msg->has_meteo = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataCompass(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataRotary(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataRotary *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* azimuth */
+          if (!pbfast_fixed64(c, end, &msg->azimuth))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* azimuth_speed */
+          if (!pbfast_fixed64(c, end, &msg->azimuth_speed))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* elevation */
+          if (!pbfast_fixed64(c, end, &msg->elevation))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* elevation_speed */
+          if (!pbfast_fixed64(c, end, &msg->elevation_speed))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* platform_azimuth */
+          if (!pbfast_fixed64(c, end, &msg->platform_azimuth))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_64BIT): /* platform_elevation */
+          if (!pbfast_fixed64(c, end, &msg->platform_elevation))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_64BIT): /* platform_bank */
+          if (!pbfast_fixed64(c, end, &msg->platform_bank))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_VARINT): /* is_moving */
+          if (!pbfast_bool(c, end, &msg->is_moving))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_VARINT): /* mode */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->mode))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_VARINT): /* is_scanning */
+          if (!pbfast_bool(c, end, &msg->is_scanning))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_VARINT): /* is_scanning_paused */
+          if (!pbfast_bool(c, end, &msg->is_scanning_paused))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_VARINT): /* use_rotary_as_compass */
+          if (!pbfast_bool(c, end, &msg->use_rotary_as_compass))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_VARINT): /* scan_target */
+          if (!pbfast_int32(c, end, &msg->scan_target))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_VARINT): /* scan_target_max */
+          if (!pbfast_int32(c, end, &msg->scan_target_max))
+            return false;
+          break;
+        case PBFAST_KEY(15, PB_WT_64BIT): /* sun_azimuth */
+          if (!pbfast_fixed64(c, end, &msg->sun_azimuth))
+            return false;
+          break;
+        case PBFAST_KEY(16, PB_WT_64BIT): /* sun_elevation */
+          if (!pbfast_fixed64(c, end, &msg->sun_elevation))
+            return false;
+          break;
+        case PBFAST_KEY(17, PB_WT_STRING): /* current_scan_node */
+          msg->has_current_scan_node = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_ScanNode(c, sub_end, &msg->current_scan_node))
+            return false;
+          break;
+        case PBFAST_KEY(18, PB_WT_VARINT): /* is_started */
+          if (!pbfast_bool(c, end, &msg->is_started))
+            return false;
+          break;
+        case PBFAST_KEY(19, PB_WT_STRING): /* meteo */
+          msg->has_meteo = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo))
+            return false;
+          break;
+        case PBFAST_KEY(20, PB_WT_VARINT): /* pan_init_status */
+          if (!pbfast_int32(c, end, &msg->pan_init_status))
+            return false;
+          break;
+        case PBFAST_KEY(21, PB_WT_VARINT): /* tilt_init_status */
+          if (!pbfast_int32(c, end, &msg->tilt_init_status))
+            return false;
+          break;
+        case PBFAST_KEY(22, PB_WT_VARINT): /* capture_monotonic_us */
+          if (!pbfast_uint64(c, end, &msg->capture_monotonic_us))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataRotary(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_ScanNode(pbfast_cursor_t *c,
+                        const pb_byte_t *end,
+                        ser_ScanNode *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* index */
+          if (!pbfast_int32(c, end, &msg->index))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* DayZoomTableValue */
+          if (!pbfast_int32(c, end, &msg->DayZoomTableValue))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* HeatZoomTableValue */
+          if (!pbfast_int32(c, end, &msg->HeatZoomTableValue))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* azimuth */
+          if (!pbfast_fixed64(c, end, &msg->azimuth))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* elevation */
+          if (!pbfast_fixed64(c, end, &msg->elevation))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_64BIT): /* linger */
+          if (!pbfast_fixed64(c, end, &msg->linger))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_64BIT): /* speed */
+          if (!pbfast_fixed64(c, end, &msg->speed))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_ScanNode(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataCameraDay(pbfast_cursor_t *c,
+                                   const pb_byte_t *end,
+                                   ser_JonGuiDataCameraDay *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* focus_pos */
+          if (!pbfast_fixed64(c, end, &msg->focus_pos))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* zoom_pos */
+          if (!pbfast_fixed64(c, end, &msg->zoom_pos))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* iris_pos */
+          if (!pbfast_fixed64(c, end, &msg->iris_pos))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* infrared_filter */
+          if (!pbfast_bool(c, end, &msg->infrared_filter))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_VARINT): /* zoom_table_pos */
+          if (!pbfast_int32(c, end, &msg->zoom_table_pos))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* zoom_table_pos_max */
+          if (!pbfast_int32(c, end, &msg->zoom_table_pos_max))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* fx_mode */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->fx_mode))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_VARINT): /* auto_focus */
+          if (!pbfast_bool(c, end, &msg->auto_focus))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_VARINT): /* auto_iris */
+          if (!pbfast_bool(c, end, &msg->auto_iris))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_64BIT): /* digital_zoom_level */
+          if (!pbfast_fixed64(c, end, &msg->digital_zoom_level))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_64BIT): /* clahe_level */
+          if (!pbfast_fixed64(c, end, &msg->clahe_level))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_64BIT): /* horizontal_fov_degrees */
+          if (!pbfast_fixed64(c, end, &msg->horizontal_fov_degrees))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_64BIT): /* vertical_fov_degrees */
+          if (!pbfast_fixed64(c, end, &msg->vertical_fov_degrees))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_VARINT): /* is_started */
+          if (!pbfast_bool(c, end, &msg->is_started))
+            return false;
+          break;
+        case PBFAST_KEY(15, PB_WT_VARINT): /* auto_gain */
+          if (!pbfast_bool(c, end, &msg->auto_gain))
+            return false;
+          break;
+        case PBFAST_KEY(16, PB_WT_STRING): /* meteo */
+          msg->has_meteo = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo))
+            return false;
+          break;
+        case PBFAST_KEY(17, PB_WT_64BIT): /* sensor_gain */
+          msg->has_sensor_gain = true;
+          if (!pbfast_fixed64(c, end, &msg->sensor_gain))
+            return false;
+          break;
+        case PBFAST_KEY(18, PB_WT_64BIT): /* exposure */
+          msg->has_exposure = true;
+          if (!pbfast_fixed64(c, end, &msg->exposure))
+            return false;
+          break;
+        case PBFAST_KEY(19, PB_WT_VARINT): /* capture_monotonic_us */
+          if (!pbfast_uint64(c, end, &msg->capture_monotonic_us))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataCameraDay(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataCameraHeat(pbfast_cursor_t *c,
+                                    const pb_byte_t *end,
+                                    ser_JonGuiDataCameraHeat *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* zoom_pos */
+          if (!pbfast_fixed64(c, end, &msg->zoom_pos))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* agc_mode */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->agc_mode))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* filter */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->filter))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* auto_focus */
+          if (!pbfast_bool(c, end, &msg->auto_focus))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_VARINT): /* zoom_table_pos */
+          if (!pbfast_int32(c, end, &msg->zoom_table_pos))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* zoom_table_pos_max */
+          if (!pbfast_int32(c, end, &msg->zoom_table_pos_max))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* dde_level */
+          if (!pbfast_int32(c, end, &msg->dde_level))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_VARINT): /* dde_enabled */
+          if (!pbfast_bool(c, end, &msg->dde_enabled))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_VARINT): /* fx_mode */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->fx_mode))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_64BIT): /* digital_zoom_level */
+          if (!pbfast_fixed64(c, end, &msg->digital_zoom_level))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_64BIT): /* clahe_level */
+          if (!pbfast_fixed64(c, end, &msg->clahe_level))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_64BIT): /* horizontal_fov_degrees */
+          if (!pbfast_fixed64(c, end, &msg->horizontal_fov_degrees))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_64BIT): /* vertical_fov_degrees */
+          if (!pbfast_fixed64(c, end, &msg->vertical_fov_degrees))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_VARINT): /* is_started */
+          if (!pbfast_bool(c, end, &msg->is_started))
+            return false;
+          break;
+        case PBFAST_KEY(15, PB_WT_STRING): /* meteo */
+          msg->has_meteo = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo))
+            return false;
+          break;
+        case PBFAST_KEY(16, PB_WT_VARINT): /* capture_monotonic_us */
+          if (!pbfast_uint64(c, end, &msg->capture_monotonic_us))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataCameraHeat(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataCompassCalibration(pbfast_cursor_t *c,
+                                            const pb_byte_t *end,
+                                            ser_JonGuiDataCompassCalibration *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* stage */
+          if (!pbfast_uint32(c, end, &msg->stage))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* final_stage */
+          if (!pbfast_uint32(c, end, &msg->final_stage))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* target_azimuth */
+          if (!pbfast_fixed64(c, end, &msg->target_azimuth))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* target_elevation */
+          if (!pbfast_fixed64(c, end, &msg->target_elevation))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* target_bank */
+          if (!pbfast_fixed64(c, end, &msg->target_bank))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* status */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->status))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataCompassCalibration(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataRecOsd(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataRecOsd *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* screen */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->screen))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* heat_osd_enabled */
+          if (!pbfast_bool(c, end, &msg->heat_osd_enabled))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* day_osd_enabled */
+          if (!pbfast_bool(c, end, &msg->day_osd_enabled))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* heat_crosshair_offset_horizontal */
+          if (!pbfast_int32(c, end, &msg->heat_crosshair_offset_horizontal))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_VARINT): /* heat_crosshair_offset_vertical */
+          if (!pbfast_int32(c, end, &msg->heat_crosshair_offset_vertical))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* day_crosshair_offset_horizontal */
+          if (!pbfast_int32(c, end, &msg->day_crosshair_offset_horizontal))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* day_crosshair_offset_vertical */
+          if (!pbfast_int32(c, end, &msg->day_crosshair_offset_vertical))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataRecOsd(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataActualSpaceTime(pbfast_cursor_t *c,
+                                         const pb_byte_t *end,
+                                         ser_JonGuiDataActualSpaceTime *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* azimuth */
+          if (!pbfast_fixed64(c, end, &msg->azimuth))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* elevation */
+          if (!pbfast_fixed64(c, end, &msg->elevation))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* bank */
+          if (!pbfast_fixed64(c, end, &msg->bank))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* latitude */
+          if (!pbfast_fixed64(c, end, &msg->latitude))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* longitude */
+          if (!pbfast_fixed64(c, end, &msg->longitude))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_64BIT): /* altitude */
+          if (!pbfast_fixed64(c, end, &msg->altitude))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* timestamp */
+          if (!pbfast_int64(c, end, &msg->timestamp))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataActualSpaceTime(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataPower(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_JonGuiDataPower *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_STRING): /* s0 */
+          msg->has_s0 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPowerModule(c, sub_end, &msg->s0))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_STRING): /* s1 */
+          msg->has_s1 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPowerModule(c, sub_end, &msg->s1))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_STRING): /* s2 */
+          msg->has_s2 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPowerModule(c, sub_end, &msg->s2))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_STRING): /* s3 */
+          msg->has_s3 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPowerModule(c, sub_end, &msg->s3))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_STRING): /* s4 */
+          msg->has_s4 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPowerModule(c, sub_end, &msg->s4))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_STRING): /* s5 */
+          msg->has_s5 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPowerModule(c, sub_end, &msg->s5))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_STRING): /* s6 */
+          msg->has_s6 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPowerModule(c, sub_end, &msg->s6))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_STRING): /* s7 */
+          msg->has_s7 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataPowerModule(c, sub_end, &msg->s7))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_VARINT): /* accumulator_state */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->accumulator_state))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_VARINT): /* ext_bat_capacity */
+          if (!pbfast_int32(c, end, &msg->ext_bat_capacity))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_VARINT): /* ext_bat_status */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->ext_bat_status))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_STRING): /* meteo */
+          msg->has_meteo = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataPower(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataPowerModule(pbfast_cursor_t *c,
+                                     const pb_byte_t *end,
+                                     ser_JonGuiDataPowerModule *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* voltage */
+          if (!pbfast_fixed64(c, end, &msg->voltage))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* current */
+          if (!pbfast_fixed64(c, end, &msg->current))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* power */
+          if (!pbfast_fixed64(c, end, &msg->power))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* is_on */
+          if (!pbfast_bool(c, end, &msg->is_on))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_VARINT): /* has_alarm */
+          if (!pbfast_bool(c, end, &msg->has_alarm))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataPowerModule(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataCV(pbfast_cursor_t *c,
+                            const pb_byte_t *end,
+                            ser_JonGuiDataCV *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* autofocus_state_day */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->autofocus_state_day))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* sharpness_day */
+          if (!pbfast_fixed64(c, end, &msg->sharpness_day))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* best_sharpness_day */
+          if (!pbfast_fixed64(c, end, &msg->best_sharpness_day))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* sweep_progress_day */
+          if (!pbfast_int32(c, end, &msg->sweep_progress_day))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* best_focus_pos_day */
+          if (!pbfast_fixed64(c, end, &msg->best_focus_pos_day))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_VARINT): /* autofocus_state_heat */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->autofocus_state_heat))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_64BIT): /* sharpness_heat */
+          if (!pbfast_fixed64(c, end, &msg->sharpness_heat))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_64BIT): /* best_sharpness_heat */
+          if (!pbfast_fixed64(c, end, &msg->best_sharpness_heat))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_VARINT): /* sweep_progress_heat */
+          if (!pbfast_int32(c, end, &msg->sweep_progress_heat))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_64BIT): /* best_focus_pos_heat */
+          if (!pbfast_fixed64(c, end, &msg->best_focus_pos_heat))
+            return false;
+          break;
+        case PBFAST_KEY(20, PB_WT_64BIT): /* roi_x1 */
+          if (!pbfast_fixed64(c, end, &msg->roi_x1))
+            return false;
+          break;
+        case PBFAST_KEY(21, PB_WT_64BIT): /* roi_y1 */
+          if (!pbfast_fixed64(c, end, &msg->roi_y1))
+            return false;
+          break;
+        case PBFAST_KEY(22, PB_WT_64BIT): /* roi_x2 */
+          if (!pbfast_fixed64(c, end, &msg->roi_x2))
+            return false;
+          break;
+        case PBFAST_KEY(23, PB_WT_64BIT): /* roi_y2 */
+          if (!pbfast_fixed64(c, end, &msg->roi_y2))
+            return false;
+          break;
+        case PBFAST_KEY(30, PB_WT_VARINT): /* bridge_status */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->bridge_status))
+            return false;
+          break;
+        case PBFAST_KEY(31, PB_WT_VARINT): /* last_exit_reason */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->last_exit_reason))
+            return false;
+          break;
+        case PBFAST_KEY(32, PB_WT_VARINT): /* bridge_uptime_ms */
+          if (!pbfast_int64(c, end, &msg->bridge_uptime_ms))
+            return false;
+          break;
+        case PBFAST_KEY(33, PB_WT_VARINT): /* restart_count */
+          if (!pbfast_int32(c, end, &msg->restart_count))
+            return false;
+          break;
+        case PBFAST_KEY(40, PB_WT_STRING): /* roi_focus_day */
+          msg->has_roi_focus_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataROI(c, sub_end, &msg->roi_focus_day))
+            return false;
+          break;
+        case PBFAST_KEY(41, PB_WT_STRING): /* roi_track_day */
+          msg->has_roi_track_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataROI(c, sub_end, &msg->roi_track_day))
+            return false;
+          break;
+        case PBFAST_KEY(42, PB_WT_STRING): /* roi_zoom_day */
+          msg->has_roi_zoom_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataROI(c, sub_end, &msg->roi_zoom_day))
+            return false;
+          break;
+        case PBFAST_KEY(43, PB_WT_STRING): /* roi_fx_day */
+          msg->has_roi_fx_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataROI(c, sub_end, &msg->roi_fx_day))
+            return false;
+          break;
+        case PBFAST_KEY(50, PB_WT_STRING): /* roi_focus_heat */
+          msg->has_roi_focus_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataROI(c, sub_end, &msg->roi_focus_heat))
+            return false;
+          break;
+        case PBFAST_KEY(51, PB_WT_STRING): /* roi_track_heat */
+          msg->has_roi_track_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataROI(c, sub_end, &msg->roi_track_heat))
+            return false;
+          break;
+        case PBFAST_KEY(52, PB_WT_STRING): /* roi_zoom_heat */
+          msg->has_roi_zoom_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataROI(c, sub_end, &msg->roi_zoom_heat))
+            return false;
+          break;
+        case PBFAST_KEY(53, PB_WT_STRING): /* roi_fx_heat */
+          msg->has_roi_fx_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataROI(c, sub_end, &msg->roi_fx_heat))
+            return false;
+          break;
+        case PBFAST_KEY(60, PB_WT_STRING): /* sharpness_metrics_day */
+          msg->has_sharpness_metrics_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataSharpness(c, sub_end, &msg->sharpness_metrics_day))
+            return false;
+          break;
+        case PBFAST_KEY(61, PB_WT_STRING): /* sharpness_metrics_heat */
+          msg->has_sharpness_metrics_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataSharpness(c, sub_end, &msg->sharpness_metrics_heat))
+            return false;
+          break;
+        case PBFAST_KEY(70, PB_WT_STRING): /* camera_transform_day */
+          msg->has_camera_transform_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataTransform3D(c, sub_end, &msg->camera_transform_day))
+            return false;
+          break;
+        case PBFAST_KEY(71, PB_WT_STRING): /* camera_transform_heat */
+          msg->has_camera_transform_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataTransform3D(c, sub_end, &msg->camera_transform_heat))
+            return false;
+          break;
+        default:
+          switch (key >> 3)
+            {
+            case 80: /* tracked_objects */
+              if (msg->tracked_objects.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_JonGuiDataCV_msg, msg))
+                return false;
+              break;
+            default:
+              if (pbfast_known_ser_JonGuiDataCV(key >> 3))
+                return pbfast_fail(c, "wrong wire type");
+              if (!pbfast_skip(c, end, key))
+                return false;
+              break;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataROI(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_JonGuiDataROI *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* x1 */
+          if (!pbfast_fixed64(c, end, &msg->x1))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* y1 */
+          if (!pbfast_fixed64(c, end, &msg->y1))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* x2 */
+          if (!pbfast_fixed64(c, end, &msg->x2))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* y2 */
+          if (!pbfast_fixed64(c, end, &msg->y2))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataROI(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataSharpness(pbfast_cursor_t *c,
+                                   const pb_byte_t *end,
+                                   ser_JonGuiDataSharpness *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* value */
+          if (!pbfast_fixed64(c, end, &msg->value))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* derivative_1 */
+          if (!pbfast_fixed64(c, end, &msg->derivative_1))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* derivative_2 */
+          if (!pbfast_fixed64(c, end, &msg->derivative_2))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataSharpness(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataTransform3D(pbfast_cursor_t *c,
+                                     const pb_byte_t *end,
+                                     ser_JonGuiDataTransform3D *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_STRING): /* position */
+          msg->has_position = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataVector3(c, sub_end, &msg->position))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_STRING): /* orientation */
+          msg->has_orientation = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataQuaternion(c, sub_end, &msg->orientation))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_STRING): /* linear_velocity */
+          msg->has_linear_velocity = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataVector3(c, sub_end, &msg->linear_velocity))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_STRING): /* angular_velocity */
+          msg->has_angular_velocity = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataVector3(c, sub_end, &msg->angular_velocity))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataTransform3D(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataVector3(pbfast_cursor_t *c,
+                                 const pb_byte_t *end,
+                                 ser_JonGuiDataVector3 *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* x */
+          if (!pbfast_fixed64(c, end, &msg->x))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* y */
+          if (!pbfast_fixed64(c, end, &msg->y))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* z */
+          if (!pbfast_fixed64(c, end, &msg->z))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataVector3(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataQuaternion(pbfast_cursor_t *c,
+                                    const pb_byte_t *end,
+                                    ser_JonGuiDataQuaternion *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* w */
+          if (!pbfast_fixed64(c, end, &msg->w))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* x */
+          if (!pbfast_fixed64(c, end, &msg->x))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* y */
+          if (!pbfast_fixed64(c, end, &msg->y))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* z */
+          if (!pbfast_fixed64(c, end, &msg->z))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataQuaternion(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataPMU(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_JonGuiDataPMU *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* temperature */
+          if (!pbfast_fixed64(c, end, &msg->temperature))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* is_started */
+          if (!pbfast_bool(c, end, &msg->is_started))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_STRING): /* meteo */
+          msg->has_meteo = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataMeteo(c, sub_end, &msg->meteo))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* voltage */
+          if (!pbfast_fixed64(c, end, &msg->voltage))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* heater_power_state */
+          if (!pbfast_bool(c, end, &msg->heater_power_state))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_64BIT): /* ina_voltage */
+          if (!pbfast_fixed64(c, end, &msg->ina_voltage))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_64BIT): /* ina_current */
+          if (!pbfast_fixed64(c, end, &msg->ina_current))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_64BIT): /* ina_power */
+          if (!pbfast_fixed64(c, end, &msg->ina_power))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_VARINT): /* ina_power_fault */
+          if (!pbfast_bool(c, end, &msg->ina_power_fault))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_VARINT): /* charge_disabled */
+          if (!pbfast_bool(c, end, &msg->charge_disabled))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataPMU(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataHeater(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonGuiDataHeater *msg)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_32BIT): /* bus_voltage_V */
+          if (!pbfast_fixed32(c, end, &msg->bus_voltage_V))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_32BIT): /* current_A */
+          if (!pbfast_fixed32(c, end, &msg->current_A))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_32BIT): /* power_W */
+          if (!pbfast_fixed32(c, end, &msg->power_W))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_STRING): /* channel_0 */
+          msg->has_channel_0 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataHeaterChannelStatus(c, sub_end, &msg->channel_0))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_STRING): /* channel_1 */
+          msg->has_channel_1 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataHeaterChannelStatus(c, sub_end, &msg->channel_1))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_STRING): /* channel_2 */
+          msg->has_channel_2 = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataHeaterChannelStatus(c, sub_end, &msg->channel_2))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_VARINT): /* automatic_control_enabled */
+          if (!pbfast_bool(c, end, &msg->automatic_control_enabled))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_32BIT): /* target_temp_channel_0 */
+          if (!pbfast_fixed32(c, end, &msg->target_temp_channel_0))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_32BIT): /* target_temp_channel_1 */
+          if (!pbfast_fixed32(c, end, &msg->target_temp_channel_1))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_32BIT): /* target_temp_channel_2 */
+          if (!pbfast_fixed32(c, end, &msg->target_temp_channel_2))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataHeater(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonGuiDataHeaterChannelStatus(pbfast_cursor_t *c,
+                                             const pb_byte_t *end,
+                                             ser_JonGuiDataHeaterChannelStatus *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_32BIT): /* temperature */
+          if (!pbfast_fixed32(c, end, &msg->temperature))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_32BIT): /* applied_voltage_V */
+          if (!pbfast_fixed32(c, end, &msg->applied_voltage_V))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_32BIT): /* target_voltage_V */
+          if (!pbfast_fixed32(c, end, &msg->target_voltage_V))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* enabled */
+          if (!pbfast_bool(c, end, &msg->enabled))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonGuiDataHeaterChannelStatus(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonOpaquePayload(pbfast_cursor_t *c,
+                                const pb_byte_t *end,
+                                ser_JonOpaquePayload *msg,
+                                uint32_t fields)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(2, PB_WT_STRING): /* version */
+          msg->has_version = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonOpaquePayloadVersion(c, sub_end, &msg->version))
+            return false;
+          break;
+        default:
+          switch (key >> 3)
+            {
+            case 1: /* type_uuid */
+              if (msg->type_uuid.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_JonOpaquePayload_msg, msg))
+                return false;
+              break;
+            case 3: /* payload */
+              if (msg->payload.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_JonOpaquePayload_msg, msg))
+                return false;
+              break;
+            default:
+              if (pbfast_known_ser_JonOpaquePayload(key >> 3))
+                return pbfast_fail(c, "wrong wire type");
+              if (!pbfast_skip(c, end, key))
+                return false;
+              break;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_JonOpaquePayloadVersion(pbfast_cursor_t *c,
+                                       const pb_byte_t *end,
+                                       ser_JonOpaquePayloadVersion *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* major */
+          if (!pbfast_uint32(c, end, &msg->major))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* minor */
+          if (!pbfast_uint32(c, end, &msg->minor))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* build */
+          if (!pbfast_uint64(c, end, &msg->build))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_JonOpaquePayloadVersion(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_OsdClientMetadata(pbfast_cursor_t *c,
+                                 const pb_byte_t *end,
+                                 ser_OsdClientMetadata *msg,
+                                 uint32_t fields)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* canvas_width_px */
+          if (!pbfast_uint32(c, end, &msg->canvas_width_px))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* canvas_height_px */
+          if (!pbfast_uint32(c, end, &msg->canvas_height_px))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_32BIT): /* device_pixel_ratio */
+          if (!pbfast_fixed32(c, end, &msg->device_pixel_ratio))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* osd_buffer_width */
+          if (!pbfast_uint32(c, end, &msg->osd_buffer_width))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_VARINT): /* osd_buffer_height */
+          if (!pbfast_uint32(c, end, &msg->osd_buffer_height))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_32BIT): /* video_proxy_ndc_x */
+          if (!pbfast_fixed32(c, end, &msg->video_proxy_ndc_x))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_32BIT): /* video_proxy_ndc_y */
+          if (!pbfast_fixed32(c, end, &msg->video_proxy_ndc_y))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_32BIT): /* video_proxy_ndc_width */
+          if (!pbfast_fixed32(c, end, &msg->video_proxy_ndc_width))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_32BIT): /* video_proxy_ndc_height */
+          if (!pbfast_fixed32(c, end, &msg->video_proxy_ndc_height))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_32BIT): /* scale_factor */
+          if (!pbfast_fixed32(c, end, &msg->scale_factor))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_VARINT): /* is_sharp_mode */
+          if (!pbfast_bool(c, end, &msg->is_sharp_mode))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_32BIT): /* theme_hue */
+          if (!pbfast_fixed32(c, end, &msg->theme_hue))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_32BIT): /* theme_chroma */
+          if (!pbfast_fixed32(c, end, &msg->theme_chroma))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_32BIT): /* theme_lightness */
+          if (!pbfast_fixed32(c, end, &msg->theme_lightness))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_OsdClientMetadata(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_CvMeta(pbfast_cursor_t *c,
+                      const pb_byte_t *end,
+                      ser_CvMeta *msg,
+                      uint32_t fields)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* capture_monotonic_us */
+          if (!pbfast_uint64(c, end, &msg->capture_monotonic_us))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* updated_sources */
+          if (!pbfast_uint32(c, end, &msg->updated_sources))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_STRING): /* camera_day */
+          msg->has_camera_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataCameraDay(c, sub_end, &msg->camera_day))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_STRING): /* camera_heat */
+          msg->has_camera_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataCameraHeat(c, sub_end, &msg->camera_heat))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_STRING): /* rotary */
+          msg->has_rotary = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_JonGuiDataRotary(c, sub_end, &msg->rotary))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_STRING): /* channel_day */
+          msg->has_channel_day = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_CvChannelMeta(c, sub_end, &msg->channel_day))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_STRING): /* channel_heat */
+          msg->has_channel_heat = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_CvChannelMeta(c, sub_end, &msg->channel_heat))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_CvMeta(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_CvChannelMeta(pbfast_cursor_t *c,
+                             const pb_byte_t *end,
+                             ser_CvChannelMeta *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* pts_ns */
+          if (!pbfast_uint64(c, end, &msg->pts_ns))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* capture_time_ns */
+          if (!pbfast_uint64(c, end, &msg->capture_time_ns))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* generation */
+          if (!pbfast_uint32(c, end, &msg->generation))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_32BIT): /* sharpness_level0 */
+          if (!pbfast_fixed32(c, end, &msg->sharpness_level0))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_VARINT): /* sharpness_compute_ns */
+          if (!pbfast_uint64(c, end, &msg->sharpness_compute_ns))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_VARINT): /* sharpness_total_ns */
+          if (!pbfast_uint64(c, end, &msg->sharpness_total_ns))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_VARINT): /* sharpness_valid */
+          if (!pbfast_bool(c, end, &msg->sharpness_valid))
+            return false;
+          break;
+        case PBFAST_KEY(11, PB_WT_VARINT): /* sensor_gain */
+          if (!pbfast_int32(c, end, &msg->sensor_gain))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_VARINT): /* gain_valid */
+          if (!pbfast_bool(c, end, &msg->gain_valid))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_VARINT): /* sensor_exposure */
+          if (!pbfast_int32(c, end, &msg->sensor_exposure))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_VARINT): /* exposure_valid */
+          if (!pbfast_bool(c, end, &msg->exposure_valid))
+            return false;
+          break;
+        default:
+          switch (key >> 3)
+            {
+            case 5: /* sharpness_level1 */
+              if (msg->sharpness_level1.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_CvChannelMeta_msg, msg))
+                return false;
+              break;
+            case 6: /* sharpness_level2 */
+              if (msg->sharpness_level2.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_CvChannelMeta_msg, msg))
+                return false;
+              break;
+            case 7: /* sharpness_level3 */
+              if (msg->sharpness_level3.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_CvChannelMeta_msg, msg))
+                return false;
+              break;
+            default:
+              if (pbfast_known_ser_CvChannelMeta(key >> 3))
+                return pbfast_fail(c, "wrong wire type");
+              if (!pbfast_skip(c, end, key))
+                return false;
+              break;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_ObjectDetectionsDay(pbfast_cursor_t *c,
+                                   const pb_byte_t *end,
+                                   ser_ObjectDetectionsDay *msg,
+                                   uint32_t fields)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* status */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->status))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* latency_ns */
+          if (!pbfast_uint64(c, end, &msg->latency_ns))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_STRING): /* frame */
+          msg->has_frame = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_DetectionFrameMeta(c, sub_end, &msg->frame))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_STRING): /* config */
+          msg->has_config = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_DetectionConfig(c, sub_end, &msg->config))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* capture_monotonic_us */
+          if (!pbfast_uint64(c, end, &msg->capture_monotonic_us))
+            return false;
+          break;
+        default:
+          switch (key >> 3)
+            {
+            case 2: /* detections */
+              if (msg->detections.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_ObjectDetectionsDay_msg, msg))
+                return false;
+              break;
+            default:
+              if (pbfast_known_ser_ObjectDetectionsDay(key >> 3))
+                return pbfast_fail(c, "wrong wire type");
+              if (!pbfast_skip(c, end, key))
+                return false;
+              break;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_DetectionFrameMeta(pbfast_cursor_t *c,
+                                  const pb_byte_t *end,
+                                  ser_DetectionFrameMeta *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* pts_ns */
+          if (!pbfast_uint64(c, end, &msg->pts_ns))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* capture_time_ns */
+          if (!pbfast_uint64(c, end, &msg->capture_time_ns))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* generation */
+          if (!pbfast_uint32(c, end, &msg->generation))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* width */
+          if (!pbfast_uint32(c, end, &msg->width))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_VARINT): /* height */
+          if (!pbfast_uint32(c, end, &msg->height))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_DetectionFrameMeta(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_DetectionConfig(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_DetectionConfig *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_32BIT): /* confidence_threshold */
+          if (!pbfast_fixed32(c, end, &msg->confidence_threshold))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_32BIT): /* nms_iou_threshold */
+          if (!pbfast_fixed32(c, end, &msg->nms_iou_threshold))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_DetectionConfig(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_ObjectDetectionsHeat(pbfast_cursor_t *c,
+                                    const pb_byte_t *end,
+                                    ser_ObjectDetectionsHeat *msg,
+                                    uint32_t fields)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* status */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->status))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* latency_ns */
+          if (!pbfast_uint64(c, end, &msg->latency_ns))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_STRING): /* frame */
+          msg->has_frame = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_DetectionFrameMeta(c, sub_end, &msg->frame))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_STRING): /* config */
+          msg->has_config = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_DetectionConfig(c, sub_end, &msg->config))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* capture_monotonic_us */
+          if (!pbfast_uint64(c, end, &msg->capture_monotonic_us))
+            return false;
+          break;
+        default:
+          switch (key >> 3)
+            {
+            case 2: /* detections */
+              if (msg->detections.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_ObjectDetectionsHeat_msg, msg))
+                return false;
+              break;
+            default:
+              if (pbfast_known_ser_ObjectDetectionsHeat(key >> 3))
+                return pbfast_fail(c, "wrong wire type");
+              if (!pbfast_skip(c, end, key))
+                return false;
+              break;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_ObjectDetection(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_ObjectDetection *msg,
+                               uint32_t fields)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_32BIT): /* x1 */
+          if (!pbfast_fixed32(c, end, &msg->x1))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_32BIT): /* y1 */
+          if (!pbfast_fixed32(c, end, &msg->y1))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_32BIT): /* x2 */
+          if (!pbfast_fixed32(c, end, &msg->x2))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_32BIT): /* y2 */
+          if (!pbfast_fixed32(c, end, &msg->y2))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_32BIT): /* confidence */
+          if (!pbfast_fixed32(c, end, &msg->confidence))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_VARINT): /* class_id */
+          if (!pbfast_int32(c, end, &msg->class_id))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_ObjectDetection(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_SamTrackingDay(pbfast_cursor_t *c,
+                              const pb_byte_t *end,
+                              ser_SamTrackingDay *msg,
+                              uint32_t fields)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* status */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->status))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* state */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->state))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* bbox_x1 */
+          if (!pbfast_fixed64(c, end, &msg->bbox_x1))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* bbox_y1 */
+          if (!pbfast_fixed64(c, end, &msg->bbox_y1))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* bbox_x2 */
+          if (!pbfast_fixed64(c, end, &msg->bbox_x2))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_64BIT): /* bbox_y2 */
+          if (!pbfast_fixed64(c, end, &msg->bbox_y2))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_64BIT): /* centroid_x */
+          if (!pbfast_fixed64(c, end, &msg->centroid_x))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_64BIT): /* centroid_y */
+          if (!pbfast_fixed64(c, end, &msg->centroid_y))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_32BIT): /* confidence */
+          if (!pbfast_fixed32(c, end, &msg->confidence))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_32BIT): /* iou */
+          if (!pbfast_fixed32(c, end, &msg->iou))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_VARINT): /* mask_width */
+          if (!pbfast_uint32(c, end, &msg->mask_width))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_VARINT): /* mask_height */
+          if (!pbfast_uint32(c, end, &msg->mask_height))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_VARINT): /* mask_pixels */
+          if (!pbfast_uint32(c, end, &msg->mask_pixels))
+            return false;
+          break;
+        case PBFAST_KEY(15, PB_WT_STRING): /* frame */
+          msg->has_frame = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_SamTrackingFrameMeta(c, sub_end, &msg->frame))
+            return false;
+          break;
+        case PBFAST_KEY(16, PB_WT_STRING): /* kalman */
+          msg->has_kalman = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_SamTrackingKalmanState(c, sub_end, &msg->kalman))
+            return false;
+          break;
+        case PBFAST_KEY(17, PB_WT_VARINT): /* lost_frame_count */
+          if (!pbfast_uint32(c, end, &msg->lost_frame_count))
+            return false;
+          break;
+        case PBFAST_KEY(18, PB_WT_VARINT): /* latency_ns */
+          if (!pbfast_uint64(c, end, &msg->latency_ns))
+            return false;
+          break;
+        default:
+          switch (key >> 3)
+            {
+            case 11: /* mask_rle */
+              if (msg->mask_rle.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_SamTrackingDay_msg, msg))
+                return false;
+              break;
+            default:
+              if (pbfast_known_ser_SamTrackingDay(key >> 3))
+                return pbfast_fail(c, "wrong wire type");
+              if (!pbfast_skip(c, end, key))
+                return false;
+              break;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_SamTrackingFrameMeta(pbfast_cursor_t *c,
+                                    const pb_byte_t *end,
+                                    ser_SamTrackingFrameMeta *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* pts_ns */
+          if (!pbfast_uint64(c, end, &msg->pts_ns))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* capture_time_ns */
+          if (!pbfast_uint64(c, end, &msg->capture_time_ns))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_VARINT): /* generation */
+          if (!pbfast_uint32(c, end, &msg->generation))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_VARINT): /* capture_monotonic_us */
+          if (!pbfast_uint64(c, end, &msg->capture_monotonic_us))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_SamTrackingFrameMeta(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_SamTrackingKalmanState(pbfast_cursor_t *c,
+                                      const pb_byte_t *end,
+                                      ser_SamTrackingKalmanState *msg)
+{
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_64BIT): /* predicted_x */
+          if (!pbfast_fixed64(c, end, &msg->predicted_x))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_64BIT): /* predicted_y */
+          if (!pbfast_fixed64(c, end, &msg->predicted_y))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* velocity_x */
+          if (!pbfast_fixed64(c, end, &msg->velocity_x))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* velocity_y */
+          if (!pbfast_fixed64(c, end, &msg->velocity_y))
+            return false;
+          break;
+        default:
+          if (pbfast_known_ser_SamTrackingKalmanState(key >> 3))
+            return pbfast_fail(c, "wrong wire type");
+          if (!pbfast_skip(c, end, key))
+            return false;
+          break;
+        }
+    }
+
+  return true;
+}
+
+static bool
+pbfast_msg_ser_SamTrackingHeat(pbfast_cursor_t *c,
+                               const pb_byte_t *end,
+                               ser_SamTrackingHeat *msg,
+                               uint32_t fields)
+{
+  const pb_byte_t *sub_end;
+
+  while (c->pos < end)
+    {
+      uint32_t key;
+      if (!pbfast_key(c, end, &key))
+        return false;
+      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))
+        {
+          if (!pbfast_skip(c, end, key))
+            return false;
+          continue;
+        }
+
+      switch (key)
+        {
+        case PBFAST_KEY(1, PB_WT_VARINT): /* status */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->status))
+            return false;
+          break;
+        case PBFAST_KEY(2, PB_WT_VARINT): /* state */
+          if (!pbfast_uint32(c, end, (uint32_t *)&msg->state))
+            return false;
+          break;
+        case PBFAST_KEY(3, PB_WT_64BIT): /* bbox_x1 */
+          if (!pbfast_fixed64(c, end, &msg->bbox_x1))
+            return false;
+          break;
+        case PBFAST_KEY(4, PB_WT_64BIT): /* bbox_y1 */
+          if (!pbfast_fixed64(c, end, &msg->bbox_y1))
+            return false;
+          break;
+        case PBFAST_KEY(5, PB_WT_64BIT): /* bbox_x2 */
+          if (!pbfast_fixed64(c, end, &msg->bbox_x2))
+            return false;
+          break;
+        case PBFAST_KEY(6, PB_WT_64BIT): /* bbox_y2 */
+          if (!pbfast_fixed64(c, end, &msg->bbox_y2))
+            return false;
+          break;
+        case PBFAST_KEY(7, PB_WT_64BIT): /* centroid_x */
+          if (!pbfast_fixed64(c, end, &msg->centroid_x))
+            return false;
+          break;
+        case PBFAST_KEY(8, PB_WT_64BIT): /* centroid_y */
+          if (!pbfast_fixed64(c, end, &msg->centroid_y))
+            return false;
+          break;
+        case PBFAST_KEY(9, PB_WT_32BIT): /* confidence */
+          if (!pbfast_fixed32(c, end, &msg->confidence))
+            return false;
+          break;
+        case PBFAST_KEY(10, PB_WT_32BIT): /* iou */
+          if (!pbfast_fixed32(c, end, &msg->iou))
+            return false;
+          break;
+        case PBFAST_KEY(12, PB_WT_VARINT): /* mask_width */
+          if (!pbfast_uint32(c, end, &msg->mask_width))
+            return false;
+          break;
+        case PBFAST_KEY(13, PB_WT_VARINT): /* mask_height */
+          if (!pbfast_uint32(c, end, &msg->mask_height))
+            return false;
+          break;
+        case PBFAST_KEY(14, PB_WT_VARINT): /* mask_pixels */
+          if (!pbfast_uint32(c, end, &msg->mask_pixels))
+            return false;
+          break;
+        case PBFAST_KEY(15, PB_WT_STRING): /* frame */
+          msg->has_frame = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_SamTrackingFrameMeta(c, sub_end, &msg->frame))
+            return false;
+          break;
+        case PBFAST_KEY(16, PB_WT_STRING): /* kalman */
+          msg->has_kalman = true;
+          if (!pbfast_length(c, end, &sub_end)
+              || !pbfast_msg_ser_SamTrackingKalmanState(c, sub_end, &msg->kalman))
+            return false;
+          break;
+        case PBFAST_KEY(17, PB_WT_VARINT): /* lost_frame_count */
+          if (!pbfast_uint32(c, end, &msg->lost_frame_count))
+            return false;
+          break;
+        case PBFAST_KEY(18, PB_WT_VARINT): /* latency_ns */
+          if (!pbfast_uint64(c, end, &msg->latency_ns))
+            return false;
+          break;
+        default:
+          switch (key >> 3)
+            {
+            case 11: /* mask_rle */
+              if (msg->mask_rle.funcs.decode == NULL)
+                {
+                  if (!pbfast_skip(c, end, key))
+                    return false;
+                  break;
+                }
+              if (!pbfast_callback(c, end, key, &ser_SamTrackingHeat_msg, msg))
+                return false;
+              break;
+            default:
+              if (pbfast_known_ser_SamTrackingHeat(key >> 3))
+                return pbfast_fail(c, "wrong wire type");
+              if (!pbfast_skip(c, end, key))
+                return false;
+              break;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+bool
+pbfast_decode_ser_JonGUIState(pb_istream_t *stream,
+                              ser_JonGUIState *msg,
+                              uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_JonGUIState(&c, end, msg, fields));
+}
+
+bool
+pbfast_decode_ser_JonOpaquePayload(pb_istream_t *stream,
+                                   ser_JonOpaquePayload *msg,
+                                   uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_JonOpaquePayload(&c, end, msg, fields));
+}
+
+bool
+pbfast_decode_ser_OsdClientMetadata(pb_istream_t *stream,
+                                    ser_OsdClientMetadata *msg,
+                                    uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_OsdClientMetadata(&c, end, msg, fields));
+}
+
+bool
+pbfast_decode_ser_CvMeta(pb_istream_t *stream,
+                         ser_CvMeta *msg,
+                         uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_CvMeta(&c, end, msg, fields));
+}
+
+bool
+pbfast_decode_ser_ObjectDetectionsDay(pb_istream_t *stream,
+                                      ser_ObjectDetectionsDay *msg,
+                                      uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_ObjectDetectionsDay(&c, end, msg, fields));
+}
+
+bool
+pbfast_decode_ser_ObjectDetectionsHeat(pb_istream_t *stream,
+                                       ser_ObjectDetectionsHeat *msg,
+                                       uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_ObjectDetectionsHeat(&c, end, msg, fields));
+}
+
+bool
+pbfast_decode_ser_ObjectDetection(pb_istream_t *stream,
+                                  ser_ObjectDetection *msg,
+                                  uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_ObjectDetection(&c, end, msg, fields));
+}
+
+bool
+pbfast_decode_ser_SamTrackingDay(pb_istream_t *stream,
+                                 ser_SamTrackingDay *msg,
+                                 uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_SamTrackingDay(&c, end, msg, fields));
+}
+
+bool
+pbfast_decode_ser_SamTrackingHeat(pb_istream_t *stream,
+                                  ser_SamTrackingHeat *msg,
+                                  uint32_t fields)
+{
+  pbfast_cursor_t c;
+  const pb_byte_t *end;
+
+  if (!pbfast_begin(stream, &c, &end))
+    return false;
+  return pbfast_end(stream, &c, end,
+                    pbfast_msg_ser_SamTrackingHeat(&c, end, msg, fields));
+}
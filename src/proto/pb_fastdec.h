@@ -0,0 +1,84 @@
+/* Automatically generated by tools/gen_fastdec.py - do not edit */
+/* Roots: ser_JonGUIState ser_JonOpaquePayload ser_OsdClientMetadata ser_CvMeta ser_ObjectDetectionsDay ser_ObjectDetectionsHeat ser_ObjectDetection ser_SamTrackingDay ser_SamTrackingHeat */
+
+#ifndef PB_FASTDEC_H_INCLUDED
+#define PB_FASTDEC_H_INCLUDED
+
+#include <pb.h>
+#include <pb_decode.h>
+
+#include "jon_shared_data.pb.h"
+#include "jon_shared_data_actual_space_time.pb.h"
+#include "jon_shared_data_camera_day.pb.h"
+#include "jon_shared_data_camera_heat.pb.h"
+#include "jon_shared_data_compass.pb.h"
+#include "jon_shared_data_compass_calibration.pb.h"
+#include "jon_shared_data_cv.pb.h"
+#include "jon_shared_data_gps.pb.h"
+#include "jon_shared_data_heater.pb.h"
+#include "jon_shared_data_lrf.pb.h"
+#include "jon_shared_data_pmu.pb.h"
+#include "jon_shared_data_power.pb.h"
+#include "jon_shared_data_rec_osd.pb.h"
+#include "jon_shared_data_rotary.pb.h"
+#include "jon_shared_data_system.pb.h"
+#include "jon_shared_data_time.pb.h"
+#include "jon_shared_data_types.pb.h"
+#include "opaque/cv_meta.pb.h"
+#include "opaque/detection_common.pb.h"
+#include "opaque/object_detections_day.pb.h"
+#include "opaque/object_detections_heat.pb.h"
+#include "opaque/osd_client_metadata.pb.h"
+#include "opaque/sam_tracking_common.pb.h"
+#include "opaque/sam_tracking_day.pb.h"
+#include "opaque/sam_tracking_heat.pb.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Decode every field (see the `fields` argument below) */
+#define PBFAST_ALL_FIELDS 0xffffffffu
+
+/* Decoders behave like pb_decode_ex(stream, fields, msg,
+ * PB_DECODE_NOINIT): msg must be initialized by the caller and
+ * callbacks set in it are invoked as nanopb would. The stream
+ * must be a buffer stream (pb_istream_from_buffer() or a
+ * callback substream of one).
+ *
+ * fields: bit n set = decode tag n; tags outside the mask are
+ * skipped unparsed. Tags >= 32 are always decoded. */
+bool pbfast_decode_ser_JonGUIState(pb_istream_t *stream,
+                                   ser_JonGUIState *msg,
+                                   uint32_t fields);
+bool pbfast_decode_ser_JonOpaquePayload(pb_istream_t *stream,
+                                        ser_JonOpaquePayload *msg,
+                                        uint32_t fields);
+bool pbfast_decode_ser_OsdClientMetadata(pb_istream_t *stream,
+                                         ser_OsdClientMetadata *msg,
+                                         uint32_t fields);
+bool pbfast_decode_ser_CvMeta(pb_istream_t *stream,
+                              ser_CvMeta *msg,
+                              uint32_t fields);
+bool pbfast_decode_ser_ObjectDetectionsDay(pb_istream_t *stream,
+                                           ser_ObjectDetectionsDay *msg,
+                                           uint32_t fields);
+bool pbfast_decode_ser_ObjectDetectionsHeat(pb_istream_t *stream,
+                                            ser_ObjectDetectionsHeat *msg,
+                                            uint32_t fields);
+bool pbfast_decode_ser_ObjectDetection(pb_istream_t *stream,
+                                       ser_ObjectDetection *msg,
+                                       uint32_t fields);
+bool pbfast_decode_ser_SamTrackingDay(pb_istream_t *stream,
+                                      ser_SamTrackingDay *msg,
+                                      uint32_t fields);
+bool pbfast_decode_ser_SamTrackingHeat(pb_istream_t *stream,
+                                       ser_SamTrackingHeat *msg,
+                                       uint32_t fields);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
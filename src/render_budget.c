@@ -0,0 +1,186 @@
+// Render Budget Implementation
+// Rolling frame cost, level stepping with hysteresis and backoff
+
+#include "render_budget.h"
+
+#include <string.h>
+
+#include "core/osd_context.h"
+#include "utils/logging.h"
+
+_Static_assert(OSD_QUALITY_SKIP_DEBUG == WASM_OSD_QUALITY_SKIP_DEBUG
+                 && OSD_QUALITY_NAVBALL_NEAREST
+                      == WASM_OSD_QUALITY_NAVBALL_NEAREST
+                 && OSD_QUALITY_OUTLINE_SINGLE
+                      == WASM_OSD_QUALITY_OUTLINE_SINGLE
+                 && OSD_QUALITY_SAM_CONTOUR == WASM_OSD_QUALITY_SAM_CONTOUR
+                 && OSD_QUALITY_NAVBALL_HALF_RES
+                      == WASM_OSD_QUALITY_NAVBALL_HALF_RES,
+               "WASM_OSD_QUALITY_* must mirror OSD_QUALITY_*");
+
+// Quality bits of each level; every level keeps the reductions below it
+static const uint32_t k_level_quality[RENDER_BUDGET_MAX_LEVEL + 1] = {
+  0,
+  OSD_QUALITY_SKIP_DEBUG,
+  OSD_QUALITY_SKIP_DEBUG | OSD_QUALITY_NAVBALL_NEAREST,
+  OSD_QUALITY_SKIP_DEBUG | OSD_QUALITY_NAVBALL_NEAREST
+    | OSD_QUALITY_OUTLINE_SINGLE,
+  OSD_QUALITY_SKIP_DEBUG | OSD_QUALITY_NAVBALL_NEAREST
+    | OSD_QUALITY_OUTLINE_SINGLE | OSD_QUALITY_SAM_CONTOUR,
+  OSD_QUALITY_SKIP_DEBUG | OSD_QUALITY_NAVBALL_NEAREST
+    | OSD_QUALITY_OUTLINE_SINGLE | OSD_QUALITY_SAM_CONTOUR
+    | OSD_QUALITY_NAVBALL_HALF_RES,
+};
+
+// Longest step-up wait, in windows
+#define RENDER_BUDGET_MAX_BACKOFF 32
+
+static render_budget_config_t s_config;
+static wasm_osd_budget_stats_t s_stats;
+
+static double s_avg_us    = 0.0;   // Rolling average (unrounded avg_us)
+static uint32_t s_frames  = 0;     // Renders recorded
+static uint32_t s_backoff = 1;     // Windows to wait before a step up
+static bool s_last_was_up = false; // Last level change was a step up
+
+void
+render_budget_init(const render_budget_config_t *config)
+{
+  s_config = *config;
+  if (s_config.budget_us < 0)
+    {
+      s_config.budget_us = 0;
+    }
+  if (s_config.window_frames < 1)
+    {
+      s_config.window_frames = 1;
+    }
+  if (!(s_config.step_up_ratio > 0.0f && s_config.step_up_ratio < 1.0f))
+    {
+      s_config.step_up_ratio = 0.7f;
+    }
+  if (s_config.max_level < 0)
+    {
+      s_config.max_level = 0;
+    }
+  if (s_config.max_level > RENDER_BUDGET_MAX_LEVEL)
+    {
+      s_config.max_level = RENDER_BUDGET_MAX_LEVEL;
+    }
+
+  memset(&s_stats, 0, sizeof(s_stats));
+  s_stats.budget_us = (uint32_t)s_config.budget_us;
+  s_avg_us          = 0.0;
+  s_frames          = 0;
+  s_backoff         = 1;
+  s_last_was_up     = false;
+
+  if (s_config.budget_us > 0)
+    {
+      LOG_INFO("Render budget: %d us (window %d, max level %d)",
+               s_config.budget_us, s_config.window_frames,
+               s_config.max_level);
+    }
+}
+
+uint32_t
+render_budget_quality(void)
+{
+  return s_stats.quality;
+}
+
+const wasm_osd_budget_stats_t *
+render_budget_stats(void)
+{
+  return &s_stats;
+}
+
+static void
+set_level(uint32_t level)
+{
+  bool down = level > s_stats.level;
+
+  s_stats.level              = level;
+  s_stats.quality            = k_level_quality[level];
+  s_stats.last_change_frame  = s_frames;
+  s_stats.last_change_avg_us = s_stats.avg_us;
+  s_stats.level_changes++;
+
+  if (down)
+    {
+      s_stats.steps_down++;
+      if (level > s_stats.max_level_reached)
+        {
+          s_stats.max_level_reached = level;
+        }
+      LOG_WARN("Render budget: %u us average over %d us, quality level %u",
+               s_stats.avg_us, s_config.budget_us, level);
+    }
+  else
+    {
+      s_stats.steps_up++;
+      LOG_INFO("Render budget: %u us average, quality level %u",
+               s_stats.avg_us, level);
+    }
+  s_last_was_up = !down;
+}
+
+void
+render_budget_record(uint64_t cost_us)
+{
+  uint32_t cost   = cost_us > UINT32_MAX ? UINT32_MAX : (uint32_t)cost_us;
+  uint32_t window = (uint32_t)s_config.window_frames;
+
+  // Exponential average over about one window
+  if (s_frames == 0)
+    {
+      s_avg_us = cost;
+    }
+  else
+    {
+      s_avg_us += ((double)cost - s_avg_us) / window;
+    }
+  s_frames++;
+
+  s_stats.last_us = cost;
+  s_stats.avg_us  = (uint32_t)(s_avg_us + 0.5);
+  if (s_stats.level > 0)
+    {
+      s_stats.frames_degraded++;
+    }
+
+  if (s_config.budget_us == 0)
+    {
+      return;
+    }
+
+  // Let the average settle (at start and at each new level) first
+  uint32_t since = s_frames - s_stats.last_change_frame;
+  if (since < window)
+    {
+      return;
+    }
+
+  if (s_avg_us > s_config.budget_us
+      && s_stats.level < (uint32_t)s_config.max_level)
+    {
+      // Undoing a recent step up: wait longer before the next one
+      if (s_last_was_up && since < 2 * window)
+        {
+          if (s_backoff < RENDER_BUDGET_MAX_BACKOFF)
+            {
+              s_backoff *= 2;
+            }
+        }
+      else
+        {
+          s_backoff = 1;
+        }
+      set_level(s_stats.level + 1);
+    }
+  else if (s_avg_us < s_config.budget_us * s_config.step_up_ratio
+           && s_stats.level > 0 && since >= window * s_backoff)
+    {
+      set_level(s_stats.level - 1);
+    }
+}
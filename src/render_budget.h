@@ -0,0 +1,52 @@
+// Render Budget
+// Frame-budget governor: trades render quality for widget drawing time
+//
+// ════════════════════════════════════════════════════════════
+// WHY THIS EXISTS:
+// The plugin targets well under a frame period per render, but nothing
+// held it there: a busy scene (SAM mask fill, outlined debug text, a
+// large nav ball) on a slow host simply made frames late. The governor
+// watches the widget drawing time of every render and, while the rolling
+// average is over render_budget.budget_us, switches on cheaper ways of
+// drawing the same overlay, one level at a time.
+//
+// LEVELS (cumulative, OSD_QUALITY_* bits in osd_context_t.quality):
+//   1  Debug widgets (variant info, autofocus debug) are not drawn
+//   2  Nav ball skin point-sampled instead of bilinear
+//   3  Text outlines drawn in one dilated pass instead of (2t+1)^2-1
+//   4  SAM mask outlined instead of filled
+//   5  Nav ball shaded once per 2x2 pixel block
+//
+// HYSTERESIS:
+// A level is held for window_frames renders before the next change. The
+// governor steps back up when the average drops under
+// budget_us * step_up_ratio; a step up that has to be undone within two
+// windows doubles the wait before the next one (up to 32 windows), so a
+// scene that sits right at the budget does not flicker between levels.
+// ════════════════════════════════════════════════════════════
+
+#ifndef RENDER_BUDGET_H
+#define RENDER_BUDGET_H
+
+#include <stdint.h>
+
+#include "config/osd_config.h"
+#include "wasm/wasm_exports.h"
+
+// Deepest reduction level
+#define RENDER_BUDGET_MAX_LEVEL 5
+
+// Start at full quality with the given settings (copied; out-of-range
+// values are clamped)
+void render_budget_init(const render_budget_config_t *config);
+
+// OSD_QUALITY_* bits to render the next frame with
+uint32_t render_budget_quality(void);
+
+// Record the widget drawing time of a render and adjust the level
+void render_budget_record(uint64_t cost_us);
+
+// Governor state for the host (wasm_osd_get_budget_stats)
+const wasm_osd_budget_stats_t *render_budget_stats(void);
+
+#endif // RENDER_BUDGET_H
@@ -134,6 +134,40 @@ uint32_t parse_color(const char *hex);
 //   uint32_t result = blend_argb(bg, fg);  // Purple-ish blend
 uint32_t blend_argb(uint32_t bg, uint32_t fg);
 
+// Composite a premultiplied foreground over the background
+//
+// For pixels drawn onto transparent black (layers, caches): their color
+// channels already carry their alpha, so "over" is
+//   result = fg + bg * (1 - alpha_fg)
+// without multiplying fg again. Matches drawing straight onto bg where bg
+// is empty or fg is opaque, and is within rounding of it elsewhere.
+//
+// Usage:
+//   dst[x] = blend_premultiplied(dst[x], layer[x]);
+static inline uint32_t
+blend_premultiplied(uint32_t bg, uint32_t fg)
+{
+  uint32_t alpha = fg >> 24;
+
+  if (alpha == 255 || bg == 0)
+    {
+      return fg;
+    }
+  if (alpha == 0)
+    {
+      return bg;
+    }
+
+  uint32_t inv = 255 - alpha;
+  uint32_t out = 0;
+  for (int shift = 0; shift < 32; shift += 8)
+    {
+      uint32_t c = ((fg >> shift) & 0xFF) + ((bg >> shift) & 0xFF) * inv / 255;
+      out |= (c > 255 ? 255 : c) << shift;
+    }
+  return out;
+}
+
 // ════════════════════════════════════════════════════════════
 // PREDEFINED COLORS
 // ════════════════════════════════════════════════════════════
@@ -1,6 +1,9 @@
 #include "rendering/text.h"
 
 #include "rendering/blending.h"
+#include "utils/grow_buffer.h"
+
+#include <stdlib.h>
 
 // stb_truetype for font rendering
 #ifndef isnan
@@ -18,6 +21,63 @@
 // INTERNAL TEXT RENDERING
 // ════════════════════════════════════════════════════════════
 
+// Set by text_set_single_pass_outline()
+static bool s_single_pass_outline = false;
+
+// Scratch for text_render_outline_dilated(), reused across glyphs and
+// frames. The inline block covers a 48 px glyph with a 3 px outline; the
+// heap block grows to the largest dilated glyph drawn so far and is kept
+// until text_cleanup().
+#define DILATE_SCRATCH_LIMIT (1u << 20)
+static uint8_t s_dilate_inline[8192];
+static grow_buffer_t s_dilate_scratch = {
+  .data            = s_dilate_inline,
+  .capacity        = sizeof(s_dilate_inline),
+  .limit           = DILATE_SCRATCH_LIMIT,
+  .inline_data     = s_dilate_inline,
+  .inline_capacity = sizeof(s_dilate_inline),
+};
+
+// Blend a coverage bitmap (glyph anti-aliasing, 0-255) at x, y in color
+static void
+blend_coverage(framebuffer_t *fb,
+               const unsigned char *coverage,
+               int width,
+               int height,
+               int x,
+               int y,
+               uint32_t color)
+{
+  // Extract ARGB from color (internal format: 0xAABBGGRR)
+  uint32_t rgb          = color & 0x00FFFFFF;
+  uint32_t config_alpha = (color >> 24) & 0xFF;
+
+  for (int gy = 0; gy < height; gy++)
+    {
+      for (int gx = 0; gx < width; gx++)
+        {
+          int px = x + gx;
+          int py = y + gy;
+
+          if (framebuffer_in_bounds(fb, px, py))
+            {
+              unsigned char glyph_alpha = coverage[gy * width + gx];
+              if (glyph_alpha > 0)
+                {
+                  // Combine glyph alpha with config alpha
+                  // glyph_alpha = anti-aliasing from font (0-255)
+                  // config_alpha = user transparency setting (0-255)
+                  uint32_t final_alpha = (glyph_alpha * config_alpha) / 255;
+
+                  // Blend with background
+                  framebuffer_blend_pixel(fb, px, py,
+                                          (final_alpha << 24) | rgb);
+                }
+            }
+        }
+    }
+}
+
 // Internal function to render text at specified position with offset
 static void
 text_render_internal(framebuffer_t *fb,
@@ -60,50 +120,112 @@ text_render_internal(framebuffer_t *fb,
           // Render glyph
           int glyph_x = pen_x + (int)(lsb * scale) + xoff;
           int glyph_y = pen_y + yoff;
+          blend_coverage(fb, bitmap, glyph_width, glyph_height, glyph_x,
+                         glyph_y, color);
+
+          stbtt_FreeBitmap(bitmap, NULL);
+        }
+
+      // Advance pen
+      pen_x += (int)(advance * scale);
+
+      // Kerning (if next char exists)
+      if (p[1])
+        {
+          int kern = stbtt_GetCodepointKernAdvance(font->info, *p, p[1]);
+          pen_x += (int)(kern * scale);
+        }
+    }
+}
+
+// Render the outline in one pass: each glyph's coverage is dilated by
+// thickness pixels (square max filter, the union of all the offset copies
+// the multi-pass outline draws) and blended once
+static void
+text_render_outline_dilated(framebuffer_t *fb,
+                            const font_resource_t *font,
+                            const char *text,
+                            int x,
+                            int y,
+                            uint32_t color,
+                            int font_size,
+                            int thickness)
+{
+  float scale = stbtt_ScaleForPixelHeight(font->info, font_size);
+
+  int ascent, descent, line_gap;
+  stbtt_GetFontVMetrics(font->info, &ascent, &descent, &line_gap);
+
+  int pen_x = x;
+  int pen_y = y + (int)(ascent * scale);
+
+  for (const char *p = text; *p; p++)
+    {
+      int advance, lsb;
+      stbtt_GetCodepointHMetrics(font->info, *p, &advance, &lsb);
+
+      int glyph_width, glyph_height, xoff, yoff;
+      unsigned char *bitmap = stbtt_GetCodepointBitmap(
+        font->info, 0, scale, *p, &glyph_width, &glyph_height, &xoff, &yoff);
 
-          for (int gy = 0; gy < glyph_height; gy++)
+      if (bitmap)
+        {
+          int out_width  = glyph_width + 2 * thickness;
+          int out_height = glyph_height + 2 * thickness;
+
+          // Horizontal max into rows (glyph_height x out_width), then
+          // vertical max into dilated (out_height x out_width)
+          if (grow_buffer_reserve(
+                &s_dilate_scratch,
+                (size_t)out_width * (glyph_height + out_height)))
             {
-              for (int gx = 0; gx < glyph_width; gx++)
+              unsigned char *rows = s_dilate_scratch.data;
+              unsigned char *dilated = rows + (size_t)out_width * glyph_height;
+
+              for (int gy = 0; gy < glyph_height; gy++)
                 {
-                  int px = glyph_x + gx;
-                  int py = glyph_y + gy;
+                  const unsigned char *src = &bitmap[gy * glyph_width];
+                  for (int ox = 0; ox < out_width; ox++)
+                    {
+                      int from   = ox - 2 * thickness;
+                      int to     = ox;
+                      unsigned m = 0;
+                      for (int gx = from < 0 ? 0 : from;
+                           gx <= to && gx < glyph_width; gx++)
+                        {
+                          m = src[gx] > m ? src[gx] : m;
+                        }
+                      rows[gy * out_width + ox] = (unsigned char)m;
+                    }
+                }
 
-                  if (framebuffer_in_bounds(fb, px, py))
+              for (int oy = 0; oy < out_height; oy++)
+                {
+                  int from = oy - 2 * thickness;
+                  int to   = oy;
+                  for (int ox = 0; ox < out_width; ox++)
                     {
-                      unsigned char glyph_alpha = bitmap[gy * glyph_width + gx];
-                      if (glyph_alpha > 0)
+                      unsigned m = 0;
+                      for (int gy = from < 0 ? 0 : from;
+                           gy <= to && gy < glyph_height; gy++)
                         {
-                          // Extract ARGB from color (internal format:
-                          // 0xAABBGGRR)
-                          uint32_t r            = color & 0xFF;
-                          uint32_t g            = (color >> 8) & 0xFF;
-                          uint32_t b            = (color >> 16) & 0xFF;
-                          uint32_t config_alpha = (color >> 24) & 0xFF;
-
-                          // Combine glyph alpha with config alpha
-                          // glyph_alpha = anti-aliasing from font (0-255)
-                          // config_alpha = user transparency setting (0-255)
-                          uint32_t final_alpha
-                            = (glyph_alpha * config_alpha) / 255;
-
-                          // Create RGBA color with combined alpha
-                          uint32_t pixel_color
-                            = (final_alpha << 24) | (b << 16) | (g << 8) | r;
-
-                          // Blend with background
-                          framebuffer_blend_pixel(fb, px, py, pixel_color);
+                          unsigned v = rows[gy * out_width + ox];
+                          m          = v > m ? v : m;
                         }
+                      dilated[oy * out_width + ox] = (unsigned char)m;
                     }
                 }
+
+              int glyph_x = pen_x + (int)(lsb * scale) + xoff - thickness;
+              int glyph_y = pen_y + yoff - thickness;
+              blend_coverage(fb, dilated, out_width, out_height, glyph_x,
+                             glyph_y, color);
             }
 
           stbtt_FreeBitmap(bitmap, NULL);
         }
 
-      // Advance pen
       pen_x += (int)(advance * scale);
-
-      // Kerning (if next char exists)
       if (p[1])
         {
           int kern = stbtt_GetCodepointKernAdvance(font->info, *p, p[1]);
@@ -138,7 +260,12 @@ text_render_with_outline(framebuffer_t *fb,
   uint32_t adjusted_outline = (main_alpha << 24) | outline_rgb;
 
   // Render outline/stroke first (if enabled)
-  if (outline_thickness > 0)
+  if (outline_thickness > 0 && s_single_pass_outline)
+    {
+      text_render_outline_dilated(fb, font, text, x, y, adjusted_outline,
+                                  font_size, outline_thickness);
+    }
+  else if (outline_thickness > 0)
     {
       // Render text multiple times with offsets to create outline effect
       // Use 8-direction offsets for circular outline
@@ -158,6 +285,18 @@ text_render_with_outline(framebuffer_t *fb,
   text_render_internal(fb, font, text, x, y, color, font_size, 0, 0);
 }
 
+void
+text_set_single_pass_outline(bool enabled)
+{
+  s_single_pass_outline = enabled;
+}
+
+void
+text_cleanup(void)
+{
+  grow_buffer_free(&s_dilate_scratch);
+}
+
 void
 text_render(framebuffer_t *fb,
             const font_resource_t *font,
@@ -13,6 +13,7 @@
 #include "core/framebuffer.h"
 #include "resources/font.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 // ════════════════════════════════════════════════════════════
@@ -55,6 +56,21 @@ void text_render_with_outline(framebuffer_t *fb,
                               int font_size,
                               int outline_thickness);
 
+// Draw outlines in one pass
+//
+// When enabled, text_render_with_outline() rasterizes each glyph once for
+// the outline and dilates it by outline_thickness instead of drawing the
+// text (2t+1)^2-1 times at offsets. The shape is the same; anti-aliased
+// edges come out slightly lighter, since the offset copies no longer
+// accumulate. Used by the frame-budget governor (OSD_QUALITY_OUTLINE_SINGLE).
+void text_set_single_pass_outline(bool enabled);
+
+// Free the scratch memory kept by single-pass outlines
+//
+// Call once at shutdown; text rendering still works afterwards and
+// allocates again as needed.
+void text_cleanup(void);
+
 // Render text without outline
 //
 // Simple text rendering without stroke effect.
@@ -0,0 +1,122 @@
+#include "yuv_blend.h"
+
+// ════════════════════════════════════════════════════════════
+// COLOR CONVERSION
+// ════════════════════════════════════════════════════════════
+
+// RGB to limited-range YUV weights (R, G, B), scaled by 256
+typedef struct
+{
+  int y[3];
+  int u[3];
+  int v[3];
+} yuv_coeffs_t;
+
+static const yuv_coeffs_t k_bt709
+  = { { 47, 157, 16 }, { -26, -86, 112 }, { 112, -102, -10 } };
+static const yuv_coeffs_t k_bt601
+  = { { 66, 129, 25 }, { -38, -74, 112 }, { 112, -94, -18 } };
+
+// Rounded weighted sum / 256 + offset (16 for luma, 128 for chroma); the
+// offset goes in before the shift so chroma sums are never negative
+static inline uint32_t
+rgb_to_yuv(const int w[3], int offset, int r, int g, int b)
+{
+  return (uint32_t)((w[0] * r + w[1] * g + w[2] * b + offset * 256 + 128)
+                    >> 8);
+}
+
+// ════════════════════════════════════════════════════════════
+// BLENDING IMPLEMENTATION
+// ════════════════════════════════════════════════════════════
+
+void
+yuv_blend_framebuffer(const framebuffer_t *fb,
+                      framebuffer_rect_t bounds,
+                      const yuv_frame_t *frame)
+{
+  if (bounds.width <= 0 || bounds.height <= 0)
+    {
+      return;
+    }
+
+  const yuv_coeffs_t *k = frame->bt601 ? &k_bt601 : &k_bt709;
+
+  int w       = (int)fb->width;
+  int h       = (int)fb->height;
+  int x_end   = bounds.x + bounds.width;
+  int y_end   = bounds.y + bounds.height;
+  int uv_step = frame->v ? 1 : 2; // NV12: U and V interleaved
+
+  // One 2x2 block (chroma sample) at a time, over the blocks covering the
+  // bounds; edge blocks of odd sizes have fewer pixels
+  for (int cy = bounds.y / 2; cy * 2 < y_end; cy++)
+    {
+      int y0   = cy * 2;
+      int rows = y0 + 1 < h ? 2 : 1;
+
+      const uint32_t *src[2];
+      uint8_t *luma[2];
+      for (int r = 0; r < rows; r++)
+        {
+          src[r]  = &fb->data[(size_t)(y0 + r) * w];
+          luma[r] = frame->y + (size_t)(y0 + r) * frame->y_stride;
+        }
+
+      uint8_t *u_row = frame->u + (size_t)cy * frame->uv_stride;
+      uint8_t *v_row = frame->v ? frame->v + (size_t)cy * frame->uv_stride
+                                : u_row + 1;
+
+      for (int cx = bounds.x / 2; cx * 2 < x_end; cx++)
+        {
+          int x0   = cx * 2;
+          int cols = x0 + 1 < w ? 2 : 1;
+
+          // Luma per pixel; alpha-weighted overlay chroma summed
+          uint32_t n  = 0;
+          uint32_t sa = 0;
+          uint32_t su = 0;
+          uint32_t sv = 0;
+          for (int r = 0; r < rows; r++)
+            {
+              for (int c = 0; c < cols; c++)
+                {
+                  uint32_t px = src[r][x0 + c];
+                  uint32_t a  = px >> 24;
+
+                  n++;
+                  if (a == 0)
+                    {
+                      continue;
+                    }
+
+                  int red   = px & 0xFF;
+                  int green = (px >> 8) & 0xFF;
+                  int blue  = (px >> 16) & 0xFF;
+
+                  uint32_t y = rgb_to_yuv(k->y, 16, red, green, blue);
+                  uint8_t *l = &luma[r][x0 + c];
+
+                  *l = (uint8_t)((y * a + *l * (255 - a) + 127) / 255);
+
+                  sa += a;
+                  su += a * rgb_to_yuv(k->u, 128, red, green, blue);
+                  sv += a * rgb_to_yuv(k->v, 128, red, green, blue);
+                }
+            }
+
+          if (sa == 0)
+            {
+              continue;
+            }
+
+          // Same as blending per pixel, then averaging the block
+          uint32_t total = n * 255;
+          uint8_t *u     = &u_row[cx * uv_step];
+          uint8_t *v     = &v_row[cx * uv_step];
+
+          *u = (uint8_t)((su + *u * (total - sa) + total / 2) / total);
+          *v = (uint8_t)((sv + *v * (total - sa) + total / 2) / total);
+        }
+    }
+}
@@ -0,0 +1,58 @@
+// YUV Blending
+// Composites the RGBA framebuffer onto a planar 4:2:0 video frame in place
+//
+// The overlay is treated as straight (not premultiplied) alpha, as the
+// GStreamer compositor does. Only overlay pixels are converted: luma is
+// blended per pixel, and each 2x2 chroma sample is blended with the
+// alpha-weighted average of the overlay chroma of its four pixels. Video
+// samples under fully transparent overlay pixels (and whole 2x2 blocks of
+// them) are not read or written.
+//
+// Conversion uses limited-range BT.709 (HD) or BT.601 (SD) coefficients
+// in 8-bit fixed point.
+
+#ifndef RENDERING_YUV_BLEND_H
+#define RENDERING_YUV_BLEND_H
+
+#include "../core/framebuffer.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ════════════════════════════════════════════════════════════
+// VIDEO FRAME
+// ════════════════════════════════════════════════════════════
+
+// A 4:2:0 frame the size of the framebuffer; chroma planes have
+// (width + 1) / 2 samples per row and (height + 1) / 2 rows
+typedef struct
+{
+  uint8_t *y;       // Luma plane
+  size_t y_stride;  // Bytes per luma row
+  uint8_t *u;       // U plane (I420) or interleaved UV plane (NV12)
+  uint8_t *v;       // V plane (I420); NULL for NV12
+  size_t uv_stride; // Bytes per chroma row (each plane)
+  bool bt601;       // BT.601 instead of BT.709 coefficients
+} yuv_frame_t;
+
+// ════════════════════════════════════════════════════════════
+// BLENDING
+// ════════════════════════════════════════════════════════════
+
+// Blend the framebuffer over the frame
+//
+// Parameters:
+//   fb:     Overlay (RGBA)
+//   bounds: Its content bounds; pixels outside are 0x00000000 and the
+//           frame outside them is left untouched
+//   frame:  Video frame, modified in place
+//
+// Usage:
+//   yuv_frame_t frame = { y, width, y + width * height, NULL, width, false };
+//   yuv_blend_framebuffer(&fb, bounds, &frame);  // NV12, BT.709
+void yuv_blend_framebuffer(const framebuffer_t *fb,
+                           framebuffer_rect_t bounds,
+                           const yuv_frame_t *frame);
+
+#endif // RENDERING_YUV_BLEND_H
@@ -0,0 +1,42 @@
+// Pre-decoded Nav Ball Skin Format
+// Raw RGBA skin blob produced at packaging time by tools/skin_pack.c
+//
+// Decoding PNG inside WASM on every startup is slow and pulls the whole
+// stb_image decoder into the module. Packages therefore ship each skin as a
+// raw blob that the loader reads with a single fread() and uses directly.
+//
+// FILE LAYOUT (little-endian):
+//   Offset  Size  Field
+//   0       4     magic        "NBSK"
+//   4       2     version      SKIN_BLOB_VERSION
+//   6       2     header_size  Bytes before pixel data (16 for version 1)
+//   8       4     width        Pixels
+//   12      4     height       Pixels
+//   16      w*h*4 pixels       RGBA, row-major, top row first
+//
+// Blob files sit next to the source PNG with the extension replaced, e.g.
+// resources/navball_skins/stock.png → stock.nbskin.
+
+#ifndef RESOURCES_SKIN_BLOB_H
+#define RESOURCES_SKIN_BLOB_H
+
+#include <stdint.h>
+
+#define SKIN_BLOB_MAGIC "NBSK"
+#define SKIN_BLOB_VERSION 1
+#define SKIN_BLOB_HEADER_SIZE 16
+#define SKIN_BLOB_EXTENSION ".nbskin"
+
+// Largest accepted skin edge (guards allocations against corrupt headers)
+#define SKIN_BLOB_MAX_DIMENSION 8192
+
+typedef struct
+{
+  char magic[4];
+  uint16_t version;
+  uint16_t header_size;
+  uint32_t width;
+  uint32_t height;
+} skin_blob_header_t;
+
+#endif // RESOURCES_SKIN_BLOB_H
@@ -0,0 +1,201 @@
+// Sparse Frame Implementation
+// Tile occupancy within the content bounds, then packed tile copies
+
+#include "sparse_frame.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t *s_block      = NULL;  // Header, bitmap, tiles
+static size_t s_capacity     = 0;     // Bytes allocated at s_block
+static bool s_valid          = false; // s_block holds the block below
+static uint32_t s_tile_size  = 0;     // Tile size of that block
+static uint32_t s_generation = 0;     // Framebuffer generation of it
+
+// Grow the block to at least size bytes, keeping its contents
+static bool
+reserve(size_t size)
+{
+  if (size <= s_capacity)
+    {
+      return true;
+    }
+
+  size_t capacity = s_capacity ? s_capacity : 4096;
+  while (capacity < size)
+    {
+      capacity *= 2;
+    }
+
+  uint8_t *block = (uint8_t *)realloc(s_block, capacity);
+  if (!block)
+    {
+      return false;
+    }
+  s_block    = block;
+  s_capacity = capacity;
+  return true;
+}
+
+// True if any pixel of [x0, x1) x [y0, y1) is set
+static bool
+area_has_content(const framebuffer_t *fb, int x0, int y0, int x1, int y1)
+{
+  for (int y = y0; y < y1; y++)
+    {
+      const uint32_t *row = &fb->data[(size_t)y * fb->width];
+
+      for (int x = x0; x < x1; x++)
+        {
+          if (row[x])
+            {
+              return true;
+            }
+        }
+    }
+  return false;
+}
+
+// Copy tile (tx, ty) to out (tile_size rows of tile_size pixels), zero
+// past the framebuffer edges
+static void
+pack_tile(const framebuffer_t *fb,
+          uint32_t tile_size,
+          uint32_t tx,
+          uint32_t ty,
+          uint32_t *out)
+{
+  uint32_t x0 = tx * tile_size;
+  uint32_t y0 = ty * tile_size;
+  uint32_t w  = fb->width - x0 < tile_size ? fb->width - x0 : tile_size;
+  uint32_t h  = fb->height - y0 < tile_size ? fb->height - y0 : tile_size;
+
+  for (uint32_t y = 0; y < h; y++)
+    {
+      uint32_t *dst = &out[(size_t)y * tile_size];
+
+      memcpy(dst, &fb->data[(size_t)(y0 + y) * fb->width + x0],
+             w * sizeof(uint32_t));
+      if (w < tile_size)
+        {
+          memset(dst + w, 0, (tile_size - w) * sizeof(uint32_t));
+        }
+    }
+  if (h < tile_size)
+    {
+      memset(&out[(size_t)h * tile_size], 0,
+             (size_t)(tile_size - h) * tile_size * sizeof(uint32_t));
+    }
+}
+
+const wasm_osd_sparse_frame_t *
+sparse_frame_encode(const framebuffer_t *fb,
+                    framebuffer_rect_t bounds,
+                    uint32_t tile_size,
+                    uint32_t generation)
+{
+  if (tile_size < 8 || tile_size > 256 || (tile_size & (tile_size - 1)))
+    {
+      return NULL;
+    }
+
+  // Same frame as last time
+  if (s_valid && s_generation == generation && s_tile_size == tile_size)
+    {
+      return (const wasm_osd_sparse_frame_t *)s_block;
+    }
+  s_valid = false;
+
+  uint32_t tiles_x      = (fb->width + tile_size - 1) / tile_size;
+  uint32_t tiles_y      = (fb->height + tile_size - 1) / tile_size;
+  uint32_t bitmap_words = (tiles_x * tiles_y + 31) / 32;
+  size_t tile_bytes     = (size_t)tile_size * tile_size * sizeof(uint32_t);
+  size_t tiles_offset   = sizeof(wasm_osd_sparse_frame_t)
+                        + bitmap_words * sizeof(uint32_t);
+
+  if (!reserve(tiles_offset))
+    {
+      return NULL;
+    }
+
+  uint32_t *bitmap = (uint32_t *)(s_block + sizeof(wasm_osd_sparse_frame_t));
+  memset(bitmap, 0, bitmap_words * sizeof(uint32_t));
+
+  // Occupancy: only tiles overlapping the content bounds can be set, and
+  // only their part inside the bounds needs scanning
+  uint32_t count = 0;
+  if (bounds.width > 0 && bounds.height > 0)
+    {
+      int ts  = (int)tile_size;
+      int bx1 = bounds.x + bounds.width;
+      int by1 = bounds.y + bounds.height;
+
+      for (int ty = bounds.y / ts; ty <= (by1 - 1) / ts; ty++)
+        {
+          int y0 = ty * ts > bounds.y ? ty * ts : bounds.y;
+          int y1 = (ty + 1) * ts < by1 ? (ty + 1) * ts : by1;
+
+          for (int tx = bounds.x / ts; tx <= (bx1 - 1) / ts; tx++)
+            {
+              int x0 = tx * ts > bounds.x ? tx * ts : bounds.x;
+              int x1 = (tx + 1) * ts < bx1 ? (tx + 1) * ts : bx1;
+
+              if (area_has_content(fb, x0, y0, x1, y1))
+                {
+                  uint32_t i = (uint32_t)ty * tiles_x + (uint32_t)tx;
+                  bitmap[i / 32] |= 1u << (i % 32);
+                  count++;
+                }
+            }
+        }
+    }
+
+  size_t size = tiles_offset + count * tile_bytes;
+  if (size > UINT32_MAX || !reserve(size))
+    {
+      return NULL;
+    }
+
+  // The block may have moved
+  bitmap        = (uint32_t *)(s_block + sizeof(wasm_osd_sparse_frame_t));
+  uint32_t *out = (uint32_t *)(s_block + tiles_offset);
+  for (uint32_t i = 0; i < tiles_x * tiles_y; i++)
+    {
+      if (bitmap[i / 32] & (1u << (i % 32)))
+        {
+          pack_tile(fb, tile_size, i % tiles_x, i / tiles_x, out);
+          out += (size_t)tile_size * tile_size;
+        }
+    }
+
+  wasm_osd_sparse_frame_t *header = (wasm_osd_sparse_frame_t *)s_block;
+
+  header->magic      = WASM_OSD_SPARSE_MAGIC;
+  header->width      = fb->width;
+  header->height     = fb->height;
+  header->tile_size  = tile_size;
+  header->tiles_x    = tiles_x;
+  header->tiles_y    = tiles_y;
+  header->tile_count = count;
+  header->tile_bytes = (uint32_t)tile_bytes;
+  header->occupancy  = (uint32_t)sizeof(wasm_osd_sparse_frame_t);
+  header->tiles      = (uint32_t)tiles_offset;
+  header->size       = (uint32_t)size;
+  header->generation = generation;
+
+  s_valid      = true;
+  s_tile_size  = tile_size;
+  s_generation = generation;
+  return header;
+}
+
+void
+sparse_frame_free(void)
+{
+  free(s_block);
+  s_block     = NULL;
+  s_capacity  = 0;
+  s_valid     = false;
+  s_tile_size = 0;
+}
@@ -0,0 +1,47 @@
+// Sparse Frame
+// Compact transfer form of the framebuffer: occupied tiles only
+//
+// ════════════════════════════════════════════════════════════
+// WHY THIS EXISTS:
+// A 1080p framebuffer is 8 MB of RGBA, and an OSD frame is mostly
+// transparent zeros around a crosshair, some text and a few boxes. Hosts
+// that read back and upload the whole buffer every frame (or post it to
+// a worker) pay for the zeros. The sparse form keeps only the tiles with
+// content, plus a bitmap saying which ones they are; its layout is the
+// host API type wasm_osd_sparse_frame_t (see wasm_exports.h).
+//
+// COST:
+// Tiles outside the content bounds of the frame are never scanned; inside
+// them, a tile is scanned until its first non-zero pixel and copied if it
+// has one. The block is cached per framebuffer generation, so hosts may
+// ask for it on frames that were not re-rendered at no cost.
+// ════════════════════════════════════════════════════════════
+
+#ifndef SPARSE_FRAME_H
+#define SPARSE_FRAME_H
+
+#include <stdint.h>
+
+#include "core/framebuffer.h"
+#include "wasm/wasm_exports.h"
+
+// Encode a framebuffer into the module-owned block
+//
+// Parameters:
+//   fb:         Framebuffer to encode
+//   bounds:     Its content bounds (pixels outside are 0x00000000)
+//   tile_size:  Tile edge, a power of two from 8 to 256
+//   generation: Identifies the framebuffer content; a call with the same
+//               generation and tile size returns the previous block
+//
+// Returns the block (valid until the next call or sparse_frame_free()),
+// or NULL if tile_size is invalid or the block cannot be allocated
+const wasm_osd_sparse_frame_t *sparse_frame_encode(const framebuffer_t *fb,
+                                                   framebuffer_rect_t bounds,
+                                                   uint32_t tile_size,
+                                                   uint32_t generation);
+
+// Free the block
+void sparse_frame_free(void);
+
+#endif // SPARSE_FRAME_H
@@ -0,0 +1,278 @@
+// State History Implementation
+// Ring of recent decoded states, display-time and frame PTS lookups
+
+#include "state_history.h"
+
+#include "utils/math.h"
+
+#include <string.h>
+
+// ════════════════════════════════════════════════════════════
+// RING
+// ════════════════════════════════════════════════════════════
+
+void
+state_history_reset(state_history_t *history)
+{
+  history->newest = 0;
+  history->count  = 0;
+}
+
+void
+state_history_push(state_history_t *history, const ser_JonGUIState *state)
+{
+  if (history->count > 0)
+    {
+      const ser_JonGUIState *newest = &history->states[history->newest];
+
+      if (state->system_monotonic_time_us == newest->system_monotonic_time_us)
+        {
+          memcpy(&history->states[history->newest], state, sizeof(*state));
+          return;
+        }
+
+      if (state->system_monotonic_time_us < newest->system_monotonic_time_us)
+        {
+          state_history_reset(history);
+        }
+    }
+
+  if (history->count > 0)
+    {
+      history->newest = (history->newest + 1) % STATE_HISTORY_DEPTH;
+    }
+  memcpy(&history->states[history->newest], state, sizeof(*state));
+  if (history->count < STATE_HISTORY_DEPTH)
+    {
+      history->count++;
+    }
+}
+
+// i-th newest state (0 = newest)
+static const ser_JonGUIState *
+history_at(const state_history_t *history, int i)
+{
+  int index = (history->newest - i + STATE_HISTORY_DEPTH)
+              % STATE_HISTORY_DEPTH;
+  return &history->states[index];
+}
+
+// ════════════════════════════════════════════════════════════
+// INTERPOLATION
+// ════════════════════════════════════════════════════════════
+//
+// States are copied with memcpy() so padding stays zero and blended
+// states compare bytewise like decoded ones.
+
+static void
+blend_attitude(double *azimuth,
+               double *elevation,
+               double *bank,
+               double a_azimuth,
+               double a_elevation,
+               double a_bank,
+               double b_azimuth,
+               double b_elevation,
+               double b_bank,
+               double t)
+{
+  quat_t qa = quat_from_attitude(a_azimuth, a_elevation, a_bank);
+  quat_t qb = quat_from_attitude(b_azimuth, b_elevation, b_bank);
+  quat_to_attitude(quat_slerp(qa, qb, t), azimuth, elevation, bank);
+}
+
+// Rotary speeds are normalized; extrapolation must not leave [-1, 1]
+static double
+blend_speed(double a, double b, double t)
+{
+  return clamp_double(lerp(a, b, t), -1.0, 1.0);
+}
+
+/**
+ * Blend the time-varying fields of a and b into out
+ *
+ * out already holds the state the other fields come from. Submessages
+ * missing from either state are left as they are.
+ */
+static void
+blend_states(ser_JonGUIState *out,
+             const ser_JonGUIState *a,
+             const ser_JonGUIState *b,
+             double t)
+{
+  if (a->has_actual_space_time && b->has_actual_space_time)
+    {
+      const ser_JonGuiDataActualSpaceTime *sa = &a->actual_space_time;
+      const ser_JonGuiDataActualSpaceTime *sb = &b->actual_space_time;
+      blend_attitude(&out->actual_space_time.azimuth,
+                     &out->actual_space_time.elevation,
+                     &out->actual_space_time.bank, sa->azimuth, sa->elevation,
+                     sa->bank, sb->azimuth, sb->elevation, sb->bank, t);
+    }
+
+  if (a->has_compass && b->has_compass)
+    {
+      blend_attitude(&out->compass.azimuth, &out->compass.elevation,
+                     &out->compass.bank, a->compass.azimuth,
+                     a->compass.elevation, a->compass.bank,
+                     b->compass.azimuth, b->compass.elevation,
+                     b->compass.bank, t);
+    }
+
+  if (a->has_rotary && b->has_rotary)
+    {
+      const ser_JonGuiDataRotary *ra = &a->rotary;
+      const ser_JonGuiDataRotary *rb = &b->rotary;
+      ser_JonGuiDataRotary *r        = &out->rotary;
+
+      // Gimbal angles: shortest way around in azimuth
+      r->azimuth = normalize_angle_360(
+        ra->azimuth + angle_difference(rb->azimuth, ra->azimuth) * t);
+      r->elevation = lerp(ra->elevation, rb->elevation, t);
+      blend_attitude(&r->platform_azimuth, &r->platform_elevation,
+                     &r->platform_bank, ra->platform_azimuth,
+                     ra->platform_elevation, ra->platform_bank,
+                     rb->platform_azimuth, rb->platform_elevation,
+                     rb->platform_bank, t);
+
+      // Crosshair speed indicators
+      r->azimuth_speed = blend_speed(ra->azimuth_speed, rb->azimuth_speed, t);
+      r->elevation_speed
+        = blend_speed(ra->elevation_speed, rb->elevation_speed, t);
+    }
+}
+
+bool
+state_history_at_time(const state_history_t *history,
+                      uint64_t time_us,
+                      ser_JonGUIState *out)
+{
+  if (history->count == 0)
+    {
+      return false;
+    }
+
+  const ser_JonGUIState *newest = history_at(history, 0);
+  uint64_t newest_us            = newest->system_monotonic_time_us;
+
+  // At or past the newest state: extrapolate along the last interval
+  if (time_us >= newest_us)
+    {
+      memcpy(out, newest, sizeof(*out));
+      if (history->count < 2 || time_us == newest_us)
+        {
+          return true;
+        }
+
+      const ser_JonGUIState *prev = history_at(history, 1);
+      uint64_t prev_us            = prev->system_monotonic_time_us;
+      uint64_t ahead_us           = time_us - newest_us;
+      if (ahead_us > STATE_HISTORY_MAX_EXTRAPOLATION_US)
+        {
+          ahead_us = STATE_HISTORY_MAX_EXTRAPOLATION_US;
+        }
+
+      double t = 1.0 + (double)ahead_us / (double)(newest_us - prev_us);
+      blend_states(out, prev, newest, t);
+      out->system_monotonic_time_us = newest_us + ahead_us;
+      return true;
+    }
+
+  // Find the states on either side of time_us
+  for (int i = 1; i < history->count; i++)
+    {
+      const ser_JonGUIState *a = history_at(history, i);
+      uint64_t a_us            = a->system_monotonic_time_us;
+      if (a_us > time_us)
+        {
+          continue;
+        }
+
+      const ser_JonGUIState *b = history_at(history, i - 1);
+      uint64_t b_us            = b->system_monotonic_time_us;
+
+      memcpy(out, a, sizeof(*out));
+      if (a_us < time_us)
+        {
+          double t = (double)(time_us - a_us) / (double)(b_us - a_us);
+          blend_states(out, a, b, t);
+          out->system_monotonic_time_us = time_us;
+        }
+      return true;
+    }
+
+  // Before the oldest state: no extrapolation into the past
+  memcpy(out, history_at(history, history->count - 1), sizeof(*out));
+  return true;
+}
+
+// Frame PTS of a state for the selected stream (0 = none)
+static uint64_t
+state_pts(const ser_JonGUIState *state, bool heat)
+{
+  return heat ? state->frame_pts_heat_ns : state->frame_pts_day_ns;
+}
+
+bool
+state_history_at_pts(const state_history_t *history,
+                     uint64_t pts_ns,
+                     bool heat,
+                     ser_JonGUIState *out)
+{
+  // Closest states at or before / after pts_ns; PTS order need not match
+  // arrival order, and on ties the newer state wins
+  const ser_JonGUIState *before = NULL;
+  const ser_JonGUIState *after  = NULL;
+
+  for (int i = history->count - 1; i >= 0; i--)
+    {
+      const ser_JonGUIState *state = history_at(history, i);
+      uint64_t pts                 = state_pts(state, heat);
+      if (pts == 0)
+        {
+          continue;
+        }
+
+      if (pts <= pts_ns)
+        {
+          if (!before || pts >= state_pts(before, heat))
+            {
+              before = state;
+            }
+        }
+      else if (!after || pts <= state_pts(after, heat))
+        {
+          after = state;
+        }
+    }
+
+  if (!before && !after)
+    {
+      return false;
+    }
+
+  if (!before || !after || state_pts(before, heat) == pts_ns)
+    {
+      memcpy(out, before ? before : after, sizeof(*out));
+      return true;
+    }
+
+  uint64_t before_pts = state_pts(before, heat);
+  uint64_t span_ns    = state_pts(after, heat) - before_pts;
+  double t            = (double)(pts_ns - before_pts) / (double)span_ns;
+
+  memcpy(out, before, sizeof(*out));
+  blend_states(out, before, after, t);
+  out->system_monotonic_time_us
+    = (uint64_t)lerp((double)before->system_monotonic_time_us,
+                     (double)after->system_monotonic_time_us, t);
+  if (heat)
+    {
+      out->frame_pts_heat_ns = pts_ns;
+    }
+  else
+    {
+      out->frame_pts_day_ns = pts_ns;
+    }
+  return true;
+}
@@ -0,0 +1,85 @@
+// State History
+// The last few decoded states, for rendering at a display time or for a
+// video frame
+//
+// ════════════════════════════════════════════════════════════
+// WHY THIS EXISTS:
+// States arrive at ~30 Hz with jitter while the display refreshes at 60 to
+// 120 Hz. Keeping recent states with their system_monotonic_time_us lets
+// the plugin build the state "as of" any display time: attitude is
+// interpolated between the two states around it (or extrapolated past the
+// newest one), so the navball and speed indicators move smoothly and
+// pipeline latency can be hidden.
+//
+// The same states are looked up by frame_pts_day_ns / frame_pts_heat_ns
+// when compositing onto recorded video, so the overlay matches the frame
+// it is burned into even when encoding runs ahead of or behind ingestion.
+//
+// INTERPOLATED FIELDS:
+// - actual_space_time / compass azimuth, elevation, bank (quaternion slerp)
+// - rotary azimuth, elevation (shortest-arc lerp)
+// - rotary azimuth_speed, elevation_speed (lerp, clamped to [-1, 1])
+// All other fields are those of the newest state at or before the time
+// (or PTS).
+// ════════════════════════════════════════════════════════════
+
+#ifndef STATE_HISTORY_H
+#define STATE_HISTORY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "proto/jon_shared_data.pb.h"
+
+// ~0.5 s of states at 30 Hz: how far frame PTS lookups can lag ingestion
+#define STATE_HISTORY_DEPTH 16
+
+// Longest time extrapolated past the newest state; later display times
+// see the attitude reached at this point
+#define STATE_HISTORY_MAX_EXTRAPOLATION_US 50000
+
+typedef struct
+{
+  ser_JonGUIState states[STATE_HISTORY_DEPTH]; // Ring, oldest overwritten
+  int newest;                                  // Index of the newest state
+  int count;                                   // Valid states in the ring
+} state_history_t;
+
+// Forget all states
+void state_history_reset(state_history_t *history);
+
+// Record a decoded state (copied)
+// A state with the same system_monotonic_time_us as the newest replaces
+// it; an older one (producer restart) starts a new history.
+void state_history_push(state_history_t *history,
+                        const ser_JonGUIState *state);
+
+// Build the state for a display time
+//
+// Parameters:
+//   time_us: Display time on the system_monotonic_time_us clock
+//   out:     Receives the state (may not alias the history)
+//
+// Returns false if the history is empty. Times before the oldest state
+// get the oldest state unchanged.
+bool state_history_at_time(const state_history_t *history,
+                           uint64_t time_us,
+                           ser_JonGUIState *out);
+
+// Build the state for a video frame
+//
+// Parameters:
+//   pts_ns: Frame PTS in nanoseconds
+//   heat:   Match frame_pts_heat_ns instead of frame_pts_day_ns
+//   out:    Receives the state (may not alias the history)
+//
+// The newest state carrying exactly pts_ns is used as-is; a PTS between
+// two states is interpolated like a display time. Outside the recorded
+// PTS range the nearest state is used (no extrapolation). Returns false
+// if no state carries a PTS for the stream.
+bool state_history_at_pts(const state_history_t *history,
+                          uint64_t pts_ns,
+                          bool heat,
+                          ser_JonGUIState *out);
+
+#endif // STATE_HISTORY_H
@@ -17,14 +17,31 @@
  * 3. Call Astronomy_Equator() to get RA/Dec
  * 4. Call Astronomy_Horizon() to convert to azimuth/altitude
  * 5. Apply atmospheric refraction correction
+ *
+ * PRECOMPUTED TABLE (preferred when loaded, see utils/ephemeris_table.h):
+ * 1. Evaluate Chebyshev series for geocentric Sun/Moon vectors and
+ *    GAST - ERA at UT days since J2000
+ * 2. Subtract the observer's geocentric position (topocentric parallax)
+ * 3. Rotate into the local horizon frame and apply the same refraction model
+ *
+ * Builds with CELESTIAL_TABLE_ONLY omit the Astronomy Engine entirely and
+ * report invalid positions outside the table's date span.
+ *
+ * The ephemeris cache evaluates this flow only at the ends of fixed time
+ * segments and interpolates direction vectors in between.
  */
 
 #include "celestial_position.h"
 
+#ifndef CELESTIAL_TABLE_ONLY
 #include "astronomy.h"
+#endif
+#include "utils/ephemeris_table.h"
 #include "utils/logging.h"
 #include "utils/math_decl.h" /* Math declarations for WASI SDK + cglm */
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /* cglm - Optimized C graphics math library (quaternions, matrices) */
@@ -53,10 +70,53 @@
  */
 #define UNIX_EPOCH_TO_J2000_DAYS 10957.5
 
+/**
+ * @def DEG_TO_RAD
+ * @brief Convert degrees to radians
+ */
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#define DEG_TO_RAD(deg) ((deg) * M_PI / 180.0)
+
+/**
+ * @def RAD_TO_DEG
+ * @brief Convert radians to degrees
+ */
+#define RAD_TO_DEG(rad) ((rad) * 180.0 / M_PI)
+
+/**
+ * @def KM_PER_AU_TABLE
+ * @brief Kilometers per astronomical unit (matches Astronomy Engine)
+ */
+#define KM_PER_AU_TABLE 1.4959787069098932e+8
+
+/**
+ * @def EARTH_EQUATORIAL_RADIUS_TABLE_KM
+ * @brief WGS84-style equatorial radius (matches Astronomy Engine)
+ */
+#define EARTH_EQUATORIAL_RADIUS_TABLE_KM 6378.1366
+
+/**
+ * @def EARTH_FLATTENING_TABLE
+ * @brief Polar/equatorial radius ratio (matches Astronomy Engine)
+ */
+#define EARTH_FLATTENING_TABLE 0.996647180302104
+
+/**
+ * @brief Loaded ephemeris table (whole file, used in place)
+ */
+static struct
+{
+  uint8_t *blob;
+  const ephemeris_table_header_t *header;
+} g_ephemeris;
+
 /* ════════════════════════════════════════════════════════════
  * PRIVATE HELPER FUNCTIONS
  * ════════════════════════════════════════════════════════════ */
 
+#ifndef CELESTIAL_TABLE_ONLY
 /**
  * @brief Convert Unix timestamp to Astronomy Engine time
  *
@@ -128,6 +188,264 @@ calculate_body_position(astro_body_t body,
 
   return result;
 }
+#endif /* CELESTIAL_TABLE_ONLY */
+
+/* ════════════════════════════════════════════════════════════
+ * PRECOMPUTED EPHEMERIS TABLE
+ * ════════════════════════════════════════════════════════════ */
+
+/**
+ * @brief Load and validate an ephemeris table file
+ *
+ * Reads the whole file with a single fread() and keeps it in memory;
+ * coefficients are evaluated in place.
+ *
+ * @param filepath Path to the table
+ * @return True if the table was loaded (replacing any previous one)
+ */
+static bool
+ephemeris_load(const char *filepath)
+{
+  FILE *file = fopen(filepath, "rb");
+  if (!file)
+    return false;
+
+  fseek(file, 0, SEEK_END);
+  long file_size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+
+  if (file_size < EPHEMERIS_TABLE_HEADER_SIZE)
+    {
+      LOG_ERROR("Ephemeris table too small: %s (%ld bytes)", filepath,
+                file_size);
+      fclose(file);
+      return false;
+    }
+
+  uint8_t *blob = (uint8_t *)malloc((size_t)file_size);
+  if (!blob)
+    {
+      fclose(file);
+      return false;
+    }
+
+  size_t read = fread(blob, 1, (size_t)file_size, file);
+  fclose(file);
+
+  const ephemeris_table_header_t *header
+    = (const ephemeris_table_header_t *)blob;
+
+  bool ok = read == (size_t)file_size
+            && memcmp(header->magic, EPHEMERIS_TABLE_MAGIC, 4) == 0
+            && header->version == EPHEMERIS_TABLE_VERSION
+            && header->header_size == EPHEMERIS_TABLE_HEADER_SIZE
+            && header->span_days > 0;
+
+  for (int ch = 0; ok && ch < EPHEMERIS_CHANNEL_COUNT; ch++)
+    {
+      const ephemeris_channel_t *info = &header->channels[ch];
+      size_t bytes = (size_t)info->segment_count * info->components
+                     * info->coeffs * sizeof(float);
+
+      ok = info->components >= 1
+           && info->components <= EPHEMERIS_MAX_COMPONENTS
+           && info->coeffs >= 1 && info->coeffs <= EPHEMERIS_MAX_COEFFS
+           && info->segment_days > 0.0
+           && info->segment_count * info->segment_days >= header->span_days
+           && info->offset % sizeof(float) == 0
+           && info->offset >= EPHEMERIS_TABLE_HEADER_SIZE
+           && info->offset + bytes <= (size_t)file_size;
+    }
+
+  if (!ok
+      || header->channels[EPHEMERIS_CHANNEL_SUN].components != 3
+      || header->channels[EPHEMERIS_CHANNEL_MOON].components != 3)
+    {
+      LOG_ERROR("Invalid ephemeris table: %s", filepath);
+      free(blob);
+      return false;
+    }
+
+  free(g_ephemeris.blob);
+  g_ephemeris.blob   = blob;
+  g_ephemeris.header = header;
+
+  LOG_INFO("Ephemeris table loaded: %s (%u days, %ld bytes)", filepath,
+           header->span_days, file_size);
+  return true;
+}
+
+/**
+ * @brief Evaluate one table channel at UT days since J2000
+ *
+ * @param channel EPHEMERIS_CHANNEL_* index
+ * @param ut UT days since J2000
+ * @param out Output values (components of the channel)
+ * @return False if no table is loaded or ut is outside its span
+ */
+static bool
+ephemeris_eval(int channel, double ut, double out[3])
+{
+  const ephemeris_table_header_t *header = g_ephemeris.header;
+  if (!header)
+    return false;
+
+  double rel = ut - header->start_ut;
+  if (rel < 0.0 || rel >= (double)header->span_days)
+    return false;
+
+  const ephemeris_channel_t *info = &header->channels[channel];
+  uint32_t segment = (uint32_t)(rel / info->segment_days);
+  if (segment >= info->segment_count)
+    return false;
+
+  /* Map time within the segment to [-1, 1] */
+  double x = 2.0 * (rel - segment * info->segment_days) / info->segment_days
+             - 1.0;
+
+  const float *coeffs
+    = (const float *)(g_ephemeris.blob + info->offset)
+      + (size_t)segment * info->components * info->coeffs;
+
+  /* Clenshaw recurrence per component (coefficient 0 is stored halved) */
+  for (uint32_t comp = 0; comp < info->components; comp++)
+    {
+      const float *c = coeffs + comp * info->coeffs;
+      double b1 = 0.0, b2 = 0.0;
+
+      for (uint32_t j = info->coeffs - 1; j > 0; j--)
+        {
+          double b0 = 2.0 * x * b1 - b2 + c[j];
+          b2        = b1;
+          b1        = b0;
+        }
+      out[comp] = x * b1 - b2 + c[0];
+    }
+
+  return true;
+}
+
+/**
+ * @brief Earth Rotation Angle in degrees (IERS 2003, as Astronomy Engine)
+ *
+ * @param ut UT days since J2000
+ */
+static double
+earth_rotation_angle(double ut)
+{
+  double theta
+    = 360.0 * fmod(0.7790572732640 + 0.00273781191135448 * ut + fmod(ut, 1.0),
+                   1.0);
+  return (theta < 0.0) ? theta + 360.0 : theta;
+}
+
+/**
+ * @brief Atmospheric refraction in degrees (Saemundsson, "normal" mode)
+ *
+ * Same model as Astronomy_Refraction(REFRACTION_NORMAL, altitude).
+ *
+ * @param altitude Unrefracted altitude in degrees
+ */
+static double
+refraction_deg(double altitude)
+{
+  if (altitude < -90.0 || altitude > 90.0)
+    return 0.0;
+
+  double hd = (altitude < -1.0) ? -1.0 : altitude;
+  double refr
+    = (1.02 / tan(DEG_TO_RAD(hd + 10.3 / (hd + 5.11)))) / 60.0;
+
+  /* Fade refraction out toward the nadir */
+  if (altitude < -1.0)
+    refr *= (altitude + 90.0) / 89.0;
+
+  return refr;
+}
+
+/**
+ * @brief Horizontal position of a body from its geocentric vector
+ *
+ * @param body Geocentric apparent position, equator of date (AU)
+ * @param gast Greenwich apparent sidereal time (degrees)
+ * @param observer Observer location (geodetic)
+ * @return Refracted horizontal position
+ */
+static celestial_position_t
+table_body_position(const double body[3],
+                    double gast,
+                    observer_location_t observer)
+{
+  celestial_position_t result = { .valid = false };
+
+  double lat    = DEG_TO_RAD(observer.latitude);
+  double theta  = DEG_TO_RAD(gast + observer.longitude);
+  double sinlat = sin(lat);
+  double coslat = cos(lat);
+  double sinth  = sin(theta);
+  double costh  = cos(theta);
+
+  /* Observer's geocentric position on the reference ellipsoid (AU) */
+  double c = 1.0 / hypot(coslat, sinlat * EARTH_FLATTENING_TABLE);
+  double s = c * EARTH_FLATTENING_TABLE * EARTH_FLATTENING_TABLE;
+  double height_km = observer.altitude / 1000.0;
+  double ach       = EARTH_EQUATORIAL_RADIUS_TABLE_KM * c + height_km;
+  double ash       = EARTH_EQUATORIAL_RADIUS_TABLE_KM * s + height_km;
+
+  double p[3];
+  p[0] = body[0] - ach * coslat * costh / KM_PER_AU_TABLE;
+  p[1] = body[1] - ach * coslat * sinth / KM_PER_AU_TABLE;
+  p[2] = body[2] - ash * sinlat / KM_PER_AU_TABLE;
+
+  /* Project onto local zenith / north / west unit vectors */
+  double pz = p[0] * coslat * costh + p[1] * coslat * sinth + p[2] * sinlat;
+  double pn = -p[0] * sinlat * costh - p[1] * sinlat * sinth + p[2] * coslat;
+  double pw = p[0] * sinth - p[1] * costh;
+
+  double proj = hypot(pn, pw);
+  double az   = 0.0;
+  if (proj > 0.0)
+    {
+      az = -RAD_TO_DEG(atan2(pw, pn));
+      if (az < 0.0)
+        az += 360.0;
+    }
+
+  double altitude = 90.0 - RAD_TO_DEG(atan2(proj, pz));
+
+  result.azimuth  = az;
+  result.altitude = altitude + refraction_deg(altitude);
+  result.valid    = true;
+
+  return result;
+}
+
+/**
+ * @brief Calculate Sun and Moon positions from the loaded table
+ *
+ * @return False if no table covers the timestamp
+ */
+static bool
+table_calculate(int64_t unix_timestamp,
+                observer_location_t observer,
+                celestial_positions_t *out)
+{
+  double ut = (unix_timestamp / SECONDS_PER_DAY) - UNIX_EPOCH_TO_J2000_DAYS;
+  double sun[3], moon[3], sidereal[3];
+
+  if (!ephemeris_eval(EPHEMERIS_CHANNEL_SUN, ut, sun)
+      || !ephemeris_eval(EPHEMERIS_CHANNEL_MOON, ut, moon)
+      || !ephemeris_eval(EPHEMERIS_CHANNEL_SIDEREAL, ut, sidereal))
+    {
+      return false;
+    }
+
+  double gast = earth_rotation_angle(ut) + sidereal[0];
+
+  out->sun  = table_body_position(sun, gast, observer);
+  out->moon = table_body_position(moon, gast, observer);
+  return true;
+}
 
 /* ════════════════════════════════════════════════════════════
  * PUBLIC API IMPLEMENTATION
@@ -136,9 +454,29 @@ calculate_body_position(astro_body_t body,
 bool
 celestial_init(void)
 {
-  /* Astronomy Engine is a header-only library with no initialization
-   * required. This function is provided for API completeness and future
-   * extensibility (e.g., caching, LUT precomputation). */
+  /* Packaged table first, then the `make ephemeris` output */
+  static const char *const table_paths[]
+    = { "resources/" EPHEMERIS_TABLE_FILENAME,
+        "build/resources/" EPHEMERIS_TABLE_FILENAME };
+
+  bool loaded = g_ephemeris.header != NULL;
+  for (size_t i = 0; !loaded && i < sizeof(table_paths) / sizeof(*table_paths);
+       i++)
+    {
+      loaded = ephemeris_load(table_paths[i]);
+    }
+
+#ifdef CELESTIAL_TABLE_ONLY
+  if (!loaded)
+    {
+      LOG_ERROR("Ephemeris table not found (table-only build)");
+      return false;
+    }
+#else
+  if (!loaded)
+    LOG_INFO("No ephemeris table, using Astronomy Engine");
+#endif
+
   LOG_INFO("Celestial position system initialized");
   return true;
 }
@@ -148,6 +486,11 @@ celestial_calculate(int64_t unix_timestamp, observer_location_t observer)
 {
   celestial_positions_t result = { .sun.valid = false, .moon.valid = false };
 
+  /* Precomputed table covers the timestamp: no Astronomy Engine needed */
+  if (table_calculate(unix_timestamp, observer, &result))
+    return result;
+
+#ifndef CELESTIAL_TABLE_ONLY
   /* Convert Unix timestamp to Astronomy Engine time */
   astro_time_t time = unix_to_astro_time(unix_timestamp);
 
@@ -156,6 +499,7 @@ celestial_calculate(int64_t unix_timestamp, observer_location_t observer)
 
   /* Calculate Moon position */
   result.moon = calculate_body_position(BODY_MOON, &time, observer);
+#endif
 
   return result;
 }
@@ -163,7 +507,10 @@ celestial_calculate(int64_t unix_timestamp, observer_location_t observer)
 void
 celestial_cleanup(void)
 {
-  /* No cleanup required for Astronomy Engine library */
+  free(g_ephemeris.blob);
+  g_ephemeris.blob   = NULL;
+  g_ephemeris.header = NULL;
+
   LOG_INFO("Celestial position system cleaned up");
 }
 
@@ -171,15 +518,6 @@ celestial_cleanup(void)
  * COORDINATE TRANSFORMATION HELPERS
  * ════════════════════════════════════════════════════════════ */
 
-/**
- * @def DEG_TO_RAD
- * @brief Convert degrees to radians
- */
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
-#define DEG_TO_RAD(deg) ((deg) * M_PI / 180.0)
-
 /**
  * @brief 3D vector structure
  */
@@ -335,3 +673,293 @@ celestial_to_navball_coords(double azimuth,
 
   return is_front;
 }
+
+/* ════════════════════════════════════════════════════════════
+ * EPHEMERIS CACHE
+ * ════════════════════════════════════════════════════════════ */
+
+/**
+ * @def METERS_PER_DEGREE
+ * @brief Approximate length of one degree of latitude on Earth's surface
+ */
+#define METERS_PER_DEGREE 111320.0
+
+/**
+ * @def CELESTIAL_CACHE_WARN_ARCMIN
+ * @brief Interpolation error (arcminutes) above which dev builds warn
+ */
+#define CELESTIAL_CACHE_WARN_ARCMIN 1.0
+
+/**
+ * @brief Ephemeris cache state (opaque to callers)
+ *
+ * Holds direct Astronomy Engine results at the two ends of the current
+ * time segment [t0, t1]. Segments are aligned to multiples of the interval
+ * so results do not depend on when the cache was first queried.
+ */
+struct celestial_cache
+{
+  int64_t interval_s;          /**< Segment length (seconds) */
+  double observer_threshold_m; /**< Observer move that forces a refresh */
+
+  bool valid;                    /**< Samples below are usable */
+  int64_t t0;                    /**< Segment start (Unix seconds) */
+  int64_t t1;                    /**< Segment end (t0 + interval_s) */
+  observer_location_t observer;  /**< Observer used for both samples */
+  celestial_positions_t sample0; /**< Direct positions at t0 */
+  celestial_positions_t sample1; /**< Direct positions at t1 */
+
+  uint32_t refreshes;      /**< Direct calculations performed */
+  double max_error_arcmin; /**< Worst mid-segment error seen (dev builds) */
+};
+
+/**
+ * @brief Convert a 3D unit vector back to horizontal coordinates
+ *
+ * Inverse of horizontal_to_vector(). The input need not be normalized.
+ *
+ * @param v Vector in the horizontal frame (x=East, y=Up, z=North)
+ * @param azimuth Output azimuth in degrees [0, 360)
+ * @param altitude Output altitude in degrees [-90, 90]
+ */
+static void
+vector_to_horizontal(vec3_t v, double *azimuth, double *altitude)
+{
+  double horizontal = sqrt(v.x * v.x + v.z * v.z);
+
+  double az = RAD_TO_DEG(atan2(v.x, v.z));
+  if (az < 0.0)
+    az += 360.0;
+
+  *azimuth  = az;
+  *altitude = RAD_TO_DEG(atan2(v.y, horizontal));
+}
+
+/**
+ * @brief Interpolate a body position between two samples
+ *
+ * Interpolates the direction vectors rather than azimuth/altitude, so the
+ * result stays correct across the 0°/360° azimuth seam and near the zenith,
+ * where azimuth changes quickly.
+ *
+ * @param p0 Position at segment start
+ * @param p1 Position at segment end
+ * @param frac Fraction of the segment elapsed [0, 1]
+ * @return Interpolated position (invalid if either sample is invalid)
+ */
+static celestial_position_t
+interpolate_position(celestial_position_t p0,
+                     celestial_position_t p1,
+                     double frac)
+{
+  celestial_position_t result = { .valid = false };
+
+  if (!p0.valid || !p1.valid)
+    return result;
+
+  vec3_t v0 = horizontal_to_vector(p0.azimuth, p0.altitude);
+  vec3_t v1 = horizontal_to_vector(p1.azimuth, p1.altitude);
+
+  vec3_t v;
+  v.x = v0.x + (v1.x - v0.x) * frac;
+  v.y = v0.y + (v1.y - v0.y) * frac;
+  v.z = v0.z + (v1.z - v0.z) * frac;
+
+  vector_to_horizontal(v, &result.azimuth, &result.altitude);
+  result.valid = true;
+
+  return result;
+}
+
+/**
+ * @brief Angular separation between two positions in arcminutes
+ */
+static double
+separation_arcmin(celestial_position_t a, celestial_position_t b)
+{
+  vec3_t va = horizontal_to_vector(a.azimuth, a.altitude);
+  vec3_t vb = horizontal_to_vector(b.azimuth, b.altitude);
+
+  double dot = va.x * vb.x + va.y * vb.y + va.z * vb.z;
+  double cx  = va.y * vb.z - va.z * vb.y;
+  double cy  = va.z * vb.x - va.x * vb.z;
+  double cz  = va.x * vb.y - va.y * vb.x;
+
+  return RAD_TO_DEG(atan2(sqrt(cx * cx + cy * cy + cz * cz), dot)) * 60.0;
+}
+
+/**
+ * @brief Approximate distance between two observer locations in meters
+ *
+ * Equirectangular approximation; accurate enough for a refresh threshold
+ * of tens to thousands of meters.
+ */
+static double
+observer_distance_m(observer_location_t a, observer_location_t b)
+{
+  double dlon = b.longitude - a.longitude;
+  if (dlon > 180.0)
+    dlon -= 360.0;
+  else if (dlon < -180.0)
+    dlon += 360.0;
+
+  double mean_lat = DEG_TO_RAD(0.5 * (a.latitude + b.latitude));
+  double dx       = dlon * METERS_PER_DEGREE * cos(mean_lat);
+  double dy       = (b.latitude - a.latitude) * METERS_PER_DEGREE;
+  double dz       = b.altitude - a.altitude;
+
+  return sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+#ifndef NDEBUG
+/**
+ * @brief Check interpolation against a direct calculation (dev builds)
+ *
+ * Called once per refresh: evaluates the new segment at its midpoint, where
+ * linear interpolation error peaks, and records the worst error seen. The
+ * check's own calculation is not counted in refreshes, so the stats match
+ * production builds.
+ */
+static void
+cache_verify_segment(celestial_cache_t *cache)
+{
+  int64_t mid = cache->t0 + cache->interval_s / 2;
+  double frac = (double)(mid - cache->t0) / (double)cache->interval_s;
+
+  celestial_positions_t direct = celestial_calculate(mid, cache->observer);
+
+  celestial_position_t sun
+    = interpolate_position(cache->sample0.sun, cache->sample1.sun, frac);
+  celestial_position_t moon
+    = interpolate_position(cache->sample0.moon, cache->sample1.moon, frac);
+
+  double error = 0.0;
+  if (sun.valid && direct.sun.valid)
+    error = separation_arcmin(sun, direct.sun);
+  if (moon.valid && direct.moon.valid)
+    error = fmax(error, separation_arcmin(moon, direct.moon));
+
+  if (error > cache->max_error_arcmin)
+    cache->max_error_arcmin = error;
+
+  if (error > CELESTIAL_CACHE_WARN_ARCMIN)
+    {
+      LOG_WARN("Celestial cache interpolation error %.2f' exceeds %.1f' "
+               "(interval %llds)",
+               error, CELESTIAL_CACHE_WARN_ARCMIN,
+               (long long)cache->interval_s);
+    }
+}
+#endif
+
+/**
+ * @brief Compute fresh samples for the segment containing timestamp
+ *
+ * Slides forward by one segment when possible (reusing the old end sample
+ * as the new start), otherwise computes both ends.
+ */
+static void
+cache_refresh(celestial_cache_t *cache,
+              int64_t unix_timestamp,
+              observer_location_t observer)
+{
+  // Align segment start to a multiple of the interval (floor division)
+  int64_t t0 = unix_timestamp - unix_timestamp % cache->interval_s;
+  if (unix_timestamp % cache->interval_s < 0)
+    t0 -= cache->interval_s;
+
+  if (cache->valid && t0 == cache->t1)
+    {
+      cache->sample0 = cache->sample1;
+    }
+  else
+    {
+      cache->sample0 = celestial_calculate(t0, observer);
+      cache->refreshes++;
+    }
+
+  cache->t0       = t0;
+  cache->t1       = t0 + cache->interval_s;
+  cache->observer = observer;
+  cache->sample1  = celestial_calculate(cache->t1, observer);
+  cache->refreshes++;
+  cache->valid = true;
+
+#ifndef NDEBUG
+  cache_verify_segment(cache);
+#endif
+}
+
+celestial_cache_t *
+celestial_cache_create(int interval_s, double observer_threshold_m)
+{
+  if (interval_s < 1)
+    return NULL;
+
+  celestial_cache_t *cache
+    = (celestial_cache_t *)calloc(1, sizeof(celestial_cache_t));
+  if (!cache)
+    return NULL;
+
+  cache->interval_s           = interval_s;
+  cache->observer_threshold_m = observer_threshold_m;
+
+  LOG_INFO("Celestial cache: %ds interval, %.0fm observer threshold",
+           interval_s, observer_threshold_m);
+
+  return cache;
+}
+
+celestial_positions_t
+celestial_cache_get(celestial_cache_t *cache,
+                    int64_t unix_timestamp,
+                    observer_location_t observer)
+{
+  if (!cache)
+    return celestial_calculate(unix_timestamp, observer);
+
+  bool stale = !cache->valid || unix_timestamp < cache->t0
+               || unix_timestamp > cache->t1
+               || observer_distance_m(cache->observer, observer)
+                    > cache->observer_threshold_m;
+
+  if (stale)
+    cache_refresh(cache, unix_timestamp, observer);
+
+  double frac = (double)(unix_timestamp - cache->t0)
+                / (double)(cache->t1 - cache->t0);
+
+  celestial_positions_t result;
+  result.sun  = interpolate_position(cache->sample0.sun, cache->sample1.sun,
+                                     frac);
+  result.moon = interpolate_position(cache->sample0.moon, cache->sample1.moon,
+                                     frac);
+
+  return result;
+}
+
+void
+celestial_cache_get_stats(const celestial_cache_t *cache,
+                          uint32_t *refreshes,
+                          double *max_error_arcmin)
+{
+  if (refreshes)
+    *refreshes = cache ? cache->refreshes : 0;
+  if (max_error_arcmin)
+    *max_error_arcmin = cache ? cache->max_error_arcmin : 0.0;
+}
+
+void
+celestial_cache_free(celestial_cache_t *cache)
+{
+  if (!cache)
+    return;
+
+#ifndef NDEBUG
+  LOG_INFO("Celestial cache: %u direct calculations, max interpolation "
+           "error %.3f'",
+           cache->refreshes, cache->max_error_arcmin);
+#endif
+
+  free(cache);
+}
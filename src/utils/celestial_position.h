@@ -18,9 +18,16 @@
  * - NOVAS C 3.1 algorithms
  * - Accuracy: ±1 arcminute
  *
+ * When a precomputed Chebyshev table (resources/ephemeris.bin, generated by
+ * tools/ephem_gen.c) covers the requested time, it is evaluated instead of
+ * the Astronomy Engine; only parallax, Earth rotation and refraction are
+ * computed at runtime. Table results agree with the engine to well under
+ * 1 arcminute.
+ *
  * USAGE:
  * 1. Call celestial_init() once during OSD initialization
- * 2. Call celestial_calculate() each frame to update sun/moon positions
+ * 2. Call celestial_calculate() (or celestial_cache_get() with a cache from
+ *    celestial_cache_create()) each frame to update sun/moon positions
  * 3. Call celestial_cleanup() during OSD shutdown
  *
  * @see https://github.com/cosinekitty/astronomy
@@ -70,10 +77,11 @@ typedef struct
 /**
  * @brief Initialize celestial calculation system
  *
- * Performs one-time initialization for the Astronomy Engine library.
- * Must be called before any other celestial_* functions.
+ * Loads the precomputed ephemeris table from resources/ or build/resources/
+ * if present. Must be called before any other celestial_* functions.
  *
- * @return True on success, false on failure
+ * @return True on success; false only in table-only builds
+ *         (CELESTIAL_TABLE_ONLY) when no table could be loaded
  */
 bool celestial_init(void);
 
@@ -104,10 +112,80 @@ bool celestial_init(void);
 celestial_positions_t celestial_calculate(int64_t unix_timestamp,
                                           observer_location_t observer);
 
+/**
+ * @brief Ephemeris cache (opaque)
+ *
+ * Amortizes celestial_calculate() across frames: positions are computed
+ * directly only at the ends of fixed time segments and interpolated in
+ * between. See celestial_cache_get().
+ */
+typedef struct celestial_cache celestial_cache_t;
+
+/**
+ * @brief Create an ephemeris cache
+ *
+ * @param interval_s Segment length in seconds (must be >= 1)
+ * @param observer_threshold_m Observer movement in meters that forces a
+ *        recomputation
+ * @return New cache, or NULL on invalid interval or allocation failure
+ */
+celestial_cache_t *celestial_cache_create(int interval_s,
+                                          double observer_threshold_m);
+
+/**
+ * @brief Get Sun and Moon positions through the ephemeris cache
+ *
+ * Drop-in replacement for celestial_calculate(). The Astronomy Engine is
+ * evaluated at segment boundaries aligned to multiples of the interval
+ * (two bodies per boundary); in between, direction vectors are linearly
+ * interpolated. The segment is recomputed when the timestamp leaves it or
+ * the observer moves further than the threshold.
+ *
+ * ACCURACY:
+ * - With the default 60 s interval the interpolation error stays below
+ *   1 arcminute, about 0.6 at worst: near the horizon, where refraction is
+ *   strongly nonlinear, at low latitudes, where bodies rise steeply.
+ *   300 s intervals can exceed 1 arcminute (test/celestial_cache_test.c)
+ * - Dev builds check every new segment against a direct calculation at its
+ *   midpoint and warn if the error exceeds 1 arcminute
+ *
+ * PERFORMANCE:
+ * - Cached frames cost a few trig calls; one (sliding) or two direct
+ *   calculations per interval
+ *
+ * @param cache Ephemeris cache (NULL falls back to celestial_calculate())
+ * @param unix_timestamp Seconds since 1970-01-01 00:00:00 UTC
+ * @param observer Observer's location on Earth
+ * @return Positions of sun and moon (azimuth, altitude)
+ */
+celestial_positions_t celestial_cache_get(celestial_cache_t *cache,
+                                          int64_t unix_timestamp,
+                                          observer_location_t observer);
+
+/**
+ * @brief Get ephemeris cache statistics
+ *
+ * @param cache Ephemeris cache (NULL reports zeros)
+ * @param refreshes Output: direct Astronomy Engine calculations performed
+ *        (may be NULL)
+ * @param max_error_arcmin Output: worst interpolation error measured by the
+ *        dev-build self-check, 0 in production (may be NULL)
+ */
+void celestial_cache_get_stats(const celestial_cache_t *cache,
+                               uint32_t *refreshes,
+                               double *max_error_arcmin);
+
+/**
+ * @brief Free an ephemeris cache
+ *
+ * Safe to call with NULL.
+ */
+void celestial_cache_free(celestial_cache_t *cache);
+
 /**
  * @brief Cleanup celestial calculation system
  *
- * Frees any resources allocated by celestial_init().
+ * Frees the ephemeris table loaded by celestial_init().
  * Safe to call even if celestial_init() was never called.
  */
 void celestial_cleanup(void);
@@ -0,0 +1,19 @@
+// Monotonic Clock
+// Microsecond timestamps for frame timing, payload ages and widget costs
+
+#ifndef UTILS_CLOCK_H
+#define UTILS_CLOCK_H
+
+#include <stdint.h>
+#include <time.h>
+
+// Microseconds from the monotonic clock
+static inline uint64_t
+monotonic_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+#endif // UTILS_CLOCK_H
@@ -0,0 +1,71 @@
+// Precomputed Sun/Moon Ephemeris Table Format
+// Chebyshev tables produced at build time by tools/ephem_gen.c
+//
+// The full Astronomy Engine (VSOP87 + lunar theory) is large and costly to
+// evaluate. For the navball only three smooth functions of time are needed,
+// so the generator fits them with piecewise Chebyshev polynomials over a
+// fixed date span and the runtime evaluates a handful of coefficients:
+//
+//   Channel 0  Sun   geocentric apparent position, equator of date (AU)
+//   Channel 1  Moon  geocentric apparent position, equator of date (AU)
+//   Channel 2  GAST - ERA (degrees): precession + equation of the equinoxes
+//
+// All channels are indexed by UT days since J2000 (2000-01-01 12:00 UT), so
+// ΔT is absorbed by the fit. Topocentric parallax, Earth rotation and
+// refraction are applied at runtime (celestial_position.c).
+//
+// FILE LAYOUT (little-endian, fields naturally aligned):
+//   Offset  Size  Field
+//   0       4     magic        "NBEP"
+//   4       2     version      EPHEMERIS_TABLE_VERSION
+//   6       2     header_size  Bytes before coefficient data (96)
+//   8       8     start_ut     First covered instant (UT days since J2000)
+//   16      4     span_days    Covered span length in days
+//   20      4     reserved     0
+//   24      72    channels[3]  ephemeris_channel_t, see below
+//   96      ...   coefficients float32
+//
+// Each channel stores segment_count segments of segment_days; a segment
+// holds `components` runs of `coeffs` Chebyshev coefficients each, starting
+// at byte `offset` from the start of the file.
+
+#ifndef UTILS_EPHEMERIS_TABLE_H
+#define UTILS_EPHEMERIS_TABLE_H
+
+#include <stdint.h>
+
+#define EPHEMERIS_TABLE_MAGIC "NBEP"
+#define EPHEMERIS_TABLE_VERSION 1
+#define EPHEMERIS_TABLE_HEADER_SIZE 96
+#define EPHEMERIS_TABLE_FILENAME "ephemeris.bin"
+
+#define EPHEMERIS_CHANNEL_SUN 0
+#define EPHEMERIS_CHANNEL_MOON 1
+#define EPHEMERIS_CHANNEL_SIDEREAL 2
+#define EPHEMERIS_CHANNEL_COUNT 3
+
+// Upper bounds (guard evaluation against corrupt headers)
+#define EPHEMERIS_MAX_COMPONENTS 3
+#define EPHEMERIS_MAX_COEFFS 32
+
+typedef struct
+{
+  uint32_t components;    // Values per instant (3 for vectors, 1 for angle)
+  uint32_t coeffs;        // Chebyshev coefficients per component
+  double segment_days;    // Segment length
+  uint32_t segment_count; // Segments covering span_days
+  uint32_t offset;        // Byte offset of the first coefficient
+} ephemeris_channel_t;
+
+typedef struct
+{
+  char magic[4];
+  uint16_t version;
+  uint16_t header_size;
+  double start_ut;
+  uint32_t span_days;
+  uint32_t reserved;
+  ephemeris_channel_t channels[EPHEMERIS_CHANNEL_COUNT];
+} ephemeris_table_header_t;
+
+#endif // UTILS_EPHEMERIS_TABLE_H
@@ -0,0 +1,74 @@
+#include "grow_buffer.h"
+
+#include <stdlib.h>
+
+void
+grow_buffer_init(grow_buffer_t *buf,
+                 uint8_t *inline_data,
+                 size_t inline_capacity,
+                 size_t limit)
+{
+  buf->data            = inline_data;
+  buf->capacity        = inline_capacity;
+  buf->limit           = limit;
+  buf->inline_data     = inline_data;
+  buf->inline_capacity = inline_capacity;
+  buf->heap_data       = NULL;
+  buf->heap_capacity   = 0;
+}
+
+bool
+grow_buffer_reserve(grow_buffer_t *buf, size_t size)
+{
+  if (size > buf->limit)
+    {
+      return false;
+    }
+
+  // Small request: inline block
+  if (size <= buf->inline_capacity)
+    {
+      buf->data     = buf->inline_data;
+      buf->capacity = buf->inline_capacity;
+      return true;
+    }
+
+  if (size > buf->heap_capacity)
+    {
+      // Next power of two, clamped to the limit
+      size_t capacity = buf->inline_capacity * 2;
+      while (capacity < size)
+        {
+          capacity *= 2;
+        }
+      if (capacity > buf->limit)
+        {
+          capacity = buf->limit;
+        }
+
+      // Old contents are not needed, so free + malloc rather than realloc
+      free(buf->heap_data);
+      buf->heap_data     = (uint8_t *)malloc(capacity);
+      buf->heap_capacity = buf->heap_data ? capacity : 0;
+      if (!buf->heap_data)
+        {
+          buf->data     = buf->inline_data;
+          buf->capacity = buf->inline_capacity;
+          return false;
+        }
+    }
+
+  buf->data     = buf->heap_data;
+  buf->capacity = buf->heap_capacity;
+  return true;
+}
+
+void
+grow_buffer_free(grow_buffer_t *buf)
+{
+  free(buf->heap_data);
+  buf->heap_data     = NULL;
+  buf->heap_capacity = 0;
+  buf->data          = buf->inline_data;
+  buf->capacity      = buf->inline_capacity;
+}
@@ -0,0 +1,48 @@
+// Growable Byte Buffer
+// Scratch storage for variable-size input (state updates, SAM masks)
+//
+// A buffer starts on a caller-provided inline block, so the common small
+// case needs no allocation. Larger requests move it to a heap block that
+// grows in powers of two up to a hard limit and is kept for reuse; later
+// small requests go back to the inline block.
+
+#ifndef UTILS_GROW_BUFFER_H
+#define UTILS_GROW_BUFFER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct
+{
+  uint8_t *data;   // Current storage (inline or heap block)
+  size_t capacity; // Bytes available at data
+  size_t limit;    // Largest capacity that may be reserved
+
+  uint8_t *inline_data;
+  size_t inline_capacity;
+  uint8_t *heap_data;
+  size_t heap_capacity;
+} grow_buffer_t;
+
+// Set up a buffer over an inline block
+//
+// Usage:
+//   static uint8_t block[4096];
+//   grow_buffer_init(&buf, block, sizeof(block), 1 << 20);
+void grow_buffer_init(grow_buffer_t *buf,
+                      uint8_t *inline_data,
+                      size_t inline_capacity,
+                      size_t limit);
+
+// Make at least size bytes available at buf->data
+//
+// Contents are NOT preserved: buf->data may move to another block.
+// Returns false if size exceeds the limit or the heap block cannot be
+// grown; buf->data/capacity still describe valid storage afterwards.
+bool grow_buffer_reserve(grow_buffer_t *buf, size_t size);
+
+// Free the heap block and go back to the inline block
+void grow_buffer_free(grow_buffer_t *buf);
+
+#endif // UTILS_GROW_BUFFER_H
@@ -0,0 +1,27 @@
+// Change-Detection Hashing
+// FNV-1a over raw bytes, for telling whether decoded data changed between
+// frames (not collision resistant, never use for anything security related)
+
+#ifndef UTILS_HASH_H
+#define UTILS_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Starting value of a hash chain
+#define HASH_FNV1A_INIT UINT64_C(0xcbf29ce484222325)
+
+// FNV-1a over a byte range, chained through h
+static inline uint64_t
+hash_fnv1a(uint64_t h, const void *data, size_t size)
+{
+  const uint8_t *p = (const uint8_t *)data;
+  for (size_t i = 0; i < size; i++)
+    {
+      h ^= p[i];
+      h *= UINT64_C(0x100000001b3);
+    }
+  return h;
+}
+
+#endif // UTILS_HASH_H
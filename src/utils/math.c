@@ -63,6 +63,87 @@ inverse_lerp(double a, double b, double value)
   return (value - a) / (b - a);
 }
 
+// ════════════════════════════════════════════════════════════
+// ATTITUDE INTERPOLATION IMPLEMENTATION
+// ════════════════════════════════════════════════════════════
+
+quat_t
+quat_from_attitude(double azimuth, double elevation, double bank)
+{
+  double cy = cos(deg_to_rad(azimuth) * 0.5);
+  double sy = sin(deg_to_rad(azimuth) * 0.5);
+  double cp = cos(deg_to_rad(elevation) * 0.5);
+  double sp = sin(deg_to_rad(elevation) * 0.5);
+  double cr = cos(deg_to_rad(bank) * 0.5);
+  double sr = sin(deg_to_rad(bank) * 0.5);
+
+  quat_t q;
+  q.w = cr * cp * cy + sr * sp * sy;
+  q.x = sr * cp * cy - cr * sp * sy;
+  q.y = cr * sp * cy + sr * cp * sy;
+  q.z = cr * cp * sy - sr * sp * cy;
+  return q;
+}
+
+void
+quat_to_attitude(quat_t q, double *azimuth, double *elevation, double *bank)
+{
+  // Clamp for gimbal lock (|elevation| = 90), where asin() leaves [-1, 1]
+  double sin_pitch = clamp_double(2.0 * (q.w * q.y - q.z * q.x), -1.0, 1.0);
+
+  double yaw  = atan2(2.0 * (q.w * q.z + q.x * q.y),
+                      1.0 - 2.0 * (q.y * q.y + q.z * q.z));
+  double roll = atan2(2.0 * (q.w * q.x + q.y * q.z),
+                      1.0 - 2.0 * (q.x * q.x + q.y * q.y));
+
+  if (azimuth)
+    *azimuth = normalize_angle_360(rad_to_deg(yaw));
+  if (elevation)
+    *elevation = rad_to_deg(asin(sin_pitch));
+  if (bank)
+    *bank = normalize_angle_180(rad_to_deg(roll));
+}
+
+quat_t
+quat_slerp(quat_t a, quat_t b, double t)
+{
+  double dot = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+
+  // q and -q are the same rotation: take the shorter arc
+  if (dot < 0.0)
+    {
+      b   = (quat_t){ -b.w, -b.x, -b.y, -b.z };
+      dot = -dot;
+    }
+
+  double wa, wb;
+  if (dot > 0.9995)
+    {
+      // Nearly parallel: linear blend (renormalized below) is exact enough
+      wa = 1.0 - t;
+      wb = t;
+    }
+  else
+    {
+      double theta     = acos(dot);
+      double sin_theta = sin(theta);
+      wa = sin((1.0 - t) * theta) / sin_theta;
+      wb = sin(t * theta) / sin_theta;
+    }
+
+  quat_t q = { wa * a.w + wb * b.w, wa * a.x + wb * b.x, wa * a.y + wb * b.y,
+               wa * a.z + wb * b.z };
+  double norm = sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+  if (norm > 0.0)
+    {
+      q.w /= norm;
+      q.x /= norm;
+      q.y /= norm;
+      q.z /= norm;
+    }
+  return q;
+}
+
 // ════════════════════════════════════════════════════════════
 // FLOAT COMPARISON IMPLEMENTATION
 // ════════════════════════════════════════════════════════════
@@ -186,6 +186,38 @@ remap(
   return lerp(out_min, out_max, t);
 }
 
+// ════════════════════════════════════════════════════════════
+// ATTITUDE INTERPOLATION
+// ════════════════════════════════════════════════════════════
+
+// Unit quaternion (double precision, unlike cglm's float versor)
+typedef struct
+{
+  double w, x, y, z;
+} quat_t;
+
+// Quaternion from heading angles in degrees
+// Intrinsic Z-Y-X order: azimuth (yaw), then elevation (pitch), then bank
+// (roll).
+quat_t quat_from_attitude(double azimuth, double elevation, double bank);
+
+// Heading angles in degrees from a unit quaternion (inverse of the above)
+// azimuth is in [0, 360), elevation in [-90, 90], bank in [-180, 180)
+void quat_to_attitude(quat_t q,
+                      double *azimuth,
+                      double *elevation,
+                      double *bank);
+
+// Spherical interpolation along the shorter arc
+//
+// Parameters:
+//   a, b: Unit quaternions
+//   t:    Interpolation factor (0.0 = a, 1.0 = b)
+//
+// Note: t is not clamped - values above 1 continue the rotation from a to
+// b at the same angular rate (extrapolation)
+quat_t quat_slerp(quat_t a, quat_t b, double t);
+
 // ════════════════════════════════════════════════════════════
 // FLOAT COMPARISON
 // ════════════════════════════════════════════════════════════
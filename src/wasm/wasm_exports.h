@@ -37,23 +37,390 @@
 // Returns: 0 on success, non-zero on error
 WASM_EXPORT int wasm_osd_init(void);
 
-// Update state from host
+// Get the state input buffer
+// Hosts write the encoded JonGUIState here, then call
+// wasm_osd_commit_state() - no copy inside the module. Capacities above
+// 16 KB move the buffer to the heap; an address stays valid until the
+// next wasm_osd_get_state_buffer() call.
+// Parameters:
+//   capacity: Bytes the host intends to write (at most 1 MB)
+// Returns: Offset of the buffer in WASM linear memory, or 0 if capacity
+//          cannot be provided
+WASM_EXPORT uint32_t wasm_osd_get_state_buffer(uint32_t capacity);
+
+// Decode the state written into the state input buffer
+// Parameters:
+//   state_size: Size of encoded protobuf in bytes
+// Returns: 0 on success, non-zero on error
+WASM_EXPORT int wasm_osd_commit_state(uint32_t state_size);
+
+// Apply a sequenced full or delta state from the state input buffer
+// A delta encodes only the top-level JonGUIState fields listed in `fields`
+// (bit 1 << tag per field); each is replaced whole, the rest are kept.
+// Number updates 1, 2, 3...; a delta applies only on top of seq - 1.
+// Parameters:
+//   state_size: Size of encoded protobuf in bytes
+//   fields: Field bits carried, or 0xFFFFFFFF for a full state
+//   seq: Update sequence number
+// Returns: 0 on success, 1 if a full state must be sent first (nothing
+//          applied), -1 on error
+WASM_EXPORT int wasm_osd_commit_delta(uint32_t state_size,
+                                      uint32_t fields,
+                                      uint32_t seq);
+
+// Update state from bytes already in WASM memory (decoded in place)
 // Parameters:
 //   state_ptr: Pointer to protobuf-encoded JonGUIState in WASM memory
 //   state_size: Size of encoded protobuf in bytes
 // Returns: 0 on success, non-zero on error
 WASM_EXPORT int wasm_osd_update_state(uint32_t state_ptr, uint32_t state_size);
 
+// Update one opaque payload channel without a JonGUIState update
+// Detections, SAM tracking, CvMeta and client metadata can be pushed by
+// their producers at their own rates; each payload is decoded once and
+// kept until the next push on its channel (per-frame payloads expire
+// after 1 s without one). Copies embedded in JonGUIState are ignored for
+// channels fed this way.
+// Parameters:
+//   uuid_ptr: Pointer to the 16-byte binary payload type UUID
+//   data_ptr: Pointer to the encoded payload message
+//   size: Size of the payload in bytes
+// Returns: 0 on success, -1 if the type is not handled by this variant
+WASM_EXPORT int wasm_osd_update_payload(uint32_t uuid_ptr,
+                                        uint32_t data_ptr,
+                                        uint32_t size);
+
+// Latest-wins state mailbox in WASM linear memory
+// Lets a producer (host thread, worker) publish states without calling
+// into the module; wasm_osd_render() and wasm_osd_frame() decode only the
+// newest complete one and skip states replaced in between. Three slots
+// rotate between producer, mailbox and consumer so no slot is ever
+// written while it is read:
+//
+//   producer (per state):
+//     slot = mailbox->producer_slot
+//     write the state at slot data, set slot->size and slot->seq (1, 2...)
+//     prev = atomic_exchange(&mailbox->latest, slot | MAILBOX_FRESH)
+//     mailbox->producer_slot = prev & MAILBOX_INDEX_MASK
+//
+// The exchange must be atomic (Atomics.exchange in JS) when the producer
+// runs concurrently with the module, which also requires shared memory;
+// a host that writes between calls may use plain stores.
+// Layout is fixed (little-endian 32-bit words).
+#define WASM_OSD_MAILBOX_MAGIC 0x584d534fu // "OSMX"
+#define WASM_OSD_MAILBOX_SLOTS 3u
+#define WASM_OSD_MAILBOX_FRESH 0x80000000u // Set in latest by the producer
+#define WASM_OSD_MAILBOX_INDEX_MASK 0xffu
+
+typedef struct
+{
+  uint32_t magic;         // WASM_OSD_MAILBOX_MAGIC
+  uint32_t slot_count;    // WASM_OSD_MAILBOX_SLOTS
+  uint32_t slot_capacity; // State bytes per slot
+  uint32_t slot_stride;   // Bytes from one slot header to the next
+  uint32_t slots;         // Offset of slot 0 in WASM linear memory
+  uint32_t latest;        // Shared: published slot index (| FRESH if new)
+  uint32_t producer_slot; // Producer-owned: slot to write next
+  uint32_t consumer_slot; // Module-owned: slot last decoded
+  uint32_t consumed_seq;  // Sequence number of the last state decoded
+  uint32_t consumed;      // States taken from the mailbox
+  uint32_t skipped;       // States replaced before they were taken
+  uint32_t rejected;      // Taken states that failed to decode
+} wasm_osd_mailbox_t;
+
+_Static_assert(sizeof(wasm_osd_mailbox_t) == 48,
+               "wasm_osd_mailbox_t layout is part of the host API");
+
+// Slot header; slot_capacity bytes of encoded JonGUIState follow it
+typedef struct
+{
+  uint32_t seq;  // Producer sequence number, incremented per state
+  uint32_t size; // Encoded state size in bytes
+} wasm_osd_mailbox_slot_t;
+
+// Create (or get) the state mailbox
+// Re-creating it with a larger capacity discards pending states; the
+// producer must be idle then. The address stays valid until then.
+// Parameters:
+//   slot_capacity: Largest state the producer will write (at most 1 MB),
+//                  or 0 to remove the mailbox
+// Returns: Offset of the wasm_osd_mailbox_t in WASM linear memory, or 0
+//          if removed or the slots cannot be allocated
+WASM_EXPORT uint32_t wasm_osd_get_state_mailbox(uint32_t slot_capacity);
+
 // Render OSD to framebuffer
-// Call after wasm_osd_update_state() to render current state.
+// Call after wasm_osd_commit_state() to render current state. Takes the
+// newest state from the mailbox first, if one was published. Frames that
+// would come out identical to the one in the framebuffer (same drawn
+// state fields, payloads, config, quality level and widget layers) are
+// not rendered, so the host can skip its texture upload on 0.
 // Returns: 1 if rendered, 0 if skipped (no changes)
 WASM_EXPORT int wasm_osd_render(void);
 
+// Render OSD as of a display time
+// Attitude (navball, compass) and rotary speeds are interpolated between
+// the recent states around the given time, or extrapolated up to 50 ms
+// past the newest one; other fields come from the state in effect then.
+// Call once per display refresh for smooth motion at 60-120 Hz.
+// Parameters:
+//   display_time_us: When the frame will be shown, on the clock of
+//                    JonGUIState.system_monotonic_time_us (0 = newest)
+// Returns: 1 if rendered, 0 if skipped (no changes)
+WASM_EXPORT int wasm_osd_render_at(uint64_t display_time_us);
+
+// Render OSD for a video frame
+// Uses the recent state carrying this frame PTS (frame_pts_day_ns, or
+// frame_pts_heat_ns in thermal variants), interpolating between the two
+// around it, so overlays composited ahead of or behind ingestion stay
+// aligned with the video. Covers the last 16 states (~0.5 s at 30 Hz).
+// Parameters:
+//   pts_ns: Frame PTS in nanoseconds
+// Returns: 1 if rendered, 0 if skipped (no changes)
+WASM_EXPORT int wasm_osd_render_for_pts(uint64_t pts_ns);
+
+// wasm_osd_render_step() result while the frame is unfinished
+#define WASM_OSD_STEP_PENDING 2
+
+// Render in slices of bounded time
+// Draws widgets of the current frame for about budget_us, so no single
+// call blocks the host for a whole heavy frame. Call again until the
+// result is not WASM_OSD_STEP_PENDING, then publish the framebuffer: it
+// is then identical to a wasm_osd_render() frame. The state is fixed when
+// a frame starts (the mailbox is read then); updates during a frame do
+// not restart it, but schedule the next one. Any other render call
+// replaces the frame in progress.
+// Parameters:
+//   budget_us: Time to spend in this call (0 = finish the frame); a call
+//              may overrun by the cost of one widget
+// Returns: WASM_OSD_STEP_PENDING while unfinished, then 1 if rendered or
+//          0 if nothing changed (as wasm_osd_render())
+WASM_EXPORT int wasm_osd_render_step(uint32_t budget_us);
+
 // Get framebuffer pointer
 // Returns: Offset to RGBA framebuffer in WASM linear memory
 // Size: width * height * 4 bytes (set during wasm_osd_init)
 WASM_EXPORT uint32_t wasm_osd_get_framebuffer(void);
 
+// Sparse transfer form of the framebuffer
+// A self-contained block: this header, a tile occupancy bitmap and the
+// occupied tiles packed back to back. Offsets are from the start of the
+// header, so the first `size` bytes can be copied (to a worker, another
+// process) and decoded elsewhere. Layout is fixed (twelve little-endian
+// 32-bit words, then the bitmap and tiles):
+//
+//   occupancy: tiles_y * tiles_x bits, row-major; tile i is bit (i % 32)
+//              of 32-bit word i / 32. Set if any pixel is not 0x00000000.
+//   tiles:     tile_count tiles in occupancy order, tile_bytes each:
+//              tile_size rows of tile_size RGBA pixels from
+//              (tx * tile_size, ty * tile_size); pixels past the right or
+//              bottom edge of the framebuffer are 0.
+//
+// Tiles missing from the bitmap are fully transparent, so a host uploads
+// only the occupied ones (texSubImage2D per tile, or per run of adjacent
+// tiles) onto a texture cleared once.
+#define WASM_OSD_SPARSE_MAGIC 0x5053534fu // "OSSP"
+#define WASM_OSD_SPARSE_TILE_DEFAULT 32u
+
+typedef struct
+{
+  uint32_t magic;      // WASM_OSD_SPARSE_MAGIC
+  uint32_t width;      // Framebuffer width in pixels
+  uint32_t height;     // Framebuffer height in pixels
+  uint32_t tile_size;  // Tile edge in pixels
+  uint32_t tiles_x;    // Tile columns: ceil(width / tile_size)
+  uint32_t tiles_y;    // Tile rows: ceil(height / tile_size)
+  uint32_t tile_count; // Occupied tiles packed at `tiles`
+  uint32_t tile_bytes; // tile_size * tile_size * 4
+  uint32_t occupancy;  // Byte offset of the occupancy bitmap
+  uint32_t tiles;      // Byte offset of the first packed tile
+  uint32_t size;       // Bytes of the whole block, header included
+  uint32_t generation; // Changes whenever the framebuffer is re-rendered
+} wasm_osd_sparse_frame_t;
+
+_Static_assert(sizeof(wasm_osd_sparse_frame_t) == 48,
+               "wasm_osd_sparse_frame_t layout is part of the host API");
+
+// Encode the framebuffer in sparse transfer form
+// Only the content bounds of the last render are scanned, and calling
+// again without a re-render (same generation and tile size) returns the
+// block already built. Call after the frame is finished (not between
+// wasm_osd_render_step() calls).
+// Parameters:
+//   tile_size: Tile edge, a power of two from 8 to 256
+//              (0 = WASM_OSD_SPARSE_TILE_DEFAULT)
+// Returns: Offset of a wasm_osd_sparse_frame_t in WASM linear memory,
+//          valid until the next call, or 0 if tile_size is invalid or
+//          the block cannot be allocated
+WASM_EXPORT uint32_t wasm_osd_get_sparse_frame(uint32_t tile_size);
+
+// wasm_osd_blend_yuv() frame formats
+#define WASM_OSD_YUV_I420 1u      // Y plane, U plane, V plane
+#define WASM_OSD_YUV_NV12 2u      // Y plane, interleaved UV plane
+#define WASM_OSD_YUV_BT601 0x100u // Flag: BT.601 colors (default BT.709)
+
+// Get the video frame buffer
+// For hosts whose video frames are not already in WASM linear memory:
+// decode or copy a frame here, blend it with wasm_osd_blend_yuv() and
+// read it back. Contents are not kept when the buffer grows; an address
+// stays valid until a call with a larger capacity.
+// Parameters:
+//   capacity: Frame bytes the host intends to write (at most 32 MB)
+// Returns: Offset of the buffer in WASM linear memory, or 0 if capacity
+//          cannot be provided
+WASM_EXPORT uint32_t wasm_osd_get_video_buffer(uint32_t capacity);
+
+// Burn the overlay into a 4:2:0 video frame in place
+// Blends the last rendered frame into a video frame of the framebuffer
+// size in WASM linear memory (the video buffer, or memory the host
+// decodes into). The planes follow each other as in GStreamer's default
+// layout: Y (height rows of y_stride bytes), then U and V (I420) or UV
+// (NV12), each (height + 1) / 2 rows of uv_stride bytes. Only the content
+// bounds of the overlay are visited and only video samples under
+// non-transparent overlay pixels are written, so the cost follows the
+// OSD coverage instead of the frame size.
+// Parameters:
+//   format: WASM_OSD_YUV_I420 or WASM_OSD_YUV_NV12, optionally
+//           | WASM_OSD_YUV_BT601
+//   frame_ptr: Offset of the Y plane in WASM linear memory
+//   y_stride: Bytes per luma row (at least width)
+//   uv_stride: Bytes per chroma row (at least (width + 1) / 2 for I420,
+//              2 * ((width + 1) / 2) for NV12)
+// Returns: 0 on success, -1 if the format or strides are invalid, the
+//          planes do not fit in linear memory, or a wasm_osd_render_step()
+//          frame is unfinished (finish it first)
+WASM_EXPORT int wasm_osd_blend_yuv(uint32_t format,
+                                   uint32_t frame_ptr,
+                                   uint32_t y_stride,
+                                   uint32_t uv_stride);
+
+// Per-frame result of wasm_osd_frame(), written to WASM memory
+// Layout is fixed (twelve little-endian 32-bit words) for hosts that read
+// it without this header.
+typedef struct
+{
+  uint32_t framebuffer; // Offset of the RGBA framebuffer
+  uint32_t width;       // Framebuffer width in pixels
+  uint32_t height;      // Framebuffer height in pixels
+  uint32_t changed;     // 1 if the framebuffer was re-rendered
+  int32_t state_result; // State update result (0 if none was passed)
+  uint32_t dirty_x;     // Region that differs from the previous frame;
+  uint32_t dirty_y;     //   width/height 0 when nothing changed
+  uint32_t dirty_width;
+  uint32_t dirty_height;
+  uint32_t update_us;   // Time spent decoding the state
+  uint32_t render_us;   // Time spent rendering
+  uint32_t frame_count; // State updates so far
+} wasm_osd_frame_info_t;
+
+_Static_assert(sizeof(wasm_osd_frame_info_t) == 48,
+               "wasm_osd_frame_info_t layout is part of the host API");
+
+// wasm_osd_frame() flags
+#define WASM_OSD_FRAME_FORCE_RENDER 0x1u // Re-render even if nothing changed
+
+// Update state and render in one call
+// Replaces the update_state / render / get_framebuffer sequence with a
+// single host call per frame. A state published to the mailbox is applied
+// after the one passed here.
+// Parameters:
+//   state_ptr: Pointer to protobuf-encoded JonGUIState in WASM memory
+//              (for example the state input buffer)
+//   state_size: Size of encoded protobuf in bytes (0 = render only)
+//   flags: WASM_OSD_FRAME_* bits
+//   out_info_ptr: Where to write wasm_osd_frame_info_t, or 0 for the
+//                 block at wasm_osd_get_frame_info()
+// Returns: 1 if rendered, 0 if unchanged, -1 if the state was rejected
+//          (the frame is still rendered and the info written)
+WASM_EXPORT int wasm_osd_frame(uint32_t state_ptr,
+                               uint32_t state_size,
+                               uint32_t flags,
+                               uint32_t out_info_ptr);
+
+// Get the module-owned frame info block
+// Returns: Offset of a wasm_osd_frame_info_t in WASM linear memory, filled
+//          by wasm_osd_frame() when called with out_info_ptr = 0
+WASM_EXPORT uint32_t wasm_osd_get_frame_info(void);
+
+// Widgets in draw order: index into the wasm_osd_get_widget_stats() table
+#define WASM_OSD_WIDGET_CROSSHAIR 0u // Includes the speed indicators
+#define WASM_OSD_WIDGET_TIMESTAMP 1u
+#define WASM_OSD_WIDGET_NAVBALL 2u // Includes the celestial indicators
+#define WASM_OSD_WIDGET_VARIANT_INFO 3u
+#define WASM_OSD_WIDGET_SHARPNESS_HEATMAP 4u
+#define WASM_OSD_WIDGET_AUTOFOCUS_DEBUG 5u
+#define WASM_OSD_WIDGET_DETECTIONS 6u
+#define WASM_OSD_WIDGET_SAM_MASK 7u
+#define WASM_OSD_WIDGET_ROI 8u
+#define WASM_OSD_WIDGET_COUNT 9u
+
+// wasm_osd_widget_stats_t flags
+#define WASM_OSD_WIDGET_LAYERED 0x1u // Drawn into a layer reused until due
+
+// Render cost and scheduling of one widget
+// Costs are wall-clock microseconds inside the module. Layout is fixed
+// (eight little-endian 32-bit words).
+typedef struct
+{
+  uint32_t last_us;     // Cost of the last draw
+  uint32_t avg_us;      // Running average draw cost (weight 1/8)
+  uint32_t max_us;      // Most expensive draw so far
+  uint32_t draws;       // Frames the widget was drawn
+  uint32_t reuses;      // Frames that reused its last drawn layer
+  uint32_t reuse_us;    // Cost of the last reuse (layer composite)
+  uint32_t interval_us; // Minimum state time between draws (0 = none)
+  uint32_t flags;       // WASM_OSD_WIDGET_* flags
+} wasm_osd_widget_stats_t;
+
+_Static_assert(sizeof(wasm_osd_widget_stats_t) == 32,
+               "wasm_osd_widget_stats_t layout is part of the host API");
+
+// Get the per-widget render cost table
+// Widgets with a max_rate_hz in the config (or whose drawn inputs are
+// known, like the timestamp and sharpness heatmap) are drawn into a layer
+// that later frames reuse until the widget is due again; the table shows
+// what each widget costs and how often it was drawn versus reused.
+// Returns: Offset of WASM_OSD_WIDGET_COUNT wasm_osd_widget_stats_t entries
+//          in WASM linear memory, indexed by WASM_OSD_WIDGET_*
+WASM_EXPORT uint32_t wasm_osd_get_widget_stats(void);
+
+// Render quality reductions (wasm_osd_budget_stats_t.quality)
+#define WASM_OSD_QUALITY_SKIP_DEBUG 0x01u       // Debug widgets not drawn
+#define WASM_OSD_QUALITY_NAVBALL_NEAREST 0x02u  // Nav ball point-sampled
+#define WASM_OSD_QUALITY_OUTLINE_SINGLE 0x04u   // Text outlines in one pass
+#define WASM_OSD_QUALITY_SAM_CONTOUR 0x08u      // SAM mask outline only
+#define WASM_OSD_QUALITY_NAVBALL_HALF_RES 0x10u // Nav ball per 2x2 block
+
+// State of the frame-budget governor
+// Costs are wall-clock microseconds of widget drawing per render; frame
+// numbers count renders. Layout is fixed (twelve little-endian 32-bit
+// words).
+typedef struct
+{
+  uint32_t level;              // Reduction level in effect (0 = full)
+  uint32_t quality;            // WASM_OSD_QUALITY_* bits of that level
+  uint32_t budget_us;          // Configured budget (0 = governor off)
+  uint32_t avg_us;             // Rolling average frame cost
+  uint32_t last_us;            // Cost of the last frame
+  uint32_t level_changes;      // steps_down + steps_up
+  uint32_t steps_down;         // Reductions switched on
+  uint32_t steps_up;           // Reductions switched back off
+  uint32_t max_level_reached;  // Deepest level so far
+  uint32_t last_change_frame;  // Render that last changed the level
+  uint32_t last_change_avg_us; // Average cost that triggered it
+  uint32_t frames_degraded;    // Renders at a level above 0
+} wasm_osd_budget_stats_t;
+
+_Static_assert(sizeof(wasm_osd_budget_stats_t) == 48,
+               "wasm_osd_budget_stats_t layout is part of the host API");
+
+// Get the frame-budget governor state
+// With render_budget.budget_us set in the config, the module steps down
+// through quality levels while widget drawing averages over the budget
+// and back up once there is headroom; each change is also logged.
+// Returns: Offset of a wasm_osd_budget_stats_t in WASM linear memory,
+//          updated by every render
+WASM_EXPORT uint32_t wasm_osd_get_budget_stats(void);
+
 // Cleanup and free resources
 // Returns: 0 on success
 WASM_EXPORT int wasm_osd_destroy(void);
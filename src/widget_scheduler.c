@@ -0,0 +1,610 @@
+// Widget Scheduler Implementation
+// Per-widget update rates, layer reuse and render cost tracking
+
+#include "widget_scheduler.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/framebuffer.h"
+#include "osd_state.h"
+#include "proto/jon_shared_data.pb.h"
+#include "render_budget.h"
+#include "rendering/blending.h"
+#include "rendering/text.h"
+#include "utils/clock.h"
+#include "utils/hash.h"
+#include "utils/logging.h"
+#include "widgets/autofocus_debug.h"
+#include "widgets/crosshair.h"
+#include "widgets/detections.h"
+#include "widgets/navball.h"
+#include "widgets/roi.h"
+#include "widgets/sam_mask.h"
+#include "widgets/sharpness_heatmap.h"
+#include "widgets/timestamp.h"
+#include "widgets/variant_info.h"
+
+// ════════════════════════════════════════════════════════════
+// WIDGET TABLE
+// ════════════════════════════════════════════════════════════
+
+typedef bool (*widget_render_fn)(osd_context_t *ctx, osd_state_t *state);
+typedef void (*widget_update_fn)(osd_context_t *ctx, osd_state_t *state);
+typedef uint64_t (*widget_inputs_fn)(const osd_context_t *ctx,
+                                     const osd_state_t *state);
+typedef framebuffer_rect_t (*widget_extent_fn)(const osd_context_t *ctx);
+
+typedef struct
+{
+  const char *name;
+  widget_render_fn render;
+  widget_update_fn update; // Per-state bookkeeping on reused frames, or NULL
+                           //   (the widget draws data kept across frames)
+  widget_inputs_fn inputs; // Hash of everything drawn, or NULL if unknown
+  bool needs_state;        // Not drawn before the first decoded state
+  bool debug;              // Dropped under OSD_QUALITY_SKIP_DEBUG
+  size_t enabled_offset;   // Offsets of its enabled and max_rate_hz fields
+  size_t rate_offset;      //   in osd_config_t
+  widget_extent_fn extent; // Area it can draw in, or NULL (whole frame);
+                           //   limits the scan for its layer's bounds
+} widget_def_t;
+
+// Adapters for widgets taking a const state
+
+static bool
+draw_variant_info(osd_context_t *ctx, osd_state_t *state)
+{
+  return variant_info_render(ctx, state);
+}
+
+static void
+update_variant_info(osd_context_t *ctx, osd_state_t *state)
+{
+  variant_info_update(ctx, state);
+}
+
+static bool
+draw_sharpness_heatmap(osd_context_t *ctx, osd_state_t *state)
+{
+  return sharpness_heatmap_render(ctx, state);
+}
+
+static bool
+draw_detections(osd_context_t *ctx, osd_state_t *state)
+{
+  return detections_render(ctx, state);
+}
+
+static bool
+draw_sam_mask(osd_context_t *ctx, osd_state_t *state)
+{
+  return sam_mask_render(ctx, state);
+}
+
+static bool
+draw_roi(osd_context_t *ctx, osd_state_t *state)
+{
+  return roi_render(ctx, state);
+}
+
+// Timestamp shows whole seconds
+static uint64_t
+timestamp_inputs(const osd_context_t *ctx, const osd_state_t *state)
+{
+  (void)ctx;
+  return state->has_time ? (uint64_t)state->time.timestamp : UINT64_MAX;
+}
+
+// Sharpness heatmap draws only CvMeta
+static uint64_t
+sharpness_heatmap_inputs(const osd_context_t *ctx, const osd_state_t *state)
+{
+  (void)state;
+  return hash_fnv1a(HASH_FNV1A_INIT, &ctx->cv_meta, sizeof(ctx->cv_meta));
+}
+
+#define WIDGET_CONFIG(section)                                                \
+  offsetof(osd_config_t, section.enabled),                                    \
+    offsetof(osd_config_t, section.max_rate_hz)
+
+// Indexed by WASM_OSD_WIDGET_*, in draw order
+static const widget_def_t k_widgets[WASM_OSD_WIDGET_COUNT] = {
+  { "crosshair", crosshair_render, NULL, NULL, false, false,
+    WIDGET_CONFIG(crosshair), NULL },
+  { "timestamp", timestamp_render, NULL, timestamp_inputs, true, false,
+    WIDGET_CONFIG(timestamp), timestamp_extent },
+  { "navball", navball_render, NULL, NULL, true, false,
+    WIDGET_CONFIG(navball), NULL },
+  { "variant_info", draw_variant_info, update_variant_info, NULL, false, true,
+    WIDGET_CONFIG(variant_info), NULL },
+  { "sharpness_heatmap", draw_sharpness_heatmap, NULL,
+    sharpness_heatmap_inputs, false, false,
+    WIDGET_CONFIG(sharpness_heatmap), sharpness_heatmap_extent },
+  { "autofocus_debug", autofocus_debug_render, autofocus_debug_update, NULL,
+    false, true, WIDGET_CONFIG(autofocus_debug), NULL },
+  { "detections", draw_detections, NULL, NULL, false, false,
+    WIDGET_CONFIG(detections), NULL },
+  { "sam_mask", draw_sam_mask, NULL, NULL, false, false,
+    WIDGET_CONFIG(sam_mask), NULL },
+  { "roi", draw_roi, NULL, NULL, true, false, WIDGET_CONFIG(roi), NULL },
+};
+
+// Scheduler time of a frame
+static uint64_t
+frame_time_us(const osd_state_t *state)
+{
+  // Rates follow state time, so recorded video is paced like live
+  uint64_t now_us = osd_state_get_monotonic_time_us(state);
+  return now_us != 0 ? now_us : monotonic_us();
+}
+
+static bool
+widget_enabled(const osd_context_t *ctx, const widget_def_t *def)
+{
+  const uint8_t *config = (const uint8_t *)&ctx->config;
+  return *(const bool *)(config + def->enabled_offset);
+}
+
+// ════════════════════════════════════════════════════════════
+// SCHEDULER STATE
+// ════════════════════════════════════════════════════════════
+
+typedef struct
+{
+  bool layered;         // Drawn into the layer below instead of directly
+  uint64_t interval_us; // Due times are multiples of this (0 = any frame)
+
+  // Last drawn layer
+  uint32_t *pixels; // rect.width * rect.height pixels
+  size_t capacity;  // Pixels allocated at pixels
+  framebuffer_rect_t rect;
+  bool valid;           // pixels/rect hold the last draw
+  bool drawn;           // What the widget returned for it
+  bool had_state;       // Drawn with a decoded state
+  uint64_t inputs;      // widget_inputs() it was drawn from
+  uint64_t drawn_at_us; // Scheduler time of the draw
+  uint32_t serial;      // Draws so far: identifies the layer content
+} widget_slot_t;
+
+static widget_slot_t s_slots[WASM_OSD_WIDGET_COUNT];
+static wasm_osd_widget_stats_t s_stats[WASM_OSD_WIDGET_COUNT];
+
+// Frame being drawn, from widget_scheduler_begin() to _end()
+static struct
+{
+  uint64_t now_us;  // Scheduler time of the frame
+  uint64_t cost_us; // Drawing time so far, summed over steps
+  int next;         // Next widget (WASM_OSD_WIDGET_*) to draw
+  bool changed;     // Some widget has content
+} s_frame;
+
+// Transparent full-size buffer scheduled widgets draw into; zero again
+// after each capture
+static uint32_t *s_scratch  = NULL;
+static size_t s_scratch_len = 0;
+
+void
+widget_scheduler_init(const osd_context_t *ctx)
+{
+  memset(s_stats, 0, sizeof(s_stats));
+
+  for (int i = 0; i < (int)WASM_OSD_WIDGET_COUNT; i++)
+    {
+      const widget_def_t *def = &k_widgets[i];
+      widget_slot_t *slot     = &s_slots[i];
+      const uint8_t *config   = (const uint8_t *)&ctx->config;
+
+      bool enabled = widget_enabled(ctx, def);
+      float rate   = *(const float *)(config + def->rate_offset);
+
+      // Disabled widgets draw nothing, cheaply: no layer needed
+      slot->interval_us = rate > 0.0f ? (uint64_t)(1e6f / rate + 0.5f) : 0;
+      slot->layered
+        = enabled && (slot->interval_us > 0 || def->inputs != NULL);
+      slot->valid = false;
+
+      s_stats[i].interval_us = (uint32_t)slot->interval_us;
+      s_stats[i].flags       = slot->layered ? WASM_OSD_WIDGET_LAYERED : 0;
+
+      if (slot->layered && slot->interval_us > 0)
+        {
+          LOG_INFO("Widget %s: at most %.1f Hz", def->name, rate);
+        }
+    }
+}
+
+void
+widget_scheduler_free(void)
+{
+  for (int i = 0; i < (int)WASM_OSD_WIDGET_COUNT; i++)
+    {
+      free(s_slots[i].pixels);
+      memset(&s_slots[i], 0, sizeof(s_slots[i]));
+    }
+
+  free(s_scratch);
+  s_scratch     = NULL;
+  s_scratch_len = 0;
+}
+
+const wasm_osd_widget_stats_t *
+widget_scheduler_stats(void)
+{
+  return s_stats;
+}
+
+// ════════════════════════════════════════════════════════════
+// LAYERS
+// ════════════════════════════════════════════════════════════
+
+static bool
+scratch_reserve(const osd_context_t *ctx)
+{
+  size_t len = (size_t)ctx->width * ctx->height;
+  if (s_scratch && s_scratch_len == len)
+    {
+      return true;
+    }
+
+  free(s_scratch);
+  s_scratch_len = 0;
+  s_scratch     = (uint32_t *)calloc(len, sizeof(uint32_t));
+  if (!s_scratch)
+    {
+      LOG_WARN("Widget scheduler: no scratch buffer, drawing directly");
+      return false;
+    }
+  s_scratch_len = len;
+  return true;
+}
+
+static void
+layer_composite(const osd_context_t *ctx, const widget_slot_t *slot)
+{
+  framebuffer_rect_t r = slot->rect;
+
+  for (int y = 0; y < r.height; y++)
+    {
+      const uint32_t *src = &slot->pixels[(size_t)y * r.width];
+      uint32_t *dst = &ctx->framebuffer[(size_t)(r.y + y) * ctx->width + r.x];
+
+      for (int x = 0; x < r.width; x++)
+        {
+          if (src[x])
+            {
+              dst[x] = blend_premultiplied(dst[x], src[x]);
+            }
+        }
+    }
+}
+
+/**
+ * Draw a widget into its layer and composite it
+ *
+ * Falls back to drawing straight into the framebuffer (layer left
+ * invalid) when memory for the scratch buffer or layer is not available.
+ *
+ * @return What the widget's render function returned
+ */
+static bool
+layer_draw(osd_context_t *ctx,
+           const widget_def_t *def,
+           widget_slot_t *slot,
+           osd_state_t *state)
+{
+  slot->valid = false;
+  if (!scratch_reserve(ctx))
+    {
+      return def->render(ctx, state);
+    }
+
+  uint32_t *target = ctx->framebuffer;
+  ctx->framebuffer = s_scratch;
+  bool drawn       = def->render(ctx, state);
+  ctx->framebuffer = target;
+
+  framebuffer_t scratch;
+  framebuffer_rect_t rect;
+  framebuffer_init(&scratch, s_scratch, ctx->width, ctx->height);
+  if (def->extent)
+    {
+      framebuffer_content_bounds_in(&scratch, def->extent(ctx), &rect);
+    }
+  else
+    {
+      framebuffer_content_bounds(&scratch, &rect);
+    }
+
+  size_t len = (size_t)rect.width * rect.height;
+  if (len > slot->capacity)
+    {
+      uint32_t *pixels
+        = (uint32_t *)realloc(slot->pixels, len * sizeof(uint32_t));
+      if (pixels)
+        {
+          slot->pixels   = pixels;
+          slot->capacity = len;
+        }
+    }
+
+  // Move the content out of the scratch buffer, leaving it transparent
+  bool stored = len <= slot->capacity;
+  for (int y = 0; y < rect.height; y++)
+    {
+      uint32_t *row = &s_scratch[(size_t)(rect.y + y) * ctx->width + rect.x];
+      if (stored)
+        {
+          memcpy(&slot->pixels[(size_t)y * rect.width], row,
+                 (size_t)rect.width * sizeof(uint32_t));
+        }
+      else
+        {
+          // No layer memory: composite straight from the scratch buffer
+          uint32_t *dst = &target[(size_t)(rect.y + y) * ctx->width + rect.x];
+          for (int x = 0; x < rect.width; x++)
+            {
+              if (row[x])
+                {
+                  dst[x] = blend_premultiplied(dst[x], row[x]);
+                }
+            }
+        }
+      memset(row, 0, (size_t)rect.width * sizeof(uint32_t));
+    }
+
+  if (stored)
+    {
+      slot->rect  = rect;
+      slot->valid = true;
+      layer_composite(ctx, slot);
+    }
+  return drawn;
+}
+
+// ════════════════════════════════════════════════════════════
+// SCHEDULING
+// ════════════════════════════════════════════════════════════
+
+// Hash of what a layered widget draws and the OSD_QUALITY_* reductions it
+// draws with: a layer drawn at one budget level is not reused at another
+static uint64_t
+widget_inputs(const osd_context_t *ctx,
+              const widget_def_t *def,
+              const osd_state_t *state,
+              uint32_t quality)
+{
+  uint64_t h = def->inputs ? def->inputs(ctx, state) : 0;
+  return hash_fnv1a(h, &quality, sizeof(quality));
+}
+
+// Whether a layered widget with a valid layer must be drawn again
+static bool
+widget_due(const widget_def_t *def,
+           const widget_slot_t *slot,
+           bool has_state,
+           uint64_t inputs,
+           uint64_t now_us)
+{
+  if (slot->had_state != has_state)
+    {
+      return true;
+    }
+
+  // Nothing it draws changed
+  if (def->inputs && inputs == slot->inputs)
+    {
+      return false;
+    }
+
+  if (slot->interval_us == 0 || now_us < slot->drawn_at_us)
+    {
+      return true;
+    }
+  return now_us / slot->interval_us != slot->drawn_at_us / slot->interval_us;
+}
+
+static void
+record_draw(wasm_osd_widget_stats_t *stats, uint64_t cost_us)
+{
+  uint32_t cost = cost_us > UINT32_MAX ? UINT32_MAX : (uint32_t)cost_us;
+
+  if (stats->draws == 0)
+    {
+      stats->avg_us = cost;
+    }
+  else
+    {
+      int64_t diff  = (int64_t)cost - (int64_t)stats->avg_us;
+      stats->avg_us = (uint32_t)((int64_t)stats->avg_us + diff / 8);
+    }
+
+  stats->last_us = cost;
+  if (cost > stats->max_us)
+    {
+      stats->max_us = cost;
+    }
+  stats->draws++;
+}
+
+static bool
+widget_render(osd_context_t *ctx,
+              int index,
+              osd_state_t *state,
+              uint64_t now_us)
+{
+  const widget_def_t *def        = &k_widgets[index];
+  widget_slot_t *slot            = &s_slots[index];
+  wasm_osd_widget_stats_t *stats = &s_stats[index];
+
+  if (def->needs_state && !state)
+    {
+      slot->valid = false;
+      return false;
+    }
+
+  // Over the frame budget: keep the bookkeeping, skip the drawing
+  if (def->debug && (ctx->quality & OSD_QUALITY_SKIP_DEBUG))
+    {
+      if (def->update)
+        {
+          def->update(ctx, state);
+        }
+      return false;
+    }
+
+  uint64_t start = monotonic_us();
+
+  if (!slot->layered)
+    {
+      bool drawn = def->render(ctx, state);
+      record_draw(stats, monotonic_us() - start);
+      return drawn;
+    }
+
+  uint64_t inputs = widget_inputs(ctx, def, state, ctx->quality);
+  if (slot->valid && !widget_due(def, slot, state != NULL, inputs, now_us))
+    {
+      if (def->update)
+        {
+          def->update(ctx, state);
+        }
+      layer_composite(ctx, slot);
+      stats->reuse_us = (uint32_t)(monotonic_us() - start);
+      stats->reuses++;
+      return slot->drawn;
+    }
+
+  bool drawn        = layer_draw(ctx, def, slot, state);
+  slot->drawn       = drawn;
+  slot->had_state   = state != NULL;
+  slot->inputs      = inputs;
+  slot->drawn_at_us = now_us;
+  slot->serial++;
+  record_draw(stats, monotonic_us() - start);
+  return drawn;
+}
+
+bool
+widget_scheduler_signature(const osd_context_t *ctx,
+                           const osd_state_t *state,
+                           uint32_t quality,
+                           uint64_t *signature,
+                           uint32_t *fresh)
+{
+  uint64_t now_us = frame_time_us(state);
+  uint64_t h      = HASH_FNV1A_INIT;
+
+  *fresh = 0;
+
+  for (int i = 0; i < (int)WASM_OSD_WIDGET_COUNT; i++)
+    {
+      const widget_def_t *def   = &k_widgets[i];
+      const widget_slot_t *slot = &s_slots[i];
+
+      if (!widget_enabled(ctx, def)
+          || (def->debug && (quality & OSD_QUALITY_SKIP_DEBUG))
+          || (def->needs_state && !state))
+        {
+          continue;
+        }
+
+      // Drawn straight from state, payloads and config: covered by the
+      // caller's part of the signature
+      if (!slot->layered && !def->update)
+        {
+          *fresh |= 1u << i;
+          continue;
+        }
+
+      uint64_t inputs = widget_inputs(ctx, def, state, quality);
+
+      bool due = !slot->layered || !slot->valid
+                 || widget_due(def, slot, state != NULL, inputs, now_us);
+
+      // Redrawn from data kept across frames: nothing to compare
+      if (due && def->update)
+        {
+          return false;
+        }
+
+      // The layer this frame shows: the last one, or the next draw (which
+      // never matches the last signature)
+      uint32_t serial = slot->serial + (due ? 1 : 0);
+      h               = hash_fnv1a(h, &serial, sizeof(serial));
+      if (due)
+        {
+          *fresh |= 1u << i;
+        }
+    }
+
+  *signature = h;
+  return true;
+}
+
+void
+widget_scheduler_skip(osd_context_t *ctx, osd_state_t *state)
+{
+  for (int i = 0; i < (int)WASM_OSD_WIDGET_COUNT; i++)
+    {
+      const widget_def_t *def = &k_widgets[i];
+      if (def->update && !(def->needs_state && !state))
+        {
+          def->update(ctx, state);
+        }
+    }
+}
+
+void
+widget_scheduler_begin(osd_context_t *ctx, osd_state_t *state)
+{
+  uint64_t now_us = frame_time_us(state);
+
+  // Quality level chosen by the frame-budget governor
+  ctx->quality = render_budget_quality();
+  text_set_single_pass_outline(ctx->quality & OSD_QUALITY_OUTLINE_SINGLE);
+
+  s_frame.now_us  = now_us;
+  s_frame.cost_us = 0;
+  s_frame.next    = 0;
+  s_frame.changed = false;
+}
+
+bool
+widget_scheduler_step(osd_context_t *ctx,
+                      osd_state_t *state,
+                      uint64_t deadline_us)
+{
+  uint64_t start = monotonic_us();
+  uint64_t now   = start;
+
+  while (s_frame.next < (int)WASM_OSD_WIDGET_COUNT)
+    {
+      s_frame.changed
+        |= widget_render(ctx, s_frame.next++, state, s_frame.now_us);
+
+      now = monotonic_us();
+      if (deadline_us != 0 && now >= deadline_us)
+        {
+          break;
+        }
+    }
+
+  s_frame.cost_us += now - start;
+  return s_frame.next == (int)WASM_OSD_WIDGET_COUNT;
+}
+
+bool
+widget_scheduler_end(void)
+{
+  render_budget_record(s_frame.cost_us);
+  return s_frame.changed;
+}
+
+bool
+widget_scheduler_render(osd_context_t *ctx, osd_state_t *state)
+{
+  widget_scheduler_begin(ctx, state);
+  widget_scheduler_step(ctx, state, 0);
+  return widget_scheduler_end();
+}
@@ -0,0 +1,116 @@
+// Widget Scheduler
+// Draws the widgets in order, each at its own update rate
+//
+// ════════════════════════════════════════════════════════════
+// WHY THIS EXISTS:
+// Every state update used to redraw every widget, yet most of them change
+// far slower than the ~30 Hz state rate: the timestamp once per second,
+// the sharpness heatmap when CvMeta arrives, and debug panels are readable
+// at a few Hz. A widget that is not due is served from the layer it drew
+// last instead, so freshness can be traded for CPU per widget.
+//
+// WHEN A WIDGET IS DRAWN:
+// - max_rate_hz (widget config section) caps redraws per second of state
+//   time (system_monotonic_time_us; the monotonic clock without a state).
+//   Due times fall on whole multiples of 1 / max_rate_hz.
+// - Widgets whose drawn inputs are known (timestamp: the displayed second,
+//   sharpness heatmap: CvMeta) are redrawn only when those change.
+// - Widgets with neither draw straight into the framebuffer every frame,
+//   exactly as before.
+// - Debug widgets are skipped while the frame-budget governor has
+//   OSD_QUALITY_SKIP_DEBUG on; the time of every render is reported to it
+//   (see render_budget.h).
+//
+// LAYERS:
+// A scheduled widget draws into a transparent full-size scratch buffer.
+// Its content bounds are copied into a compact per-widget layer, which is
+// composited onto the framebuffer on this and the following frames.
+// Compositing is premultiplied "over", the same operation as drawing
+// straight into the framebuffer, but rounded twice (into the layer, then
+// onto the framebuffer). Where the framebuffer is still transparent or the
+// widget's pixel is opaque the result is identical; where translucent
+// pixels land on earlier widgets it can differ by a few levels per
+// channel (up to 3 for three stacked translucent draws).
+// ════════════════════════════════════════════════════════════
+
+#ifndef WIDGET_SCHEDULER_H
+#define WIDGET_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "core/osd_context.h"
+#include "wasm/wasm_exports.h"
+
+// Forward declare state type (implementation uses osd_state.h accessors)
+typedef struct _ser_JonGUIState osd_state_t;
+
+// Read the widget rates from ctx->config and drop all layers
+// Call after the configuration is loaded and the widgets are initialized.
+void widget_scheduler_init(const osd_context_t *ctx);
+
+// Draw (or reuse) every widget into ctx->framebuffer
+//
+// Parameters:
+//   ctx:   OSD context; its framebuffer must be cleared
+//   state: Decoded state (NULL before the first update)
+//
+// Returns true if any widget has content in this frame
+bool widget_scheduler_render(osd_context_t *ctx, osd_state_t *state);
+
+// Signature of what the widget layers contribute to the next frame
+//
+// Frames with equal config, quality and this signature, whose fresh
+// widgets see equal state and payloads, have equal pixels: layered
+// widgets contribute the layer they will show, and widgets drawn straight
+// from state, payloads and config nothing.
+//
+// Parameters:
+//   quality:   OSD_QUALITY_* bits the frame will be drawn with
+//   signature: Receives the signature
+//   fresh:     Receives a bit (1 << WASM_OSD_WIDGET_*) per widget the
+//              frame draws from its state (not from a kept layer)
+//
+// Returns false if a widget will redraw from data it keeps across frames
+// (variant info, autofocus debug when due): the frame must be rendered.
+bool widget_scheduler_signature(const osd_context_t *ctx,
+                                const osd_state_t *state,
+                                uint32_t quality,
+                                uint64_t *signature,
+                                uint32_t *fresh);
+
+// Per-state bookkeeping of a frame that is not rendered because its
+// signature matched (same as for a frame reusing every layer)
+void widget_scheduler_skip(osd_context_t *ctx, osd_state_t *state);
+
+// Draw a frame in slices
+//
+// widget_scheduler_render() is widget_scheduler_begin(), one
+// widget_scheduler_step() without a deadline and widget_scheduler_end().
+// A sliced frame runs steps until one returns true; the framebuffer and
+// state must stay the same from begin to end. Widgets are not split, so a
+// step may overrun its deadline by the cost of one widget.
+
+// Start a frame (picks the quality level and the scheduler time)
+void widget_scheduler_begin(osd_context_t *ctx, osd_state_t *state);
+
+// Draw widgets until all are drawn or deadline_us (monotonic_us() clock,
+// 0 = none) has passed; at least one widget is drawn per call
+//
+// Returns true once every widget of the frame is drawn
+bool widget_scheduler_step(osd_context_t *ctx,
+                           osd_state_t *state,
+                           uint64_t deadline_us);
+
+// Finish a frame: reports its drawing time to the frame-budget governor
+//
+// Returns true if any widget has content in the frame
+bool widget_scheduler_end(void);
+
+// Per-widget cost table (WASM_OSD_WIDGET_COUNT entries)
+const wasm_osd_widget_stats_t *widget_scheduler_stats(void);
+
+// Free the layers and the scratch buffer
+void widget_scheduler_free(void);
+
+#endif // WIDGET_SCHEDULER_H
@@ -436,6 +436,23 @@ render_history_chart(framebuffer_t *fb, int x, int y, uint64_t now_us)
 // MAIN RENDER FUNCTION
 // ════════════════════════════════════════════════════════════
 
+void
+autofocus_debug_update(osd_context_t *ctx, osd_state_t *pb_state)
+{
+  if (!ctx->config.autofocus_debug.enabled)
+    return;
+
+  osd_sharpness_data_t sharp = { 0 };
+  if (!osd_state_get_sharpness(ctx, &sharp) || !sharp.valid)
+    return;
+
+  uint64_t now_us = 0;
+  if (pb_state)
+    now_us = osd_state_get_monotonic_time_us(pb_state);
+
+  history_add_sample(sharp.global_score, now_us);
+}
+
 bool
 autofocus_debug_render(osd_context_t *ctx, osd_state_t *pb_state)
 {
@@ -33,4 +33,16 @@ typedef struct _ser_JonGUIState osd_state_t;
  */
 bool autofocus_debug_render(osd_context_t *ctx, osd_state_t *pb_state);
 
+/**
+ * Add the sharpness sample of a state to the history without drawing.
+ *
+ * Used by the widget scheduler on frames that reuse the last drawn panel,
+ * so the history chart keeps every sample when it refreshes slower than
+ * states arrive.
+ *
+ * @param ctx      OSD context
+ * @param pb_state Telemetry state (for monotonic time)
+ */
+void autofocus_debug_update(osd_context_t *ctx, osd_state_t *pb_state);
+
 #endif // WIDGETS_AUTOFOCUS_DEBUG_H
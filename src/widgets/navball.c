@@ -3,6 +3,7 @@
 #include "core/framebuffer.h"
 #include "jon_shared_data.pb.h"
 #include "rendering/blending.h"
+#include "resources/skin_blob.h"
 #include "resources/svg.h"
 #include "utils/celestial_position.h"
 #include "utils/logging.h"
@@ -20,10 +21,13 @@
 // Note: Must include after math_decl.h
 #include <cglm/cglm.h>
 
-// STB Image for PNG loading
+// STB Image for PNG loading (dev builds only; packaged skins are
+// pre-decoded blobs, see resources/skin_blob.h)
+#ifdef NAVBALL_PNG_FALLBACK
 #define STB_IMAGE_IMPLEMENTATION
 #define STBI_NO_SIMD // Disable SIMD for WASM compatibility
 #include "stb_image.h"
+#endif
 
 // ════════════════════════════════════════════════════════════
 // 3D MATH UTILITIES
@@ -207,89 +211,406 @@ typedef int32_t fixed16_t;
 // ════════════════════════════════════════════════════════════
 // TEXTURE UTILITIES
 // ════════════════════════════════════════════════════════════
+//
+// Skins are authored at 512-1024 px wide but the ball is drawn at a few
+// hundred pixels, so sampling the full-size image aliases (shimmering during
+// fast slews) and strides across megabytes of texels. At load time the skin
+// is reduced to a mip chain with a 2×2 box filter. Levels finer than the one
+// matched to navball_size are dropped, so the sphere center samples ~1 texel
+// per pixel and the foreshortened limb steps down to coarser levels.
+//
+// Each level is stored in 4×4 texel tiles (64 bytes, one cache line), so
+// the 2×2 bilinear footprint usually touches a single line instead of two
+// rows a full texture stride apart. Build with -DNAVBALL_TEXTURE_TILED=0 to
+// fall back to row-major storage.
+
+#ifndef NAVBALL_TEXTURE_TILED
+#define NAVBALL_TEXTURE_TILED 1
+#endif
+
+#define TEXTURE_MAX_LEVELS 6 // Mip levels kept (base level + 5 coarser)
+#define TEXTURE_MIN_LEVEL_SIZE 8 // Stop reducing below this height
+#define TEXTURE_TILE_SHIFT 2     // 4×4 texel tiles
+#define TEXTURE_TILE_MASK ((1 << TEXTURE_TILE_SHIFT) - 1)
 
-// Texture structure
+// Single mip level (RGBA texels, 0xAABBGGRR)
 typedef struct
 {
-  uint8_t *data; // RGBA pixel data
+  uint32_t *texels;
   int width;
   int height;
+  int tiles_x; // Tiles per row (tiled storage only)
+} texture_level_t;
+
+// Texture structure (mip chain, level 0 is the finest level kept)
+typedef struct
+{
+  texture_level_t levels[TEXTURE_MAX_LEVELS];
+  int level_count;
+  int width; // Level 0 dimensions
+  int height;
 } texture_t;
 
-// Load PNG texture from file
+// Storage index of texel (x, y) within a level
+static inline int
+texture_texel_index(const texture_level_t *level, int x, int y)
+{
+#if NAVBALL_TEXTURE_TILED
+  int tile = (y >> TEXTURE_TILE_SHIFT) * level->tiles_x
+             + (x >> TEXTURE_TILE_SHIFT);
+  return (tile << (2 * TEXTURE_TILE_SHIFT))
+         + ((y & TEXTURE_TILE_MASK) << TEXTURE_TILE_SHIFT)
+         + (x & TEXTURE_TILE_MASK);
+#else
+  return y * level->width + x;
+#endif
+}
+
+// Store a row-major RGBA image as a texture level (tiled or linear)
+static bool
+texture_level_store(texture_level_t *level,
+                    const uint32_t *pixels,
+                    int width,
+                    int height)
+{
+  level->width   = width;
+  level->height  = height;
+  level->tiles_x = (width + TEXTURE_TILE_MASK) >> TEXTURE_TILE_SHIFT;
+
+#if NAVBALL_TEXTURE_TILED
+  int tiles_y  = (height + TEXTURE_TILE_MASK) >> TEXTURE_TILE_SHIFT;
+  size_t count = (size_t)level->tiles_x * tiles_y
+                 << (2 * TEXTURE_TILE_SHIFT);
+#else
+  size_t count = (size_t)width * height;
+#endif
+
+  level->texels = (uint32_t *)calloc(count, sizeof(uint32_t));
+  if (!level->texels)
+    return false;
+
+  for (int y = 0; y < height; y++)
+    {
+      for (int x = 0; x < width; x++)
+        {
+          level->texels[texture_texel_index(level, x, y)]
+            = pixels[y * width + x];
+        }
+    }
+
+  return true;
+}
+
+// Halve a row-major RGBA image with a 2×2 box filter (odd edges clamp)
+static uint32_t *
+texture_downsample(const uint32_t *src, int width, int height)
+{
+  int dst_w     = (width > 1) ? width / 2 : 1;
+  int dst_h     = (height > 1) ? height / 2 : 1;
+  uint32_t *dst = (uint32_t *)malloc((size_t)dst_w * dst_h * sizeof(uint32_t));
+  if (!dst)
+    return NULL;
+
+  for (int y = 0; y < dst_h; y++)
+    {
+      int y0 = y * 2;
+      int y1 = (y0 + 1 < height) ? y0 + 1 : y0;
+
+      for (int x = 0; x < dst_w; x++)
+        {
+          int x0 = x * 2;
+          int x1 = (x0 + 1 < width) ? x0 + 1 : x0;
+
+          uint32_t p[4] = { src[y0 * width + x0], src[y0 * width + x1],
+                            src[y1 * width + x0], src[y1 * width + x1] };
+
+          uint32_t out = 0;
+          for (int shift = 0; shift < 32; shift += 8)
+            {
+              uint32_t sum = ((p[0] >> shift) & 0xFF) + ((p[1] >> shift) & 0xFF)
+                             + ((p[2] >> shift) & 0xFF)
+                             + ((p[3] >> shift) & 0xFF);
+              out |= ((sum + 2) >> 2) << shift;
+            }
+          dst[y * dst_w + x] = out;
+        }
+    }
+
+  return dst;
+}
+
+// Pick the base mip level for a ball of `target_size` pixels
+//
+// Across the ball diameter the sphere shows half the skin's longitude range,
+// i.e. width/2 texels over target_size pixels at the center.
+static int
+texture_base_level(int width, int target_size)
+{
+  int level = 0;
+
+  if (target_size <= 0)
+    return 0;
+
+  while ((width >> (level + 1)) >= 2 * target_size)
+    level++;
+
+  return level;
+}
+
+// Free texture
+static void
+texture_free(texture_t *tex)
+{
+  if (tex)
+    {
+      for (int i = 0; i < tex->level_count; i++)
+        free(tex->levels[i].texels);
+      free(tex);
+    }
+}
+
+// Build a texture's mip chain from a row-major RGBA image
+//
+// target_size is the nav ball diameter in pixels; levels finer than needed
+// for that size are discarded after filtering. The source image is handed
+// over: release(alloc) is called once it is no longer needed.
 static texture_t *
-texture_load_png(const char *filepath)
+texture_build(const char *source,
+              uint32_t *pixels,
+              int width,
+              int height,
+              int target_size,
+              void *alloc,
+              void (*release)(void *))
 {
-  texture_t *tex = (texture_t *)malloc(sizeof(texture_t));
+  texture_t *tex = (texture_t *)calloc(1, sizeof(texture_t));
   if (!tex)
+    {
+      release(alloc);
+      return NULL;
+    }
+
+  int base_level = texture_base_level(width, target_size);
+
+  // Walk the chain: reduce level by level, keep from base_level onwards
+  bool owned = false; // pixels allocated here (vs. handed over by caller)
+  bool ok    = true;
+
+  for (int level = 0; ok && tex->level_count < TEXTURE_MAX_LEVELS; level++)
+    {
+      if (level >= base_level)
+        {
+          ok = texture_level_store(&tex->levels[tex->level_count], pixels,
+                                   width, height);
+          if (ok)
+            tex->level_count++;
+        }
+
+      if (height / 2 < TEXTURE_MIN_LEVEL_SIZE)
+        break;
+
+      uint32_t *next = texture_downsample(pixels, width, height);
+      if (owned)
+        free(pixels);
+      else
+        release(alloc);
+
+      pixels = next;
+      owned  = true;
+      ok     = ok && (next != NULL);
+      width  = (width > 1) ? width / 2 : 1;
+      height = (height > 1) ? height / 2 : 1;
+    }
+
+  if (owned)
+    free(pixels);
+  else
+    release(alloc);
+
+  if (!ok || tex->level_count == 0)
+    {
+      LOG_ERROR("Failed to build mip chain for: %s", source);
+      texture_free(tex);
+      return NULL;
+    }
+
+  tex->width  = tex->levels[0].width;
+  tex->height = tex->levels[0].height;
+
+  LOG_INFO("Loaded texture: %s (base %dx%d, %d mip levels%s)", source,
+           tex->width, tex->height, tex->level_count,
+           NAVBALL_TEXTURE_TILED ? ", tiled" : "");
+
+  return tex;
+}
+
+// Load a pre-decoded skin blob (see resources/skin_blob.h)
+//
+// The whole file is read with a single fread() and the pixel payload is
+// used in place. Returns NULL without logging an error if the file does not
+// exist, so callers can try the next location.
+static texture_t *
+texture_load_blob(const char *filepath, int target_size)
+{
+  FILE *file = fopen(filepath, "rb");
+  if (!file)
     return NULL;
 
-  int channels;
+  fseek(file, 0, SEEK_END);
+  long file_size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+
+  if (file_size < SKIN_BLOB_HEADER_SIZE)
+    {
+      LOG_ERROR("Skin blob too small: %s (%ld bytes)", filepath, file_size);
+      fclose(file);
+      return NULL;
+    }
+
+  uint8_t *blob = (uint8_t *)malloc((size_t)file_size);
+  if (!blob)
+    {
+      LOG_ERROR("Failed to allocate %ld bytes for skin blob: %s", file_size,
+                filepath);
+      fclose(file);
+      return NULL;
+    }
+
+  size_t read = fread(blob, 1, (size_t)file_size, file);
+  fclose(file);
+
+  skin_blob_header_t header;
+  memcpy(&header, blob, sizeof(header));
+
+  size_t pixel_bytes = (size_t)header.width * header.height * 4;
+  if (read != (size_t)file_size
+      || memcmp(header.magic, SKIN_BLOB_MAGIC, 4) != 0
+      || header.version != SKIN_BLOB_VERSION
+      || header.header_size < SKIN_BLOB_HEADER_SIZE
+      || header.header_size % 4 != 0 || header.width == 0
+      || header.height == 0 || header.width > SKIN_BLOB_MAX_DIMENSION
+      || header.height > SKIN_BLOB_MAX_DIMENSION
+      || header.header_size + pixel_bytes > (size_t)file_size)
+    {
+      LOG_ERROR("Invalid skin blob: %s", filepath);
+      free(blob);
+      return NULL;
+    }
 
-  tex->data = stbi_load(filepath, &tex->width, &tex->height, &channels, 4);
+  return texture_build(filepath, (uint32_t *)(blob + header.header_size),
+                       (int)header.width, (int)header.height, target_size,
+                       blob, free);
+}
 
-  if (!tex->data)
+#ifdef NAVBALL_PNG_FALLBACK
+// Load PNG texture from file (dev builds only, when no blob is available)
+static texture_t *
+texture_load_png(const char *filepath, int target_size)
+{
+  int width, height, channels;
+
+  uint8_t *data = stbi_load(filepath, &width, &height, &channels, 4);
+
+  if (!data)
     {
       LOG_ERROR("stbi_load failed for: %s (reason: %s)", filepath,
                 stbi_failure_reason());
-      free(tex);
       return NULL;
     }
 
-  LOG_INFO("Loaded texture: %s (%dx%d, %d channels)", filepath, tex->width,
-           tex->height, channels);
+  LOG_WARN("Decoding PNG skin at runtime: %s (%d channels)", filepath,
+           channels);
 
-  return tex;
+  return texture_build(filepath, (uint32_t *)data, width, height, target_size,
+                       data, stbi_image_free);
 }
+#endif
 
-// Free texture
-static void
-texture_free(texture_t *tex)
+// Load a nav ball skin by its PNG filename
+//
+// Search order:
+//   1. resources/navball_skins/<name>.nbskin        (packaged blob)
+//   2. build/resources/navball_skins/<name>.nbskin  (`make skins` output)
+//   3. resources/navball_skins/<name>.png           (dev builds only)
+static texture_t *
+texture_load_skin(const char *png_filename, int target_size)
 {
-  if (tex)
+  static const char *const blob_dirs[]
+    = { "resources/navball_skins", "build/resources/navball_skins" };
+
+  // Strip ".png" to get the skin's base name
+  const char *ext = strrchr(png_filename, '.');
+  int stem_len = ext ? (int)(ext - png_filename) : (int)strlen(png_filename);
+
+  char path[512];
+  for (size_t i = 0; i < sizeof(blob_dirs) / sizeof(blob_dirs[0]); i++)
     {
-      if (tex->data)
-        stbi_image_free(tex->data);
-      free(tex);
+      snprintf(path, sizeof(path), "%s/%.*s%s", blob_dirs[i], stem_len,
+               png_filename, SKIN_BLOB_EXTENSION);
+
+      texture_t *tex = texture_load_blob(path, target_size);
+      if (tex)
+        return tex;
     }
+
+#ifdef NAVBALL_PNG_FALLBACK
+  snprintf(path, sizeof(path), "resources/navball_skins/%s", png_filename);
+  return texture_load_png(path, target_size);
+#else
+  LOG_ERROR("No pre-decoded skin found for %s (run `make skins`)",
+            png_filename);
+  return NULL;
+#endif
 }
 
 // Sample texture with bilinear filtering (UV in 0-1 range)
 //
+// lod selects the mip level (0 = finest kept level) and is clamped to the
+// chain length.
+//
 // Uses floating-point math for highest quality. Benchmarking showed float
 // is actually 3.8% FASTER than fixed-point (179 μs vs 186 μs) due to
 // modern JIT optimizations in Wasmtime/Cranelift.
 static uint32_t
-texture_sample(const texture_t *tex, float u, float v)
+texture_sample(const texture_t *tex, float u, float v, int lod)
 {
-  if (!tex || !tex->data)
+  if (!tex || tex->level_count == 0)
     return 0xFF000000; // Black with full alpha
 
+  if (lod >= tex->level_count)
+    lod = tex->level_count - 1;
+
+  const texture_level_t *level = &tex->levels[lod];
+
   // Wrap UV coordinates
   u = u - floorf(u);
   v = v - floorf(v);
 
   // Convert to pixel coordinates (use full width/height for seamless wrapping)
-  float fx = u * tex->width;
-  float fy = v * tex->height;
+  float fx = u * level->width;
+  float fy = v * level->height;
 
   // Wrap fx/fy before extracting integer part (handles exactly 1.0 case)
-  fx = fmodf(fx, (float)tex->width);
-  fy = fmodf(fy, (float)tex->height);
+  fx = fmodf(fx, (float)level->width);
+  fy = fmodf(fy, (float)level->height);
 
   int x0 = (int)fx;
   int y0 = (int)fy;
-  int x1 = (x0 + 1) % tex->width;
-  int y1 = (y0 + 1) % tex->height;
+  int x1 = (x0 + 1) % level->width;
+  int y1 = (y0 + 1) % level->height;
 
   float tx = fx - x0;
   float ty = fy - y0;
 
   // Get 4 neighbor pixels
-  uint8_t *p00 = &tex->data[(y0 * tex->width + x0) * 4];
-  uint8_t *p10 = &tex->data[(y0 * tex->width + x1) * 4];
-  uint8_t *p01 = &tex->data[(y1 * tex->width + x0) * 4];
-  uint8_t *p11 = &tex->data[(y1 * tex->width + x1) * 4];
+  const uint8_t *p00
+    = (const uint8_t *)&level->texels[texture_texel_index(level, x0, y0)];
+  const uint8_t *p10
+    = (const uint8_t *)&level->texels[texture_texel_index(level, x1, y0)];
+  const uint8_t *p01
+    = (const uint8_t *)&level->texels[texture_texel_index(level, x0, y1)];
+  const uint8_t *p11
+    = (const uint8_t *)&level->texels[texture_texel_index(level, x1, y1)];
 
   // Bilinear interpolation
   uint8_t r = (uint8_t)((1 - tx) * (1 - ty) * p00[0] + tx * (1 - ty) * p10[0]
@@ -305,15 +626,49 @@ texture_sample(const texture_t *tex, float u, float v)
   return (a << 24) | (b << 16) | (g << 8) | r;
 }
 
+// Sample texture at the nearest texel (UV in 0-1 range)
+//
+// Reduced-quality variant of texture_sample() for the frame-budget
+// governor (OSD_QUALITY_NAVBALL_NEAREST): one texel read instead of four.
+static uint32_t
+texture_sample_nearest(const texture_t *tex, float u, float v, int lod)
+{
+  if (!tex || tex->level_count == 0)
+    return 0xFF000000; // Black with full alpha
+
+  if (lod >= tex->level_count)
+    lod = tex->level_count - 1;
+
+  const texture_level_t *level = &tex->levels[lod];
+
+  // Wrap UV coordinates
+  u = u - floorf(u);
+  v = v - floorf(v);
+
+  int x = (int)(u * level->width) % level->width;
+  int y = (int)(v * level->height) % level->height;
+
+  const uint8_t *p
+    = (const uint8_t *)&level->texels[texture_texel_index(level, x, y)];
+
+  // Assemble RGBA color (0xAABBGGRR format)
+  return ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16)
+         | ((uint32_t)p[1] << 8) | p[0];
+}
+
 // ════════════════════════════════════════════════════════════
 // NAV BALL PRECOMPUTATION (LOOKUP TABLE)
 // ════════════════════════════════════════════════════════════
 
+// Smallest view-facing component used for the limb mip level (~89° off axis)
+#define NAVBALL_LUT_MIN_Z (1.0f / 64.0f)
+
 // Lookup table entry for nav ball rendering optimization
 typedef struct
 {
   vec3_t sphere_point; // Pre-computed normalized 3D point on sphere
   bool valid;          // Is this pixel inside the sphere?
+  uint8_t lod;         // Mip level offset for limb foreshortening
 } navball_lut_entry_t;
 
 // Lookup table structure per nav ball instance
@@ -325,6 +680,21 @@ typedef struct
   float radius;                 // Sphere radius
 } navball_lut_t;
 
+// Mip level offset for a sphere pixel with view-facing component z
+//
+// Towards the limb one screen pixel covers 1/z texels radially (and 1
+// tangentially); the geometric mean gives a footprint of 1/sqrt(z), i.e.
+// log2(1/z)/2 levels above the center level.
+static uint8_t
+navball_lut_lod(float z)
+{
+  if (z < NAVBALL_LUT_MIN_Z)
+    z = NAVBALL_LUT_MIN_Z;
+
+  int lod = (int)(-0.5f * logf(z) / logf(2.0f));
+  return (uint8_t)((lod < TEXTURE_MAX_LEVELS) ? lod : TEXTURE_MAX_LEVELS - 1);
+}
+
 // Initialize lookup table for nav ball rendering
 // Pre-computes sphere geometry to eliminate per-frame calculations
 static navball_lut_t *
@@ -380,6 +750,7 @@ navball_lut_create(int size)
               // Store pre-computed normalized point
               lut->entries[idx].sphere_point = point;
               lut->entries[idx].valid        = true;
+              lut->entries[idx].lod          = navball_lut_lod(point.z);
 #ifndef NDEBUG
               pixels_inside++;
 #endif
@@ -483,6 +854,155 @@ navball_skin_from_string(const char *name)
   return NAVBALL_SKIN_STOCK; // Default
 }
 
+// ════════════════════════════════════════════════════════════
+// NAV BALL RENDER CACHE
+// ════════════════════════════════════════════════════════════
+//
+// The per-pixel sphere resample dominates the widget cost, yet a stationary
+// platform produces the same image on every state update. The finished
+// navball layer (sphere, center indicator, celestial icons, level marker) is
+// therefore kept in an offscreen buffer, keyed on everything that affects its
+// pixels. Orientation and celestial angles are quantized to
+// navball.cache_epsilon degrees so sub-pixel sensor jitter still hits.
+//
+// The layer is padded by `margin` pixels on every side because the center
+// indicator and celestial icons may extend past the sphere edge.
+
+// Quality reductions that change how the sphere is drawn
+#define NAVBALL_QUALITY_BITS                                                  \
+  (OSD_QUALITY_NAVBALL_NEAREST | OSD_QUALITY_NAVBALL_HALF_RES)
+
+// Everything that changes the cached layer (compared with memcmp, so the
+// struct is always zeroed before being filled)
+typedef struct
+{
+  int32_t azimuth_q; // Orientation quantized to cache epsilon
+  int32_t elevation_q;
+  int32_t bank_q;
+  int32_t sun_azimuth_q; // Celestial positions quantized to cache epsilon
+  int32_t sun_altitude_q;
+  int32_t moon_azimuth_q;
+  int32_t moon_altitude_q;
+  int32_t skin;
+  int32_t size;
+  uint32_t quality; // NAVBALL_QUALITY_BITS the sphere was drawn with
+  uint8_t has_orientation;
+  uint8_t sun_visible;
+  uint8_t moon_visible;
+} navball_cache_key_t;
+
+typedef struct
+{
+  uint32_t *pixels; // Offscreen RGBA layer (width * height)
+  int width;        // navball_size + 2 * margin
+  int height;
+  int margin; // Padding for icons overhanging the sphere
+  bool valid; // pixels hold the image described by key
+  navball_cache_key_t key;
+} navball_cache_t;
+
+// Quantize an angle (degrees) to an integer step of `epsilon` degrees
+static inline int32_t
+navball_quantize(double degrees, float epsilon)
+{
+  return (int32_t)floor(degrees / epsilon + 0.5);
+}
+
+// Padding needed around the sphere so overhanging icons are not clipped
+static int
+navball_cache_margin(const osd_context_t *ctx)
+{
+  int margin = 0;
+
+  if (ctx->navball_show_center_indicator)
+    {
+      int indicator_size
+        = (int)(ctx->navball_size * ctx->navball_center_indicator_scale);
+      if (indicator_size > ctx->navball_size)
+        margin = (indicator_size - ctx->navball_size) / 2 + 1;
+    }
+
+  if (ctx->celestial_enabled)
+    {
+      int indicator_size
+        = (int)(ctx->navball_size * 0.52f * ctx->celestial_indicator_scale);
+      if (indicator_size / 2 + 1 > margin)
+        margin = indicator_size / 2 + 1;
+    }
+
+  return margin;
+}
+
+static navball_cache_t *
+navball_cache_create(const osd_context_t *ctx)
+{
+  navball_cache_t *cache
+    = (navball_cache_t *)calloc(1, sizeof(navball_cache_t));
+  if (!cache)
+    return NULL;
+
+  cache->margin = navball_cache_margin(ctx);
+  cache->width  = ctx->navball_size + 2 * cache->margin;
+  cache->height = cache->width;
+  cache->pixels = (uint32_t *)malloc((size_t)cache->width
+                                     * (size_t)cache->height
+                                     * sizeof(uint32_t));
+  if (!cache->pixels)
+    {
+      free(cache);
+      return NULL;
+    }
+
+  LOG_INFO("Nav ball: render cache %dx%d (margin=%d, epsilon=%.3f deg)",
+           cache->width, cache->height, cache->margin,
+           ctx->navball_cache_epsilon);
+  return cache;
+}
+
+static void
+navball_cache_free(navball_cache_t *cache)
+{
+  if (cache)
+    {
+      free(cache->pixels);
+      free(cache);
+    }
+}
+
+// Composite the cached layer onto the framebuffer at (x, y), with clipping
+static void
+navball_cache_blit(const navball_cache_t *cache,
+                   framebuffer_t *fb,
+                   int x,
+                   int y)
+{
+  int x0 = (x < 0) ? -x : 0;
+  int y0 = (y < 0) ? -y : 0;
+  int x1 = cache->width;
+  int y1 = cache->height;
+
+  if (x + x1 > (int)fb->width)
+    x1 = (int)fb->width - x;
+  if (y + y1 > (int)fb->height)
+    y1 = (int)fb->height - y;
+  if (x0 >= x1 || y0 >= y1)
+    return;
+
+  // The cache was drawn onto transparent black: composite premultiplied
+  for (int cy = y0; cy < y1; cy++)
+    {
+      const uint32_t *src = &cache->pixels[cy * cache->width];
+      uint32_t *dst       = framebuffer_get_pixel_ptr(fb, x + x0, y + cy);
+
+      for (int cx = x0; cx < x1; cx++)
+        {
+          uint32_t color = src[cx];
+          if ((color >> 24) != 0)
+            dst[cx - x0] = blend_premultiplied(dst[cx - x0], color);
+        }
+    }
+}
+
 // ════════════════════════════════════════════════════════════
 // NAV BALL WIDGET IMPLEMENTATION
 // ════════════════════════════════════════════════════════════
@@ -508,23 +1028,25 @@ navball_init(osd_context_t *ctx, const navball_config_t *config)
   ctx->navball_show_center_indicator  = config->show_center_indicator;
   ctx->navball_center_indicator_scale = config->center_indicator_scale;
 
+  // Store render cache configuration
+  ctx->navball_cache_epsilon = config->cache_epsilon;
+  ctx->navball_cache_hits    = 0;
+  ctx->navball_cache_misses  = 0;
+
   if (!config->enabled)
     {
       LOG_INFO("Nav ball disabled in config");
       return true; // Not an error, just disabled
     }
 
-  // Load skin texture
+  // Load skin texture (pre-decoded blob, PNG fallback in dev builds)
   const char *skin_filename = navball_skin_to_filename(config->skin);
-  char skin_path[512];
-  snprintf(skin_path, sizeof(skin_path), "resources/navball_skins/%s",
-           skin_filename);
 
-  ctx->navball_texture = (void *)texture_load_png(skin_path);
+  ctx->navball_texture = (void *)texture_load_skin(skin_filename, config->size);
 
   if (!ctx->navball_texture)
     {
-      LOG_ERROR("Failed to load nav ball skin: %s", skin_path);
+      LOG_ERROR("Failed to load nav ball skin: %s", skin_filename);
       ctx->navball_enabled = false;
       return false;
     }
@@ -624,6 +1146,39 @@ navball_init(osd_context_t *ctx, const navball_config_t *config)
         }
     }
 
+  // Load the precomputed ephemeris table (falls back to the Astronomy Engine
+  // unless built table-only)
+  if (ctx->celestial_enabled && !celestial_init())
+    {
+      LOG_WARN("Celestial positions unavailable, disabling feature");
+      ctx->celestial_enabled = false;
+    }
+
+  // Ephemeris cache for sun/moon positions. Failure is not fatal, positions
+  // are then computed directly every frame.
+  if (ctx->celestial_enabled
+      && ctx->config.celestial_indicators.update_interval > 0)
+    {
+      ctx->celestial_cache = (void *)celestial_cache_create(
+        ctx->config.celestial_indicators.update_interval,
+        ctx->config.celestial_indicators.observer_threshold);
+
+      if (!ctx->celestial_cache)
+        LOG_WARN("Failed to create celestial cache, computing per frame");
+    }
+
+  // Create render cache last: its margin depends on which overlays survived
+  // loading. Failure is not fatal, the widget then renders uncached.
+  if (config->cache_epsilon > 0.0f)
+    {
+      ctx->navball_cache = (void *)navball_cache_create(ctx);
+      if (!ctx->navball_cache)
+        {
+          LOG_WARN("Failed to allocate nav ball render cache, rendering "
+                   "uncached");
+        }
+    }
+
   LOG_INFO("Nav ball initialized: %s at (%d,%d) size=%d", skin_filename,
            config->position_x, config->position_y, config->size);
   return true;
@@ -650,6 +1205,7 @@ navball_init(osd_context_t *ctx, const navball_config_t *config)
 //   - Bilinear filtering: Fixed-point 16.16 math for fast interpolation
 //   - Early rejection: LUT marks invalid pixels (outside circle) to skip
 //   processing
+//   - Render cache: unchanged quantized orientation reuses the last layer
 //
 // CUSTOMIZATION POINTS for developers:
 //   - Change skin: Set ctx->navball_texture to different texture
@@ -657,16 +1213,67 @@ navball_init(osd_context_t *ctx, const navball_config_t *config)
 //   - Change position: Set ctx->navball_x, ctx->navball_y
 //   - Disable level marker: Set ctx->navball_show_level_marker = false
 //
-bool
-navball_render(osd_context_t *ctx, osd_state_t *pb_state)
+
+// Navball layer inputs shared by the cache key and the draw helpers
+typedef struct
 {
-  // Guard clauses: verify navball is initialized and ready to render
-  if (!ctx || !ctx->navball_enabled || !ctx->navball_texture
-      || !ctx->navball_lut)
-    {
-      return false;
-    }
+  bool has_orientation;
+  double azimuth;   // Yaw (heading around vertical axis)
+  double elevation; // Pitch (nose up/down)
+  double bank;      // Roll (wing tilt)
+  bool sun_visible;
+  bool moon_visible;
+  celestial_positions_t positions;
+} navball_frame_t;
+
+// Lit skin color of one sphere pixel
+static uint32_t
+navball_shade_pixel(const texture_t *skin,
+                    const mat4_t *rotation,
+                    const navball_lut_entry_t *entry,
+                    vec3_t light_dir,
+                    bool nearest)
+{
+  // Use precomputed normalized 3D point (eliminates sqrtf + normalize!)
+  vec3_t point = entry->sphere_point;
+
+  // Apply rotation
+  vec3_t rotated = mat4_mul_vec3(*rotation, point);
+
+  // Convert to UV coordinates
+  vec2_t uv = sphere_to_uv(rotated);
+
+  // Sample skin texture (bilinear unless reduced to nearest), from the mip
+  // level matching this pixel's footprint
+  uint32_t color = nearest
+                     ? texture_sample_nearest(skin, uv.u, uv.v, entry->lod)
+                     : texture_sample(skin, uv.u, uv.v, entry->lod);
+
+  // Apply simple lighting for depth perception
+  // Note: Using precomputed point as normal (already normalized)
+  float ndotl = vec3_dot(point, light_dir);
+  ndotl       = (ndotl < 0) ? 0 : ndotl;
+
+  float lighting = 0.4f + 0.6f * ndotl; // Ambient + diffuse
+
+  // Apply lighting (extract RGBA channels: 0xAABBGGRR)
+  uint8_t r = (uint8_t)((color & 0xFF) * lighting);
+  uint8_t g = (uint8_t)(((color >> 8) & 0xFF) * lighting);
+  uint8_t b = (uint8_t)(((color >> 16) & 0xFF) * lighting);
+  uint8_t a = (color >> 24) & 0xFF;
+
+  // Assemble RGBA color (0xAABBGGRR format)
+  return (a << 24) | (b << 16) | (g << 8) | r;
+}
 
+// Resample the skin onto the sphere with origin (ox, oy) in fb
+static void
+navball_draw_sphere(osd_context_t *ctx,
+                    framebuffer_t *fb,
+                    int ox,
+                    int oy,
+                    const navball_frame_t *frame)
+{
   texture_t *skin = (texture_t *)ctx->navball_texture;
 
   // ════════════════════════════════════════════════════════════
@@ -703,16 +1310,9 @@ navball_render(osd_context_t *ctx, osd_state_t *pb_state)
   //   - Roll (bank): Inverted - platform rolls right → sphere appears to roll
   //   left
   //
-  float azimuth   = 0.0f; // Yaw (heading around vertical axis)
-  float elevation = 0.0f; // Pitch (nose up/down)
-  float bank      = 0.0f; // Roll (wing tilt)
-
-  if (pb_state->has_actual_space_time)
-    {
-      azimuth   = (float)pb_state->actual_space_time.azimuth;
-      elevation = (float)pb_state->actual_space_time.elevation;
-      bank      = (float)pb_state->actual_space_time.bank;
-    }
+  float azimuth   = (float)frame->azimuth;
+  float elevation = (float)frame->elevation;
+  float bank      = (float)frame->bank;
 
   // Convert degrees to radians (remove negations to fix direction inversions)
   float pitch_rad = DEG_TO_RAD(elevation); // Platform up → sphere up
@@ -733,66 +1333,111 @@ navball_render(osd_context_t *ctx, osd_state_t *pb_state)
   mat4_t rotation;
   memcpy(rotation.m, cglm_mat, sizeof(float) * 16);
 
-  // Framebuffer setup
-  framebuffer_t fb;
-  framebuffer_init(&fb, ctx->framebuffer, ctx->width, ctx->height);
-
   // Get precomputed lookup table
   navball_lut_t *lut = (navball_lut_t *)ctx->navball_lut;
 
   // Pre-compute lighting direction (normalize once, not per pixel)
   vec3_t light_dir = vec3_normalize(vec3_new(0.3f, 0.3f, 1.0f));
 
-  for (int y = 0; y < ctx->navball_size; y++)
+  // Frame-budget reductions: point sampling, and one shaded sample per
+  // 2x2 block (the first pixel of the block inside the sphere)
+  bool nearest = (ctx->quality & OSD_QUALITY_NAVBALL_NEAREST) != 0;
+  int step     = (ctx->quality & OSD_QUALITY_NAVBALL_HALF_RES) ? 2 : 1;
+
+  for (int by = 0; by < ctx->navball_size; by += step)
     {
-      for (int x = 0; x < ctx->navball_size; x++)
+      for (int bx = 0; bx < ctx->navball_size; bx += step)
         {
-          // Get precomputed LUT entry
-          int idx                    = y * lut->size + x;
-          navball_lut_entry_t *entry = &lut->entries[idx];
+          uint32_t lit_color = 0;
+          bool shaded        = false;
 
-          // Skip pixels outside sphere (precomputed validity check)
-          if (!entry->valid)
-            continue;
-
-          // Use precomputed normalized 3D point (eliminates sqrtf + normalize!)
-          vec3_t point = entry->sphere_point;
-
-          // Apply rotation
-          vec3_t rotated = mat4_mul_vec3(rotation, point);
-
-          // Convert to UV coordinates
-          vec2_t uv = sphere_to_uv(rotated);
-
-          // Sample skin texture with floating-point bilinear filtering
-          uint32_t color = texture_sample(skin, uv.u, uv.v);
-
-          // Apply simple lighting for depth perception
-          // Note: Using precomputed point as normal (already normalized)
-          float ndotl = vec3_dot(point, light_dir);
-          ndotl       = (ndotl < 0) ? 0 : ndotl;
-
-          float lighting = 0.4f + 0.6f * ndotl; // Ambient + diffuse
-
-          // Apply lighting (extract RGBA channels: 0xAABBGGRR)
-          uint8_t r = (uint8_t)((color & 0xFF) * lighting);
-          uint8_t g = (uint8_t)(((color >> 8) & 0xFF) * lighting);
-          uint8_t b = (uint8_t)(((color >> 16) & 0xFF) * lighting);
-          uint8_t a = (color >> 24) & 0xFF;
-
-          // Blend to framebuffer
-          int screen_x = ctx->navball_x + x;
-          int screen_y = ctx->navball_y + y;
-
-          if (screen_x >= 0 && screen_x < (int)ctx->width && screen_y >= 0
-              && screen_y < (int)ctx->height)
+          for (int y = by; y < by + step && y < ctx->navball_size; y++)
             {
-              // Assemble RGBA color (0xAABBGGRR format)
-              uint32_t lit_color = (a << 24) | (b << 16) | (g << 8) | r;
-              framebuffer_blend_pixel(&fb, screen_x, screen_y, lit_color);
+              for (int x = bx; x < bx + step && x < ctx->navball_size; x++)
+                {
+                  // Get precomputed LUT entry
+                  int idx                    = y * lut->size + x;
+                  navball_lut_entry_t *entry = &lut->entries[idx];
+
+                  // Skip pixels outside sphere (precomputed validity check)
+                  if (!entry->valid)
+                    continue;
+
+                  if (!shaded)
+                    {
+                      lit_color = navball_shade_pixel(skin, &rotation, entry,
+                                                      light_dir, nearest);
+                      shaded    = true;
+                    }
+
+                  // Blend to framebuffer
+                  int screen_x = ox + x;
+                  int screen_y = oy + y;
+
+                  if (screen_x >= 0 && screen_x < (int)fb->width
+                      && screen_y >= 0 && screen_y < (int)fb->height)
+                    {
+                      framebuffer_blend_pixel(fb, screen_x, screen_y,
+                                              lit_color);
+                    }
+                }
             }
         }
     }
+}
+
+// Draw one celestial body indicator (front or back hemisphere variant)
+static void
+navball_draw_celestial_body(osd_context_t *ctx,
+                            framebuffer_t *fb,
+                            int ox,
+                            int oy,
+                            const navball_frame_t *frame,
+                            const celestial_position_t *body,
+                            svg_resource_t *front_svg,
+                            svg_resource_t *back_svg)
+{
+  // Calculate navball geometry
+  int navball_center_x = ox + ctx->navball_size / 2;
+  int navball_center_y = oy + ctx->navball_size / 2;
+  int navball_radius   = ctx->navball_size / 2;
+
+  // Default indicator size (52% of navball size for better visibility)
+  int indicator_size
+    = (int)(ctx->navball_size * 0.52f * ctx->celestial_indicator_scale);
+
+  // Convert celestial coordinates to navball screen position
+  int body_x, body_y;
+  bool is_front = celestial_to_navball_coords(
+    body->azimuth, body->altitude, frame->azimuth, frame->elevation,
+    frame->bank, navball_center_x, navball_center_y, navball_radius, &body_x,
+    &body_y);
+
+  // Select appropriate SVG based on visibility
+  svg_resource_t *svg = is_front ? front_svg : back_svg;
+
+  // Behind indicators: smaller size (70%) and reduced opacity (50%)
+  int render_size    = is_front ? indicator_size : (int)(indicator_size * 0.7f);
+  float render_alpha = is_front ? 1.0f : 0.5f;
+
+  // Render indicator centered at calculated position
+  if (svg->image)
+    {
+      svg_render_with_alpha(fb, svg, body_x - render_size / 2,
+                            body_y - render_size / 2, render_size, render_size,
+                            render_alpha);
+    }
+}
+
+// Draw the complete navball layer with its top-left corner at (ox, oy)
+static void
+navball_draw_layer(osd_context_t *ctx,
+                   framebuffer_t *fb,
+                   int ox,
+                   int oy,
+                   const navball_frame_t *frame)
+{
+  navball_draw_sphere(ctx, fb, ox, oy, frame);
 
   // ════════════════════════════════════════════════════════════
   // CENTER INDICATOR OVERLAY
@@ -809,13 +1454,11 @@ navball_render(osd_context_t *ctx, osd_state_t *pb_state)
         = (int)(ctx->navball_size * ctx->navball_center_indicator_scale);
 
       // Center the indicator on the navball
-      int indicator_x
-        = ctx->navball_x + (ctx->navball_size - indicator_size) / 2;
-      int indicator_y
-        = ctx->navball_y + (ctx->navball_size - indicator_size) / 2;
+      int indicator_x = ox + (ctx->navball_size - indicator_size) / 2;
+      int indicator_y = oy + (ctx->navball_size - indicator_size) / 2;
 
       // Rasterize and render the SVG indicator
-      svg_render(&fb, &ctx->navball_center_indicator_svg, indicator_x,
+      svg_render(fb, &ctx->navball_center_indicator_svg, indicator_x,
                  indicator_y, indicator_size, indicator_size);
     }
 
@@ -827,111 +1470,20 @@ navball_render(osd_context_t *ctx, osd_state_t *pb_state)
   // astronomical calculations. Shows celestial body positions relative to
   // the platform's orientation.
 
-  if (ctx->celestial_enabled && pb_state->has_actual_space_time)
+  if (frame->sun_visible)
     {
-      // Extract GPS location and timestamp from protobuf
-      observer_location_t observer;
-      observer.latitude  = pb_state->actual_space_time.latitude;
-      observer.longitude = pb_state->actual_space_time.longitude;
-      observer.altitude  = pb_state->actual_space_time.altitude;
-
-      int64_t timestamp = pb_state->actual_space_time.timestamp;
-
-      // Calculate sun and moon positions
-      celestial_positions_t positions
-        = celestial_calculate(timestamp, observer);
-
-      // Get platform orientation for coordinate transformation
-      double platform_azimuth   = pb_state->actual_space_time.azimuth;
-      double platform_elevation = pb_state->actual_space_time.elevation;
-      double platform_bank      = pb_state->actual_space_time.bank;
-
-      // Calculate navball geometry
-      int navball_center_x = ctx->navball_x + ctx->navball_size / 2;
-      int navball_center_y = ctx->navball_y + ctx->navball_size / 2;
-      int navball_radius   = ctx->navball_size / 2;
-
-      // Default indicator size (52% of navball size for better visibility)
-      int indicator_size
-        = (int)(ctx->navball_size * 0.52f * ctx->celestial_indicator_scale);
-
-      // ──────────────────────────────────────────────────────────
-      // RENDER SUN INDICATOR
-      // ──────────────────────────────────────────────────────────
-
-      if (ctx->celestial_show_sun && positions.sun.valid)
-        {
-          // Check visibility threshold (e.g., only show if above -5°)
-          if (positions.sun.altitude >= ctx->celestial_visibility_threshold)
-            {
-              // Convert celestial coordinates to navball screen position
-              int sun_x, sun_y;
-              bool is_front = celestial_to_navball_coords(
-                positions.sun.azimuth, positions.sun.altitude, platform_azimuth,
-                platform_elevation, platform_bank, navball_center_x,
-                navball_center_y, navball_radius, &sun_x, &sun_y);
-
-              // Select appropriate SVG based on visibility
-              svg_resource_t *sun_svg = is_front ? &ctx->celestial_sun_front_svg
-                                                 : &ctx->celestial_sun_back_svg;
-
-              // Behind indicators: smaller size (70%) and reduced opacity (50%)
-              int render_size
-                = is_front ? indicator_size : (int)(indicator_size * 0.7f);
-              float render_alpha = is_front ? 1.0f : 0.5f;
-
-              // Render sun indicator centered at calculated position
-              if (sun_svg->image)
-                {
-                  int sun_render_x = sun_x - render_size / 2;
-                  int sun_render_y = sun_y - render_size / 2;
-
-                  svg_render_with_alpha(&fb, sun_svg, sun_render_x,
-                                        sun_render_y, render_size, render_size,
-                                        render_alpha);
-                }
-            }
-        }
-
-      // ──────────────────────────────────────────────────────────
-      // RENDER MOON INDICATOR
-      // ──────────────────────────────────────────────────────────
-
-      if (ctx->celestial_show_moon && positions.moon.valid)
-        {
-          // Check visibility threshold
-          if (positions.moon.altitude >= ctx->celestial_visibility_threshold)
-            {
-              // Convert celestial coordinates to navball screen position
-              int moon_x, moon_y;
-              bool is_front = celestial_to_navball_coords(
-                positions.moon.azimuth, positions.moon.altitude,
-                platform_azimuth, platform_elevation, platform_bank,
-                navball_center_x, navball_center_y, navball_radius, &moon_x,
-                &moon_y);
-
-              // Select appropriate SVG based on visibility
-              svg_resource_t *moon_svg = is_front
-                                           ? &ctx->celestial_moon_front_svg
-                                           : &ctx->celestial_moon_back_svg;
-
-              // Behind indicators: smaller size (70%) and reduced opacity (50%)
-              int render_size
-                = is_front ? indicator_size : (int)(indicator_size * 0.7f);
-              float render_alpha = is_front ? 1.0f : 0.5f;
-
-              // Render moon indicator centered at calculated position
-              if (moon_svg->image)
-                {
-                  int moon_render_x = moon_x - render_size / 2;
-                  int moon_render_y = moon_y - render_size / 2;
+      navball_draw_celestial_body(ctx, fb, ox, oy, frame,
+                                  &frame->positions.sun,
+                                  &ctx->celestial_sun_front_svg,
+                                  &ctx->celestial_sun_back_svg);
+    }
 
-                  svg_render_with_alpha(&fb, moon_svg, moon_render_x,
-                                        moon_render_y, render_size, render_size,
-                                        render_alpha);
-                }
-            }
-        }
+  if (frame->moon_visible)
+    {
+      navball_draw_celestial_body(ctx, fb, ox, oy, frame,
+                                  &frame->positions.moon,
+                                  &ctx->celestial_moon_front_svg,
+                                  &ctx->celestial_moon_back_svg);
     }
 
   // ════════════════════════════════════════════════════════════
@@ -943,14 +1495,15 @@ navball_render(osd_context_t *ctx, osd_state_t *pb_state)
 
   if (ctx->navball_show_level_marker)
     {
-      int center_y          = ctx->navball_y + ctx->navball_size / 2;
+      navball_lut_t *lut    = (navball_lut_t *)ctx->navball_lut;
+      int center_y          = oy + ctx->navball_size / 2;
       int line_length       = ctx->navball_size;
       uint32_t marker_color = 0xFFFFFFFF; // White with full alpha
 
       // Draw horizontal line across navball center
       for (int x = 0; x < line_length; x++)
         {
-          int screen_x = ctx->navball_x + x;
+          int screen_x = ox + x;
 
           // Only draw if pixel is inside the circle (check LUT validity)
           int lut_x = x;
@@ -959,14 +1512,136 @@ navball_render(osd_context_t *ctx, osd_state_t *pb_state)
 
           if (idx >= 0 && idx < lut->total_pixels && lut->entries[idx].valid)
             {
-              framebuffer_blend_pixel(&fb, screen_x, center_y, marker_color);
+              framebuffer_blend_pixel(fb, screen_x, center_y, marker_color);
             }
         }
     }
+}
+
+bool
+navball_render(osd_context_t *ctx, osd_state_t *pb_state)
+{
+  // Guard clauses: verify navball is initialized and ready to render
+  if (!ctx || !ctx->navball_enabled || !ctx->navball_texture
+      || !ctx->navball_lut)
+    {
+      return false;
+    }
 
+  navball_frame_t frame;
+  memset(&frame, 0, sizeof(frame));
+
+  if (pb_state->has_actual_space_time)
+    {
+      frame.has_orientation = true;
+      frame.azimuth         = pb_state->actual_space_time.azimuth;
+      frame.elevation       = pb_state->actual_space_time.elevation;
+      frame.bank            = pb_state->actual_space_time.bank;
+    }
+
+  // Sun and moon positions are part of the cache key, so they are resolved
+  // before deciding whether the cached layer can be reused
+  if (ctx->celestial_enabled && pb_state->has_actual_space_time)
+    {
+      // Extract GPS location and timestamp from protobuf
+      observer_location_t observer;
+      observer.latitude  = pb_state->actual_space_time.latitude;
+      observer.longitude = pb_state->actual_space_time.longitude;
+      observer.altitude  = pb_state->actual_space_time.altitude;
+
+      int64_t timestamp = pb_state->actual_space_time.timestamp;
+
+      // Calculate sun and moon positions (interpolated between ephemeris
+      // samples when the cache is enabled)
+      frame.positions = celestial_cache_get(
+        (celestial_cache_t *)ctx->celestial_cache, timestamp, observer);
+
+      // Check visibility threshold (e.g., only show if above -5°)
+      frame.sun_visible
+        = ctx->celestial_show_sun && frame.positions.sun.valid
+          && frame.positions.sun.altitude
+               >= ctx->celestial_visibility_threshold;
+      frame.moon_visible
+        = ctx->celestial_show_moon && frame.positions.moon.valid
+          && frame.positions.moon.altitude
+               >= ctx->celestial_visibility_threshold;
+    }
+
+  framebuffer_t fb;
+  framebuffer_init(&fb, ctx->framebuffer, ctx->width, ctx->height);
+
+  navball_cache_t *cache = (navball_cache_t *)ctx->navball_cache;
+  if (!cache)
+    {
+      // Cache disabled (epsilon 0) or unavailable: draw straight to screen
+      navball_draw_layer(ctx, &fb, ctx->navball_x, ctx->navball_y, &frame);
+      return true;
+    }
+
+  float epsilon = ctx->navball_cache_epsilon;
+  navball_cache_key_t key;
+  memset(&key, 0, sizeof(key));
+
+  key.skin            = (int32_t)ctx->navball_skin;
+  key.size            = ctx->navball_size;
+  key.quality         = ctx->quality & NAVBALL_QUALITY_BITS;
+  key.has_orientation = frame.has_orientation;
+  key.azimuth_q       = navball_quantize(frame.azimuth, epsilon);
+  key.elevation_q     = navball_quantize(frame.elevation, epsilon);
+  key.bank_q          = navball_quantize(frame.bank, epsilon);
+  key.sun_visible     = frame.sun_visible;
+  key.moon_visible    = frame.moon_visible;
+
+  if (frame.sun_visible)
+    {
+      key.sun_azimuth_q
+        = navball_quantize(frame.positions.sun.azimuth, epsilon);
+      key.sun_altitude_q
+        = navball_quantize(frame.positions.sun.altitude, epsilon);
+    }
+
+  if (frame.moon_visible)
+    {
+      key.moon_azimuth_q
+        = navball_quantize(frame.positions.moon.azimuth, epsilon);
+      key.moon_altitude_q
+        = navball_quantize(frame.positions.moon.altitude, epsilon);
+    }
+
+  if (cache->valid && memcmp(&cache->key, &key, sizeof(key)) == 0)
+    {
+      ctx->navball_cache_hits++;
+    }
+  else
+    {
+      ctx->navball_cache_misses++;
+
+      // Re-render the layer offscreen, on a transparent background
+      framebuffer_t layer;
+      framebuffer_init(&layer, cache->pixels, cache->width, cache->height);
+      framebuffer_clear(&layer, 0x00000000);
+      navball_draw_layer(ctx, &layer, cache->margin, cache->margin, &frame);
+
+      cache->key   = key;
+      cache->valid = true;
+    }
+
+  navball_cache_blit(cache, &fb, ctx->navball_x - cache->margin,
+                     ctx->navball_y - cache->margin);
   return true;
 }
 
+void
+navball_get_cache_stats(const osd_context_t *ctx,
+                        uint32_t *hits,
+                        uint32_t *misses)
+{
+  if (hits)
+    *hits = ctx ? ctx->navball_cache_hits : 0;
+  if (misses)
+    *misses = ctx ? ctx->navball_cache_misses : 0;
+}
+
 void
 navball_cleanup(osd_context_t *ctx)
 {
@@ -987,6 +1662,21 @@ navball_cleanup(osd_context_t *ctx)
       ctx->navball_lut = NULL;
     }
 
+  // Free render cache
+  if (ctx->navball_cache)
+    {
+      navball_cache_free((navball_cache_t *)ctx->navball_cache);
+      ctx->navball_cache = NULL;
+    }
+
+  // Free ephemeris cache and table
+  if (ctx->celestial_cache)
+    {
+      celestial_cache_free((celestial_cache_t *)ctx->celestial_cache);
+      ctx->celestial_cache = NULL;
+    }
+  celestial_cleanup();
+
   // Free center indicator SVG
   svg_free(&ctx->navball_center_indicator_svg);
 
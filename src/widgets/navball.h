@@ -15,6 +15,7 @@
 #include "core/osd_context.h" // osd_context_t, navball_config_t, navball_skin_t
 
 #include <stdbool.h>
+#include <stdint.h>
 
 // Forward declare state type (implementation uses osd_state.h accessors)
 typedef struct _ser_JonGUIState osd_state_t;
@@ -32,7 +33,9 @@ typedef struct _ser_JonGUIState osd_state_t;
 //   config: Nav ball configuration from JSON
 //
 // Notes:
-//   - Loads skin PNG from resources/navball_skins/
+//   - Loads the pre-decoded skin blob (<name>.nbskin, built by `make skins`);
+//     dev builds fall back to decoding the PNG
+//   - Prefilters the skin into a mip chain matched to config->size
 //   - Pre-rasterizes level marker SVG
 //   - Allocates temporary rendering buffers
 //
@@ -82,8 +85,25 @@ bool navball_init(osd_context_t *ctx, const navball_config_t *config);
 //   - Level marker is rendered on top (fixed orientation)
 //   - Uses alpha blending for anti-aliasing
 //   - Nav ball rotation: pitch=elevation, yaw=azimuth, roll=bank
+//   - When navball.cache_epsilon > 0 the finished layer is cached and reused
+//     while the quantized orientation, skin, size and sun/moon positions
+//     are unchanged
 bool navball_render(osd_context_t *ctx, osd_state_t *pb_state);
 
+// Get nav ball render cache counters
+//
+// Counts frames served from the cached layer (hits) versus frames that
+// re-rendered the sphere (misses) since navball_init(). Use to tune
+// navball.cache_epsilon.
+//
+// Parameters:
+//   ctx:    OSD context
+//   hits:   Output: cache hits (may be NULL)
+//   misses: Output: cache misses (may be NULL)
+void navball_get_cache_stats(const osd_context_t *ctx,
+                             uint32_t *hits,
+                             uint32_t *misses);
+
 // Cleanup nav ball resources
 //
 // Frees allocated textures and rendering buffers.
@@ -2,13 +2,16 @@
  * @file sam_mask.c
  * @brief SAM visual tracking overlay widget
  *
- * Renders bounding box, centroid marker, and state indicator for tracked
+ * Renders bounding box, centroid marker, state indicator and segmentation
+ * mask (translucent fill or outline, see sam_mask.render_mode) for tracked
  * objects. Tracking data comes from SamTrackingDay/Heat opaque payloads. Only
  * renders when status == SAM_TRACKING_STATUS_OK (1) and state == TRACKING.
  */
 
 #include "widgets/sam_mask.h"
 
+#include "jon_shared_data.pb.h"
+
 #include "core/framebuffer.h"
 #include "core/osd_context.h"
 #include "osd_state.h"
@@ -18,6 +21,7 @@
 #include "utils/logging.h"
 
 #include <stdio.h>
+#include <string.h>
 
 // State colors (internal 0xAABBGGRR format)
 #define SAM_COLOR_TRACKING 0xFF00FF00 // Green - normal tracking
@@ -25,6 +29,23 @@
 #define SAM_COLOR_STARTING 0xFFFFFF00 // Cyan - starting up
 #define SAM_COLOR_LOST 0xFF0000FF     // Red - lost
 
+// Mask overlay as horizontal spans of set cells, one mask row each
+typedef struct
+{
+  uint16_t row; // Mask row
+  uint16_t x0;  // First set column
+  uint16_t x1;  // One past the last set column
+} sam_mask_span_t;
+
+// Adjacent runs are merged, so a row holds at most width / 2 spans
+#define SAM_MASK_MAX_SPANS (OSD_SAM_MASK_SIZE / 2)
+
+static sam_mask_span_t s_spans[SAM_MASK_MAX_SPANS];
+static uint32_t s_span_count = 0;
+static bool s_spans_valid    = false; // s_spans describes s_rle_hash's mask
+static uint64_t s_rle_hash   = 0;
+static bool s_mask_current   = false; // RLE checked since the last payload
+
 /**
  * Get color for tracking state
  */
@@ -52,28 +73,49 @@ get_state_color(int state, const sam_mask_config_t *config)
     }
 }
 
+// FNV-1a over the RLE bytes and mask dimensions
+static uint64_t
+hash_mask_rle(const uint8_t *rle_data,
+              size_t rle_len,
+              uint32_t width,
+              uint32_t height)
+{
+  uint64_t h = UINT64_C(0xcbf29ce484222325);
+  for (size_t i = 0; i < rle_len; i++)
+    {
+      h ^= rle_data[i];
+      h *= UINT64_C(0x100000001b3);
+    }
+  h ^= ((uint64_t)width << 32) | height;
+  h *= UINT64_C(0x100000001b3);
+  return h;
+}
+
 /**
- * Decode RLE mask data.
+ * Convert RLE mask data to spans of set cells.
  * Format: [run_length:u16, value:u8]... (little-endian)
  *
+ * Runs are walked directly (no expanded mask buffer). Non-zero runs are
+ * split at row ends and merged with a preceding span they touch.
+ *
  * @param rle_data Raw RLE bytes
  * @param rle_len Length of RLE data
- * @param out_data Output buffer (must be width * height bytes)
  * @param width Mask width
  * @param height Mask height
- * @return true on success
+ * @return true if the runs cover the whole mask
  */
 static bool
-decode_rle_mask(const uint8_t *rle_data,
-                size_t rle_len,
-                uint8_t *out_data,
-                uint32_t width,
-                uint32_t height)
+build_mask_spans(const uint8_t *rle_data,
+                 size_t rle_len,
+                 uint32_t width,
+                 uint32_t height)
 {
   size_t total_pixels = (size_t)width * height;
   size_t pixel_idx    = 0;
   size_t rle_idx      = 0;
 
+  s_span_count = 0;
+
   while (rle_idx + 2 < rle_len && pixel_idx < total_pixels)
     {
       // Read run_length (u16 little-endian)
@@ -84,24 +126,48 @@ decode_rle_mask(const uint8_t *rle_data,
       // Read value (u8)
       uint8_t value = rle_data[rle_idx++];
 
-      // Write run
       size_t end = pixel_idx + run_length;
       if (end > total_pixels)
         {
           end = total_pixels;
         }
 
-      while (pixel_idx < end)
+      // Emit one span per mask row the run touches
+      while (value != 0 && pixel_idx < end)
         {
-          out_data[pixel_idx++] = value;
+          uint32_t row     = (uint32_t)(pixel_idx / width);
+          size_t row_start = (size_t)row * width;
+          size_t span_end  = end < row_start + width ? end : row_start + width;
+          uint16_t x0      = (uint16_t)(pixel_idx - row_start);
+          uint16_t x1      = (uint16_t)(span_end - row_start);
+
+          sam_mask_span_t *last
+            = s_span_count > 0 ? &s_spans[s_span_count - 1] : NULL;
+          if (last && last->row == row && last->x1 == x0)
+            {
+              last->x1 = x1;
+            }
+          else
+            {
+              if (s_span_count == SAM_MASK_MAX_SPANS)
+                {
+                  return false;
+                }
+              s_spans[s_span_count++]
+                = (sam_mask_span_t){ (uint16_t)row, x0, x1 };
+            }
+
+          pixel_idx = span_end;
         }
+
+      pixel_idx = end;
     }
 
   return pixel_idx == total_pixels;
 }
 
 /**
- * Render binary mask as semi-transparent overlay.
+ * Render mask spans as semi-transparent overlay.
  *
  * The SAM 256x256 mask represents a 512x512 CENTER CROP from the full frame,
  * NOT the full frame. The crop is centered at ((width-512)/2, (height-512)/2).
@@ -111,55 +177,456 @@ decode_rle_mask(const uint8_t *rle_data,
  *   Scale: 2x (mask to crop)
  *   Offset: (704, 284) for 1920x1080
  *
+ * Each span is scaled to a frame span and blended once per frame row its
+ * mask row covers.
+ *
  * @param fb        Framebuffer to render to
- * @param mask      Binary mask data (256x256)
  * @param mask_w    Mask width
- * @param mask_h    Mask height
  * @param color     Mask color (AABBGGRR)
  * @param alpha     Mask alpha (0-255)
  */
 static void
-render_mask_overlay(framebuffer_t *fb,
-                    const uint8_t *mask,
-                    uint32_t mask_w,
-                    uint32_t mask_h,
-                    uint32_t color,
-                    uint8_t alpha)
+render_mask_spans(framebuffer_t *fb,
+                  uint32_t mask_w,
+                  uint32_t color,
+                  uint8_t alpha)
 {
   // SAM uses 512x512 center crop from input frame
   const int crop_size = 512;
   int crop_x          = ((int)fb->width - crop_size) / 2;  // 704 for 1920
   int crop_y          = ((int)fb->height - crop_size) / 2; // 284 for 1080
-
-  // Scale factor: mask (256) → crop (512) = 2.0
-  float scale = (float)crop_size / (float)mask_w;
+  int scale_div       = (int)mask_w; // mask (256) → crop (512) = 2x
 
   // Blend color with alpha
   uint32_t blend_color = (color & 0x00FFFFFF) | ((uint32_t)alpha << 24);
 
-  for (uint32_t my = 0; my < mask_h; my++)
+  for (uint32_t i = 0; i < s_span_count; i++)
     {
-      for (uint32_t mx = 0; mx < mask_w; mx++)
+      const sam_mask_span_t *span = &s_spans[i];
+
+      // Scale mask coords to crop space, then offset to frame space
+      int sx     = crop_x + span->x0 * crop_size / scale_div;
+      int sx_end = crop_x + span->x1 * crop_size / scale_div;
+      int sy     = crop_y + span->row * crop_size / scale_div;
+      int sy_end = crop_y + (span->row + 1) * crop_size / scale_div;
+
+      // Replicate the span over the rows this mask row scales to
+      for (int py = sy; py < sy_end; py++)
         {
-          if (mask[my * mask_w + mx])
+          framebuffer_blend_span(fb, sx, py, sx_end - sx, blend_color);
+        }
+    }
+}
+
+// ════════════════════════════════════════════════════════════
+// CONTOUR MODE
+// ════════════════════════════════════════════════════════════
+//
+// The mask outline is extracted with marching squares over the mask
+// samples (cells outside the mask count as unset, so every loop closes).
+// Loops are traced cell to cell, collinear points dropped, optionally
+// simplified with Douglas-Peucker, and cached until the mask changes.
+//
+// Contour points are in half mask-pixel units: an edge midpoint between
+// two samples falls on a pixel boundary or a pixel center.
+
+// Marching squares cell edges
+#define MS_T 0 // Between top-left and top-right samples
+#define MS_R 1
+#define MS_B 2
+#define MS_L 3
+#define MS_NONE -1
+
+// Oriented segments per cell case (TL=8, TR=4, BR=2, BL=1), {from, to}
+// with the mask on the left. Saddles (5, 10) keep the corners separate.
+static const int8_t g_ms_segments[16][2][2] = {
+  /*  0 */ { { MS_NONE, MS_NONE }, { MS_NONE, MS_NONE } },
+  /*  1 */ { { MS_B, MS_L }, { MS_NONE, MS_NONE } },
+  /*  2 */ { { MS_R, MS_B }, { MS_NONE, MS_NONE } },
+  /*  3 */ { { MS_R, MS_L }, { MS_NONE, MS_NONE } },
+  /*  4 */ { { MS_T, MS_R }, { MS_NONE, MS_NONE } },
+  /*  5 */ { { MS_T, MS_R }, { MS_B, MS_L } },
+  /*  6 */ { { MS_T, MS_B }, { MS_NONE, MS_NONE } },
+  /*  7 */ { { MS_T, MS_L }, { MS_NONE, MS_NONE } },
+  /*  8 */ { { MS_L, MS_T }, { MS_NONE, MS_NONE } },
+  /*  9 */ { { MS_B, MS_T }, { MS_NONE, MS_NONE } },
+  /* 10 */ { { MS_L, MS_T }, { MS_R, MS_B } },
+  /* 11 */ { { MS_R, MS_T }, { MS_NONE, MS_NONE } },
+  /* 12 */ { { MS_L, MS_R }, { MS_NONE, MS_NONE } },
+  /* 13 */ { { MS_B, MS_R }, { MS_NONE, MS_NONE } },
+  /* 14 */ { { MS_L, MS_B }, { MS_NONE, MS_NONE } },
+  /* 15 */ { { MS_NONE, MS_NONE }, { MS_NONE, MS_NONE } },
+};
+
+// Neighbor cell across each edge
+static const int8_t g_ms_step_x[4] = { 0, 1, 0, -1 };
+static const int8_t g_ms_step_y[4] = { -1, 0, 1, 0 };
+
+// Upper bounds for the cached outline; busier masks fall back to the fill
+#define SAM_CONTOUR_MAX_POINTS 16384
+#define SAM_CONTOUR_MAX_LOOPS 1024
+
+typedef struct
+{
+  int16_t x, y; // Half mask-pixel units
+} sam_contour_point_t;
+
+typedef struct
+{
+  uint32_t start; // First point in s_contour_points
+  uint32_t count;
+} sam_contour_loop_t;
+
+// Mask as a bitmap (one bit per sample) for the marching squares lookups
+#define SAM_MASK_ROW_WORDS (OSD_SAM_MASK_WIDTH / 32)
+static uint32_t s_mask_bits[OSD_SAM_MASK_HEIGHT][SAM_MASK_ROW_WORDS];
+static uint32_t s_mask_w = 0;
+static uint32_t s_mask_h = 0;
+
+// Per cell: bit n set once segment n has been traced. Cells run from -1 to
+// width-1 / height-1 so the mask border is covered.
+#define SAM_MASK_CELLS ((OSD_SAM_MASK_WIDTH + 1) * (OSD_SAM_MASK_HEIGHT + 1))
+static uint8_t s_cell_traced[SAM_MASK_CELLS];
+
+static sam_contour_point_t s_contour_points[SAM_CONTOUR_MAX_POINTS];
+static sam_contour_loop_t s_contour_loops[SAM_CONTOUR_MAX_LOOPS];
+static uint32_t s_contour_point_count = 0;
+static uint32_t s_contour_loop_count  = 0;
+static bool s_contour_built = false; // Outline matches the current spans
+static bool s_contour_valid = false; // Outline fit the limits above
+
+// Douglas-Peucker scratch (keep flags and pending ranges)
+static uint8_t s_dp_keep[SAM_CONTOUR_MAX_POINTS];
+static uint32_t s_dp_stack[SAM_CONTOUR_MAX_POINTS][2];
+
+static inline int
+mask_sample(int x, int y)
+{
+  if (x < 0 || y < 0 || x >= (int)s_mask_w || y >= (int)s_mask_h)
+    {
+      return 0;
+    }
+  return (s_mask_bits[y][x >> 5] >> (x & 31)) & 1;
+}
+
+static inline int
+cell_case(int cx, int cy)
+{
+  return (mask_sample(cx, cy) << 3) | (mask_sample(cx + 1, cy) << 2)
+         | (mask_sample(cx + 1, cy + 1) << 1) | mask_sample(cx, cy + 1);
+}
+
+static inline uint8_t *
+cell_traced(int cx, int cy)
+{
+  return &s_cell_traced[(size_t)(cy + 1) * (s_mask_w + 1) + (size_t)(cx + 1)];
+}
+
+// Edge midpoint of cell (cx, cy) in half mask-pixel units
+static const int8_t g_ms_mid_x[4] = { 2, 3, 2, 1 };
+static const int8_t g_ms_mid_y[4] = { 1, 2, 3, 2 };
+
+static inline sam_contour_point_t
+edge_point(int cx, int cy, int edge)
+{
+  return (sam_contour_point_t){ (int16_t)(2 * cx + g_ms_mid_x[edge]),
+                                (int16_t)(2 * cy + g_ms_mid_y[edge]) };
+}
+
+// Append a point to the current loop, merging straight runs
+static bool
+contour_append(uint32_t loop_start, sam_contour_point_t p)
+{
+  uint32_t n = s_contour_point_count - loop_start;
+  if (n >= 2)
+    {
+      sam_contour_point_t a = s_contour_points[s_contour_point_count - 2];
+      sam_contour_point_t b = s_contour_points[s_contour_point_count - 1];
+      int dx1 = b.x - a.x, dy1 = b.y - a.y;
+      int dx2 = p.x - b.x, dy2 = p.y - b.y;
+
+      if (dx1 * dy2 == dy1 * dx2 && dx1 * dx2 + dy1 * dy2 > 0)
+        {
+          s_contour_points[s_contour_point_count - 1] = p;
+          return true;
+        }
+    }
+
+  if (s_contour_point_count == SAM_CONTOUR_MAX_POINTS)
+    {
+      return false;
+    }
+  s_contour_points[s_contour_point_count++] = p;
+  return true;
+}
+
+/**
+ * Trace one closed loop starting at segment seg of cell (cx, cy)
+ *
+ * Emits the exit point of every segment along the loop.
+ *
+ * @return false if the point limit was hit
+ */
+static bool
+trace_contour_loop(int cx, int cy, int seg)
+{
+  uint32_t start = s_contour_point_count;
+  int x = cx, y = cy, s = seg;
+
+  do
+    {
+      int out = g_ms_segments[cell_case(x, y)][s][1];
+      *cell_traced(x, y) |= (uint8_t)(1u << s);
+
+      if (!contour_append(start, edge_point(x, y, out)))
+        {
+          return false;
+        }
+
+      // Enter the neighbor through the shared edge
+      x += g_ms_step_x[out];
+      y += g_ms_step_y[out];
+      int in = (out + 2) & 3;
+      s      = g_ms_segments[cell_case(x, y)][0][0] == in ? 0 : 1;
+    }
+  while (x != cx || y != cy || s != seg);
+
+  if (s_contour_loop_count == SAM_CONTOUR_MAX_LOOPS)
+    {
+      return false;
+    }
+  s_contour_loops[s_contour_loop_count++]
+    = (sam_contour_loop_t){ start, s_contour_point_count - start };
+  return true;
+}
+
+// Squared distance (scaled by |ab|^2) from p to the line through a and b
+static int64_t
+line_distance_sq_scaled(sam_contour_point_t p,
+                        sam_contour_point_t a,
+                        sam_contour_point_t b)
+{
+  int64_t dx    = b.x - a.x;
+  int64_t dy    = b.y - a.y;
+  int64_t cross = dx * (p.y - a.y) - dy * (p.x - a.x);
+  if (dx == 0 && dy == 0)
+    {
+      int64_t px = p.x - a.x, py = p.y - a.y;
+      return px * px + py * py;
+    }
+  return cross * cross;
+}
+
+/**
+ * Simplify one closed loop in place with Douglas-Peucker
+ *
+ * @param loop      Loop to simplify
+ * @param tolerance Maximum deviation in half mask-pixel units
+ */
+static void
+simplify_contour_loop(sam_contour_loop_t *loop, float tolerance)
+{
+  sam_contour_point_t *pts = &s_contour_points[loop->start];
+  uint32_t n               = loop->count;
+  if (n < 4)
+    {
+      return;
+    }
+
+  // Split the loop at point 0 and the point farthest from it
+  uint32_t far    = 0;
+  int64_t far_dsq = -1;
+  for (uint32_t i = 1; i < n; i++)
+    {
+      int64_t dx = pts[i].x - pts[0].x, dy = pts[i].y - pts[0].y;
+      if (dx * dx + dy * dy > far_dsq)
+        {
+          far_dsq = dx * dx + dy * dy;
+          far     = i;
+        }
+    }
+
+  memset(s_dp_keep, 0, n);
+  s_dp_keep[0]   = 1;
+  s_dp_keep[far] = 1;
+
+  // Ranges are [a, b] with b == n meaning point 0 again
+  uint32_t top       = 0;
+  s_dp_stack[top][0] = 0;
+  s_dp_stack[top][1] = far;
+  top++;
+  s_dp_stack[top][0] = far;
+  s_dp_stack[top][1] = n;
+  top++;
+
+  double tol_sq = (double)tolerance * tolerance;
+  while (top > 0)
+    {
+      top--;
+      uint32_t a = s_dp_stack[top][0];
+      uint32_t b = s_dp_stack[top][1];
+      if (b - a < 2)
+        {
+          continue;
+        }
+
+      sam_contour_point_t pa = pts[a];
+      sam_contour_point_t pb = pts[b % n];
+      int64_t dx = pb.x - pa.x, dy = pb.y - pa.y;
+      double len_sq = (double)(dx * dx + dy * dy);
+
+      uint32_t worst    = a;
+      double worst_dist = 0.0;
+      for (uint32_t i = a + 1; i < b; i++)
+        {
+          double d = (double)line_distance_sq_scaled(pts[i], pa, pb);
+          if (len_sq > 0.0)
+            {
+              d /= len_sq;
+            }
+          if (d > worst_dist)
+            {
+              worst_dist = d;
+              worst      = i;
+            }
+        }
+
+      if (worst_dist > tol_sq)
+        {
+          s_dp_keep[worst]   = 1;
+          s_dp_stack[top][0] = a;
+          s_dp_stack[top][1] = worst;
+          top++;
+          s_dp_stack[top][0] = worst;
+          s_dp_stack[top][1] = b;
+          top++;
+        }
+    }
+
+  uint32_t kept = 0;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      if (s_dp_keep[i])
+        {
+          pts[kept++] = pts[i];
+        }
+    }
+  loop->count = kept;
+}
+
+/**
+ * Extract the mask outline from the current spans
+ *
+ * Loops are started only from cells holding a span end: every loop
+ * crosses at least one row transition, so no full-grid scan is needed.
+ *
+ * @param width    Mask width
+ * @param height   Mask height
+ * @param simplify Douglas-Peucker tolerance in mask pixels (0 = off)
+ * @return false if the outline exceeds the point or loop limits
+ */
+static bool
+build_mask_contour(uint32_t width, uint32_t height, float simplify)
+{
+  s_mask_w              = width;
+  s_mask_h              = height;
+  s_contour_point_count = 0;
+  s_contour_loop_count  = 0;
+
+  memset(s_mask_bits, 0, sizeof(s_mask_bits));
+  for (uint32_t i = 0; i < s_span_count; i++)
+    {
+      const sam_mask_span_t *span = &s_spans[i];
+      for (uint32_t x = span->x0; x < span->x1; x++)
+        {
+          s_mask_bits[span->row][x >> 5] |= 1u << (x & 31);
+        }
+    }
+
+  memset(s_cell_traced, 0, (size_t)(width + 1) * (height + 1));
+
+  for (uint32_t i = 0; i < s_span_count; i++)
+    {
+      const sam_mask_span_t *span = &s_spans[i];
+      int cells_x[2]              = { span->x0 - 1, span->x1 - 1 };
+
+      for (int k = 0; k < 2; k++)
+        {
+          int cx    = cells_x[k];
+          int cy    = span->row;
+          int ccase = cell_case(cx, cy);
+
+          for (int seg = 0; seg < 2; seg++)
             {
-              // Scale mask coords to crop space, then offset to frame space
-              int sx     = crop_x + (int)((float)mx * scale);
-              int sy     = crop_y + (int)((float)my * scale);
-              int sx_end = crop_x + (int)((float)(mx + 1) * scale);
-              int sy_end = crop_y + (int)((float)(my + 1) * scale);
-
-              // Draw scaled pixel (fill the scaled region)
-              for (int py = sy; py < sy_end; py++)
+              const int8_t *edges = g_ms_segments[ccase][seg];
+              if (edges[0] == MS_NONE || (*cell_traced(cx, cy) >> seg) & 1)
+                {
+                  continue;
+                }
+              if (edges[0] != MS_T && edges[1] != MS_T)
                 {
-                  for (int px = sx; px < sx_end; px++)
-                    {
-                      framebuffer_blend_pixel(fb, px, py, blend_color);
-                    }
+                  continue;
+                }
+              if (!trace_contour_loop(cx, cy, seg))
+                {
+                  return false;
                 }
             }
         }
     }
+
+  if (simplify > 0.0f)
+    {
+      for (uint32_t i = 0; i < s_contour_loop_count; i++)
+        {
+          simplify_contour_loop(&s_contour_loops[i], simplify * 2.0f);
+        }
+    }
+
+  return true;
+}
+
+/**
+ * Render the cached outline with the thick-line rasterizer
+ *
+ * Uses the same center-crop mapping as render_mask_spans().
+ *
+ * @param fb        Framebuffer to render to
+ * @param mask_w    Mask width
+ * @param color     Outline color (AABBGGRR)
+ * @param thickness Line width in pixels
+ */
+static void
+render_mask_contour(framebuffer_t *fb,
+                    uint32_t mask_w,
+                    uint32_t color,
+                    float thickness)
+{
+  const int crop_size = 512;
+  int crop_x          = ((int)fb->width - crop_size) / 2;
+  int crop_y          = ((int)fb->height - crop_size) / 2;
+  int scale_div       = 2 * (int)mask_w; // Half-pixel units → crop
+
+  for (uint32_t l = 0; l < s_contour_loop_count; l++)
+    {
+      const sam_contour_loop_t *loop = &s_contour_loops[l];
+      const sam_contour_point_t *pts = &s_contour_points[loop->start];
+      if (loop->count < 2)
+        {
+          continue;
+        }
+
+      sam_contour_point_t prev = pts[loop->count - 1];
+      for (uint32_t i = 0; i < loop->count; i++)
+        {
+          draw_line(fb, crop_x + prev.x * crop_size / scale_div,
+                    crop_y + prev.y * crop_size / scale_div,
+                    crop_x + pts[i].x * crop_size / scale_div,
+                    crop_y + pts[i].y * crop_size / scale_div, color,
+                    thickness);
+          prev = pts[i];
+        }
+    }
 }
 
 /**
@@ -195,6 +662,13 @@ sam_mask_render(osd_context_t *ctx, const osd_state_t *state)
       return false;
     }
 
+  // New payload data may carry a new mask
+  if (osd_ctx_state_changed(
+        ctx, OSD_STATE_FIELD(ser_JonGUIState_opaque_payloads_tag)))
+    {
+      s_mask_current = false;
+    }
+
   osd_sam_tracking_data_t data;
   if (!osd_state_get_sam_tracking(ctx, &data) || !data.valid)
     {
@@ -246,14 +720,43 @@ sam_mask_render(osd_context_t *ctx, const osd_state_t *state)
       && data.mask_width <= OSD_SAM_MASK_WIDTH
       && data.mask_height <= OSD_SAM_MASK_HEIGHT)
     {
-      // Decode RLE into static buffer
-      if (decode_rle_mask(
+      // Rebuild spans only when the RLE bytes differ from the last mask
+      if (!s_mask_current)
+        {
+          uint64_t hash = hash_mask_rle(
             ctx->sam_tracking.mask_rle, ctx->sam_tracking.mask_rle_len,
-            ctx->sam_tracking.mask_data, data.mask_width, data.mask_height))
+            data.mask_width, data.mask_height);
+          if (hash != s_rle_hash || !s_spans_valid)
+            {
+              s_spans_valid = build_mask_spans(
+                ctx->sam_tracking.mask_rle, ctx->sam_tracking.mask_rle_len,
+                data.mask_width, data.mask_height);
+              s_rle_hash      = hash;
+              s_contour_built = false;
+            }
+          s_mask_current = true;
+        }
+
+      // Outline is extracted once per mask, on first use; the frame-budget
+      // governor may ask for it in place of the fill
+      bool contour = c->render_mode == SAM_MASK_RENDER_CONTOUR
+                     || (ctx->quality & OSD_QUALITY_SAM_CONTOUR);
+      if (contour && s_spans_valid && !s_contour_built)
+        {
+          s_contour_valid = build_mask_contour(
+            data.mask_width, data.mask_height, c->contour_simplify);
+          s_contour_built = true;
+        }
+
+      if (contour && s_spans_valid && s_contour_valid)
+        {
+          render_mask_contour(&fb, data.mask_width, color,
+                              c->contour_thickness);
+        }
+      else if (s_spans_valid)
         {
-          // Render mask at full frame scale (mask is 256x256 for full frame)
-          render_mask_overlay(&fb, ctx->sam_tracking.mask_data, data.mask_width,
-                              data.mask_height, color, c->mask_alpha);
+          // Fill mode, or an outline too complex for the contour limits
+          render_mask_spans(&fb, data.mask_width, color, c->mask_alpha);
         }
     }
 
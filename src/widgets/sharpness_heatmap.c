@@ -121,3 +121,31 @@ sharpness_heatmap_render(osd_context_t *ctx, const osd_state_t *state)
 
   return true;
 }
+
+framebuffer_rect_t
+sharpness_heatmap_extent(const osd_context_t *ctx)
+{
+  int cell_size       = ctx->config.sharpness_heatmap.cell_size;
+  int grid_px         = HEATMAP_GRID_SIZE * cell_size;
+  int x0              = ctx->config.sharpness_heatmap.pos_x;
+  int y0              = ctx->config.sharpness_heatmap.pos_y;
+  int label_font_size = ctx->config.sharpness_heatmap.label_font_size;
+
+  // Grid and its 1 px border
+  framebuffer_rect_t r = { x0 - 1, y0 - 1, grid_px + 2, grid_px + 2 };
+  if (!ctx->config.sharpness_heatmap.show_label)
+    {
+      return r;
+    }
+
+  // Label at y0 - label_font_size - 2, with a font size of slack for
+  // glyphs and outline
+  int slack = label_font_size + HEATMAP_OUTLINE_THICKNESS;
+
+  framebuffer_rect_t label;
+  label.x      = x0 - slack;
+  label.y      = y0 - label_font_size - 2 - slack;
+  label.width  = (int)ctx->width - label.x;
+  label.height = label_font_size + 2 * slack;
+  return framebuffer_rect_union(r, label);
+}
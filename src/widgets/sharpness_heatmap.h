@@ -16,4 +16,8 @@ typedef struct _ser_JonGUIState osd_state_t;
 // Returns true if rendered, false if disabled or no data
 bool sharpness_heatmap_render(osd_context_t *ctx, const osd_state_t *state);
 
+// Area sharpness_heatmap_render() can draw in (an upper bound: the label
+// width depends on the score, so its rows reach the right edge)
+framebuffer_rect_t sharpness_heatmap_extent(const osd_context_t *ctx);
+
 #endif // WIDGETS_SHARPNESS_HEATMAP_H
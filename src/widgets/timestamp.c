@@ -42,3 +42,18 @@ timestamp_render(osd_context_t *ctx, osd_state_t *pb_state)
 
   return true;
 }
+
+framebuffer_rect_t
+timestamp_extent(const osd_context_t *ctx)
+{
+  int font_size = ctx->config.timestamp.font_size;
+  int slack     = font_size + TIMESTAMP_OUTLINE_THICKNESS;
+
+  // Glyphs may reach a font size above or below the text position
+  framebuffer_rect_t r;
+  r.x      = ctx->config.timestamp.pos_x - slack;
+  r.y      = ctx->config.timestamp.pos_y - slack;
+  r.width  = (int)ctx->width - r.x;
+  r.height = font_size + 2 * slack;
+  return r;
+}
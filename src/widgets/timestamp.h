@@ -46,4 +46,8 @@ typedef struct _ser_JonGUIState osd_state_t;
 //   - Hidden in live mode (OSD_SHOW_TIMESTAMP = 0)
 bool timestamp_render(osd_context_t *ctx, osd_state_t *pb_state);
 
+// Area timestamp_render() can draw in (an upper bound; the text width
+// depends on the font, so it reaches the right edge of the frame)
+framebuffer_rect_t timestamp_extent(const osd_context_t *ctx);
+
 #endif // WIDGETS_TIMESTAMP_H
@@ -191,13 +191,62 @@ variant_info_init(osd_context_t *ctx)
   LOG_INFO("Variant info widget initialized");
 }
 
+/**
+ * Add the frame age of a state to the delta history
+ *
+ * @param state    Proto state (may be NULL)
+ * @param delta_ms Set to the frame age in ms (positive = frame is older
+ *                 than state)
+ * @return false if the state carries no state or frame time
+ */
+static bool
+record_frame_delta(const osd_state_t *state, double *delta_ms)
+{
+  uint64_t monotonic_us = osd_state_get_monotonic_time_us(state);
+#ifdef OSD_STREAM_THERMAL
+  uint64_t frame_us = osd_state_get_frame_monotonic_heat_us(state);
+#else
+  uint64_t frame_us = osd_state_get_frame_monotonic_day_us(state);
+#endif
+  if (frame_us == 0 || monotonic_us == 0)
+    {
+      return false;
+    }
+
+  int64_t delta_us = (int64_t)monotonic_us - (int64_t)frame_us;
+  *delta_ms        = (double)delta_us / 1000.0;
+  delta_history_add(*delta_ms, monotonic_us);
+  return true;
+}
+
+/**
+ * Record per-state data without drawing
+ *
+ * Called by the widget scheduler for states whose frame reuses the last
+ * drawn layer, so the frame dt statistics still see every state.
+ *
+ * @param ctx   OSD context
+ * @param state Proto state (may be NULL)
+ */
+void
+variant_info_update(osd_context_t *ctx, const osd_state_t *state)
+{
+  double delta_ms;
+
+  if (ctx->config.variant_info.enabled)
+    {
+      record_frame_delta(state, &delta_ms);
+    }
+}
+
 /**
  * Render variant info widget
  *
  * NOTE: When enabled, this widget ALWAYS returns true because it displays
  * the draw counter (frame_count) which changes on every state update.
- * This forces a texture re-upload every frame when variant_info is visible,
- * which is intentional for debugging purposes.
+ * Frames where it is drawn are therefore always re-rendered and uploaded;
+ * with max_rate_hz set, frames reusing its layer can still be skipped
+ * (see widget_scheduler_signature()).
  *
  * @param ctx OSD context
  * @param state Proto state (used for monotonic time)
@@ -265,22 +314,14 @@ variant_info_render(osd_context_t *ctx, const osd_state_t *state)
 
   // Frame timing delta (shows frame age relative to state time)
 #ifdef OSD_STREAM_THERMAL
-  uint64_t frame_us       = osd_state_get_frame_monotonic_heat_us(state);
   const char *frame_label = "Heat Frame dt";
 #else
-  uint64_t frame_us       = osd_state_get_frame_monotonic_day_us(state);
   const char *frame_label = "Day Frame dt";
 #endif
   items[item_count].key = frame_label;
-  if (frame_us > 0 && monotonic_us > 0)
+  double delta_ms;
+  if (record_frame_delta(state, &delta_ms))
     {
-      // Delta in microseconds (positive = frame is older than state)
-      int64_t delta_us = (int64_t)monotonic_us - (int64_t)frame_us;
-      double delta_ms  = (double)delta_us / 1000.0;
-
-      // Add to history for stats
-      delta_history_add(delta_ms, monotonic_us);
-
       // Get stats over last 5 seconds
       double avg_ms, std_ms;
       int sample_count;
@@ -40,6 +40,14 @@ void variant_info_init(osd_context_t *ctx);
 //   true if variant info was rendered, false otherwise
 bool variant_info_render(osd_context_t *ctx, const osd_state_t *state);
 
+// Record per-state data (frame dt statistics) without drawing
+// Used by the widget scheduler on frames that reuse the drawn layer.
+//
+// Parameters:
+//   ctx:   OSD context
+//   state: Telemetry state (may be NULL)
+void variant_info_update(osd_context_t *ctx, const osd_state_t *state);
+
 // Cleanup variant info widget
 //
 // Parameters:
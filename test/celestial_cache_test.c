@@ -0,0 +1,246 @@
+// Accuracy test for the sun/moon ephemeris cache
+//
+// Compares celestial_cache_get() (src/utils/celestial_position.c) with a
+// direct celestial_calculate() at the same instant:
+//   - a contiguous sweep in 7 s steps, which lands on every offset within
+//     a segment, including the segment boundaries
+//   - one second before, at and after every segment boundary
+//   - random instants and observers, which recompute both segment ends
+// for the default 60 s interval and a short one, at several latitudes.
+// Fails if any position is further than TOLERANCE_ARCMIN from the direct
+// one, or if a sweep needed more direct calculations than it has
+// segments.
+//
+// Usage: celestial_cache_test [days]
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils/celestial_position.h"
+#include "utils/logging.h"
+
+// Interpolation error bound stated for the 60 s and shorter intervals
+// (celestial_position.h); dev builds warn above the same error
+#define TOLERANCE_ARCMIN 1.0
+
+#define SWEEP_START 1750464000 // 2025-06-21 00:00:00 UTC
+#define SWEEP_STEP_S 7
+#define RANDOM_SPAN_S (3650LL * 86400)
+#define RANDOM_SAMPLES 20000
+
+static const int INTERVALS[] = { 60, 10 };
+
+static const observer_location_t OBSERVERS[] = {
+  { .latitude = 37.7749, .longitude = -122.4194, .altitude = 0.0 },
+  { .latitude = 0.0, .longitude = 0.0, .altitude = 0.0 },
+  { .latitude = 69.6492, .longitude = 18.9553, .altitude = 100.0 },
+  { .latitude = -33.8688, .longitude = 151.2093, .altitude = 50.0 },
+};
+
+#define COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+static uint64_t g_rng = 0x9e3779b97f4a7c15u;
+
+static uint64_t
+rng_next(void)
+{
+  g_rng ^= g_rng << 13;
+  g_rng ^= g_rng >> 7;
+  g_rng ^= g_rng << 17;
+  return g_rng;
+}
+
+static double
+rng_range(double lo, double hi)
+{
+  return lo + (hi - lo) * (double)(rng_next() >> 11) / 9007199254740992.0;
+}
+
+/* ============================================================
+ * Error measurement
+ * ============================================================ */
+
+typedef struct
+{
+  double max_arcmin;
+  int64_t worst_time;
+  uint32_t samples;
+  uint32_t failures;
+} error_stats_t;
+
+static double
+separation_arcmin(celestial_position_t a, celestial_position_t b)
+{
+  const double rad = M_PI / 180.0;
+  double az1 = a.azimuth * rad, alt1 = a.altitude * rad;
+  double az2 = b.azimuth * rad, alt2 = b.altitude * rad;
+
+  double x1 = cos(alt1) * sin(az1), y1 = sin(alt1), z1 = cos(alt1) * cos(az1);
+  double x2 = cos(alt2) * sin(az2), y2 = sin(alt2), z2 = cos(alt2) * cos(az2);
+
+  double dot = x1 * x2 + y1 * y2 + z1 * z2;
+  double cx = y1 * z2 - z1 * y2;
+  double cy = z1 * x2 - x1 * z2;
+  double cz = x1 * y2 - y1 * x2;
+
+  return atan2(sqrt(cx * cx + cy * cy + cz * cz), dot) / rad * 60.0;
+}
+
+static void
+check_body(error_stats_t *stats,
+           celestial_position_t cached,
+           celestial_position_t direct,
+           int64_t t)
+{
+  if (cached.valid != direct.valid)
+    {
+      stats->failures++;
+      return;
+    }
+  if (!direct.valid)
+    return;
+
+  double error = separation_arcmin(cached, direct);
+  stats->samples++;
+  if (error > stats->max_arcmin)
+    {
+      stats->max_arcmin = error;
+      stats->worst_time = t;
+    }
+  if (error > TOLERANCE_ARCMIN)
+    stats->failures++;
+}
+
+static void
+check(error_stats_t *stats,
+      celestial_cache_t *cache,
+      int64_t t,
+      observer_location_t observer)
+{
+  celestial_positions_t cached = celestial_cache_get(cache, t, observer);
+  celestial_positions_t direct = celestial_calculate(t, observer);
+
+  check_body(stats, cached.sun, direct.sun, t);
+  check_body(stats, cached.moon, direct.moon, t);
+}
+
+// obs < 0: random observers
+static bool
+report(const char *name, int interval, int obs, const error_stats_t *stats)
+{
+  char observer[16] = "random";
+  if (obs >= 0)
+    snprintf(observer, sizeof(observer), "%d", obs);
+
+  printf("  %-9s %3ds observer %-6s: max %.3f' at %lld (%u samples)%s\n",
+         name, interval, observer, stats->max_arcmin,
+         (long long)stats->worst_time, stats->samples,
+         stats->failures ? " FAIL" : "");
+  return stats->failures == 0;
+}
+
+/* ============================================================
+ * Sweeps
+ * ============================================================ */
+
+// Contiguous 7 s steps; the cache slides forward one segment at a time
+static bool
+test_sweep(int interval, int obs, int64_t span_s)
+{
+  celestial_cache_t *cache = celestial_cache_create(interval, 100.0);
+  error_stats_t stats = { 0 };
+
+  for (int64_t t = SWEEP_START; t <= SWEEP_START + span_s; t += SWEEP_STEP_S)
+    check(&stats, cache, t, OBSERVERS[obs]);
+
+  // One direct calculation per segment, plus the first segment's start
+  uint32_t refreshes;
+  celestial_cache_get_stats(cache, &refreshes, NULL);
+  uint32_t segments = (uint32_t)(span_s / interval + 2);
+  celestial_cache_free(cache);
+
+  bool ok = report("sweep", interval, obs, &stats);
+  if (refreshes > segments + 1)
+    {
+      printf("    %u direct calculations for %u segments FAIL\n", refreshes,
+             segments);
+      ok = false;
+    }
+  return ok;
+}
+
+// Either side of and on every segment boundary
+static bool
+test_boundaries(int interval, int obs, int64_t span_s)
+{
+  celestial_cache_t *cache = celestial_cache_create(interval, 100.0);
+  error_stats_t stats = { 0 };
+
+  for (int64_t b = SWEEP_START; b <= SWEEP_START + span_s; b += interval)
+    {
+      check(&stats, cache, b - 1, OBSERVERS[obs]);
+      check(&stats, cache, b, OBSERVERS[obs]);
+      check(&stats, cache, b + 1, OBSERVERS[obs]);
+    }
+
+  celestial_cache_free(cache);
+  return report("boundary", interval, obs, &stats);
+}
+
+// Random instants over ten years and random observers: every query jumps
+// in time or moves the observer, so both segment ends are recomputed
+static bool
+test_random(int interval)
+{
+  celestial_cache_t *cache = celestial_cache_create(interval, 100.0);
+  error_stats_t stats = { 0 };
+
+  for (int i = 0; i < RANDOM_SAMPLES; i++)
+    {
+      observer_location_t observer = {
+        .latitude = rng_range(-80.0, 80.0),
+        .longitude = rng_range(-180.0, 180.0),
+        .altitude = rng_range(0.0, 3000.0),
+      };
+      int64_t t = SWEEP_START - RANDOM_SPAN_S / 2
+                  + (int64_t)(rng_next() % RANDOM_SPAN_S);
+      check(&stats, cache, t, observer);
+    }
+
+  celestial_cache_free(cache);
+  return report("random", interval, -1, &stats);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int days = argc > 1 ? atoi(argv[1]) : 2;
+  int64_t span_s = (int64_t)(days > 0 ? days : 1) * 86400;
+  bool ok = true;
+
+  log_set_level(LOG_LEVEL_WARN);
+  if (!celestial_init())
+    {
+      fprintf(stderr, "error: celestial_init failed\n");
+      return 1;
+    }
+
+  printf("Ephemeris cache vs direct calculation (tolerance %.1f'):\n",
+         TOLERANCE_ARCMIN);
+  for (size_t i = 0; i < COUNT(INTERVALS); i++)
+    {
+      for (size_t o = 0; o < COUNT(OBSERVERS); o++)
+        {
+          ok &= test_sweep(INTERVALS[i], (int)o, span_s);
+          ok &= test_boundaries(INTERVALS[i], (int)o, span_s);
+        }
+      ok &= test_random(INTERVALS[i]);
+    }
+
+  celestial_cleanup();
+  printf(ok ? "PASS\n" : "FAIL\n");
+  return ok ? 0 : 1;
+}
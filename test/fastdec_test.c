@@ -0,0 +1,595 @@
+// Equivalence fuzzer and benchmark for the generated decoders
+//
+// Checks that src/proto/pb_fastdec.c (tools/gen_fastdec.py) accepts and
+// rejects the same inputs as nanopb's pb_decode() and produces identical
+// structs and callback invocations:
+//   - test/proto_snapshot.bin and synthetic states with every field set
+//   - byte-level mutations of those (flips, truncation, insertion)
+//   - masked decoding against the plugin's old scan-and-run reference
+//   - the opaque payload messages the plugin decodes
+// Then times both decoders on the snapshot.
+//
+// Usage: fastdec_test [snapshot.bin] [iterations]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pb_common.h"
+#include "pb_decode.h"
+#include "pb_encode.h"
+#include "pb_fastdec.h"
+
+#define FUZZ_MAX_INPUT (64 * 1024)
+
+/* ============================================================
+ * Deterministic random source
+ * ============================================================ */
+
+static uint64_t g_rng = 0x9e3779b97f4a7c15u;
+
+static uint64_t
+rng_next(void)
+{
+  g_rng ^= g_rng << 13;
+  g_rng ^= g_rng >> 7;
+  g_rng ^= g_rng << 17;
+  return g_rng;
+}
+
+static uint32_t
+rng_below(uint32_t n)
+{
+  return (uint32_t)(rng_next() % n);
+}
+
+/* ============================================================
+ * Callback recorder
+ * ============================================================
+ *
+ * Every callback field of a message under test is wired to record_cb,
+ * which hashes the field tag and the bytes it is given. Both decoders
+ * must produce the same calls in the same order. */
+
+typedef struct
+{
+  uint64_t hash;
+  uint32_t calls;
+} recorder_t;
+
+static bool
+record_cb(pb_istream_t *stream, const pb_field_t *field, void **arg)
+{
+  recorder_t *rec = (recorder_t *)*arg;
+  uint64_t h      = rec->hash ^ (field ? field->tag : 0xffff);
+
+  // Consume a bounded prefix per call so nanopb's callback loop repeats
+  size_t take = stream->bytes_left < 7 ? stream->bytes_left : 7;
+  for (size_t i = 0; i < take; i++)
+    {
+      pb_byte_t b;
+      if (!pb_read(stream, &b, 1))
+        return false;
+      h = (h ^ b) * 0x100000001b3u;
+    }
+
+  rec->hash = h * 31 + take;
+  rec->calls++;
+  return true;
+}
+
+// Wire record_cb into all callback fields, recursing into static submessages
+// (rec NULL clears the per-decoder arg so structs can be memcmp'd)
+static void
+wire_callbacks(const pb_msgdesc_t *desc, void *msg, recorder_t *rec)
+{
+  pb_field_iter_t it;
+  if (!pb_field_iter_begin(&it, desc, msg))
+    return;
+
+  do
+    {
+      if (PB_ATYPE(it.type) == PB_ATYPE_CALLBACK)
+        {
+          pb_callback_t *cb = (pb_callback_t *)it.pData;
+          cb->funcs.decode  = record_cb;
+          cb->arg           = rec;
+        }
+      else if (PB_ATYPE(it.type) == PB_ATYPE_STATIC
+               && PB_LTYPE_IS_SUBMSG(it.type)
+               && PB_HTYPE(it.type) != PB_HTYPE_REPEATED
+               && PB_HTYPE(it.type) != PB_HTYPE_ONEOF)
+        {
+          wire_callbacks(it.submsg_desc, it.pData, rec);
+        }
+    }
+  while (pb_field_iter_next(&it));
+}
+
+/* ============================================================
+ * Synthetic messages
+ * ============================================================ */
+
+// Fill every static field with random data (has_ flags at random)
+static void
+fill_random(const pb_msgdesc_t *desc, void *msg, int depth)
+{
+  pb_field_iter_t it;
+  if (!pb_field_iter_begin(&it, desc, msg))
+    return;
+
+  do
+    {
+      if (PB_ATYPE(it.type) != PB_ATYPE_STATIC
+          || PB_HTYPE(it.type) == PB_HTYPE_REPEATED
+          || PB_HTYPE(it.type) == PB_HTYPE_ONEOF)
+        continue;
+
+      if (PB_HTYPE(it.type) == PB_HTYPE_OPTIONAL && it.pSize)
+        {
+          bool present       = depth < 6 && rng_below(4) != 0;
+          *(bool *)it.pSize = present;
+          if (!present)
+            continue;
+        }
+
+      if (PB_LTYPE_IS_SUBMSG(it.type))
+        {
+          fill_random(it.submsg_desc, it.pData, depth + 1);
+          continue;
+        }
+
+      uint64_t v = rng_next();
+      switch (rng_below(4))
+        {
+        case 0:
+          v = 0; // Defaults are omitted by the encoder
+          break;
+        case 1:
+          v &= 0x7f;
+          break;
+        default:
+          break;
+        }
+
+      if (PB_LTYPE(it.type) == PB_LTYPE_BOOL)
+        *(bool *)it.pData = v & 1;
+      else
+        memcpy(it.pData, &v, it.data_size);
+    }
+  while (pb_field_iter_next(&it));
+}
+
+// Encode a random message; returns its size
+static size_t
+synth_message(const pb_msgdesc_t *desc,
+              void *scratch,
+              size_t scratch_size,
+              uint8_t *out,
+              size_t out_size)
+{
+  memset(scratch, 0, scratch_size);
+  fill_random(desc, scratch, 0);
+
+  pb_ostream_t os = pb_ostream_from_buffer(out, out_size);
+  if (!pb_encode(&os, desc, scratch))
+    {
+      fprintf(stderr, "encode failed: %s\n", PB_GET_ERROR(&os));
+      exit(1);
+    }
+  return os.bytes_written;
+}
+
+// Append a raw length-delimited field (callback field contents)
+static size_t
+append_bytes_field(uint8_t *out, size_t at, uint32_t tag, size_t len)
+{
+  pb_ostream_t os = pb_ostream_from_buffer(out + at, FUZZ_MAX_INPUT - at);
+  uint8_t payload[256];
+  for (size_t i = 0; i < len; i++)
+    payload[i] = (uint8_t)rng_next();
+
+  if (!pb_encode_tag(&os, PB_WT_STRING, tag)
+      || !pb_encode_string(&os, payload, len))
+    return at;
+  return at + os.bytes_written;
+}
+
+/* ============================================================
+ * Mutation
+ * ============================================================ */
+
+static size_t
+mutate(uint8_t *buf, size_t size)
+{
+  int edits = 1 + (int)rng_below(4);
+  for (int e = 0; e < edits; e++)
+    {
+      switch (rng_below(6))
+        {
+        case 0: // Flip bits
+          if (size)
+            buf[rng_below((uint32_t)size)] ^= (uint8_t)(1u << rng_below(8));
+          break;
+        case 1: // Random byte
+          if (size)
+            buf[rng_below((uint32_t)size)] = (uint8_t)rng_next();
+          break;
+        case 2: // Truncate
+          if (size)
+            size = rng_below((uint32_t)size + 1);
+          break;
+        case 3: // Insert bytes
+          if (size + 8 < FUZZ_MAX_INPUT)
+            {
+              size_t at = rng_below((uint32_t)size + 1);
+              size_t n  = 1 + rng_below(8);
+              memmove(buf + at + n, buf + at, size - at);
+              for (size_t i = 0; i < n; i++)
+                buf[at + i] = (uint8_t)rng_next();
+              size += n;
+            }
+          break;
+        case 4: // Overlong varint continuation
+          if (size)
+            buf[rng_below((uint32_t)size)] |= 0x80;
+          break;
+        default: // Extreme length prefix
+          if (size)
+            buf[rng_below((uint32_t)size)] = 0xff;
+          break;
+        }
+    }
+  return size;
+}
+
+/* ============================================================
+ * Decoders under comparison
+ * ============================================================ */
+
+typedef bool (*fast_fn)(pb_istream_t *, void *, uint32_t);
+
+typedef struct
+{
+  const char *name;
+  const pb_msgdesc_t *desc;
+  fast_fn fast;
+  size_t size;
+} message_case_t;
+
+#define MESSAGE_CASE(type)                                                     \
+  { #type, type##_fields, (fast_fn)pbfast_decode_##type, sizeof(type) }
+
+static const message_case_t CASES[] = {
+  MESSAGE_CASE(ser_JonGUIState),
+  MESSAGE_CASE(ser_JonOpaquePayload),
+  MESSAGE_CASE(ser_OsdClientMetadata),
+  MESSAGE_CASE(ser_CvMeta),
+  MESSAGE_CASE(ser_ObjectDetectionsDay),
+  MESSAGE_CASE(ser_ObjectDetectionsHeat),
+  MESSAGE_CASE(ser_ObjectDetection),
+  MESSAGE_CASE(ser_SamTrackingDay),
+  MESSAGE_CASE(ser_SamTrackingHeat),
+};
+
+#define NUM_CASES (sizeof(CASES) / sizeof(CASES[0]))
+
+// Largest message struct, for scratch buffers
+static size_t
+max_case_size(void)
+{
+  size_t m = 0;
+  for (size_t i = 0; i < NUM_CASES; i++)
+    m = CASES[i].size > m ? CASES[i].size : m;
+  return m;
+}
+
+// Reference for masked decoding: copy the selected top-level fields and
+// decode them with nanopb (what the plugin did before the generated decoder)
+static bool
+ref_decode_masked(const message_case_t *mc,
+                  const uint8_t *data,
+                  size_t size,
+                  uint32_t mask,
+                  void *msg)
+{
+  static uint8_t selected[FUZZ_MAX_INPUT];
+  size_t selected_size = 0;
+  pb_istream_t scan    = pb_istream_from_buffer(data, size);
+
+  while (scan.bytes_left > 0)
+    {
+      size_t start = size - scan.bytes_left;
+      pb_wire_type_t wire_type;
+      uint32_t tag;
+      bool eof;
+
+      if (!pb_decode_tag(&scan, &wire_type, &tag, &eof))
+        {
+          if (eof)
+            break;
+          return false;
+        }
+      // A zero tag is malformed whether or not field 0 is selected
+      if (tag == 0 || !pb_skip_field(&scan, wire_type))
+        return false;
+
+      if (tag >= 32 || (mask & (1u << tag)))
+        {
+          size_t len = (size - scan.bytes_left) - start;
+          memcpy(selected + selected_size, data + start, len);
+          selected_size += len;
+        }
+    }
+
+  pb_istream_t stream = pb_istream_from_buffer(selected, selected_size);
+  return pb_decode_ex(&stream, mc->desc, msg, PB_DECODE_NOINIT);
+}
+
+typedef struct
+{
+  unsigned long runs;
+  unsigned long accepted;
+  unsigned long rejected;
+} stats_t;
+
+static void *g_ref_msg;
+static void *g_fast_msg;
+
+/**
+ * Decode data with both decoders and compare
+ *
+ * @return false (after printing details) on any difference
+ */
+static bool
+compare_decode(const message_case_t *mc,
+               const uint8_t *data,
+               size_t size,
+               uint32_t mask,
+               stats_t *stats)
+{
+  recorder_t ref_rec = { 0, 0 }, fast_rec = { 0, 0 };
+
+  memset(g_ref_msg, 0, mc->size);
+  memset(g_fast_msg, 0, mc->size);
+  wire_callbacks(mc->desc, g_ref_msg, &ref_rec);
+  wire_callbacks(mc->desc, g_fast_msg, &fast_rec);
+
+  bool ref_ok;
+  if (mask == PBFAST_ALL_FIELDS)
+    {
+      pb_istream_t s = pb_istream_from_buffer(data, size);
+      ref_ok         = pb_decode_ex(&s, mc->desc, g_ref_msg, PB_DECODE_NOINIT);
+    }
+  else
+    {
+      ref_ok = ref_decode_masked(mc, data, size, mask, g_ref_msg);
+    }
+
+  pb_istream_t fs = pb_istream_from_buffer(data, size);
+  bool fast_ok    = mc->fast(&fs, g_fast_msg, mask);
+
+  stats->runs++;
+  if (ref_ok != fast_ok)
+    {
+      fprintf(stderr, "%s: pb_decode %s, fast decoder %s (%s) [%zu bytes]\n",
+              mc->name, ref_ok ? "accepted" : "rejected",
+              fast_ok ? "accepted" : "rejected", PB_GET_ERROR(&fs), size);
+      return false;
+    }
+  if (!ref_ok)
+    {
+      stats->rejected++;
+      return true;
+    }
+
+  stats->accepted++;
+  wire_callbacks(mc->desc, g_ref_msg, NULL);
+  wire_callbacks(mc->desc, g_fast_msg, NULL);
+  if (fs.bytes_left != 0)
+    {
+      fprintf(stderr, "%s: fast decoder left %zu bytes\n", mc->name,
+              fs.bytes_left);
+      return false;
+    }
+  if (memcmp(g_ref_msg, g_fast_msg, mc->size) != 0)
+    {
+      fprintf(stderr, "%s: decoded structs differ [%zu bytes]\n", mc->name,
+              size);
+      return false;
+    }
+  if (ref_rec.calls != fast_rec.calls || ref_rec.hash != fast_rec.hash)
+    {
+      fprintf(stderr, "%s: callbacks differ (%u vs %u calls)\n", mc->name,
+              ref_rec.calls, fast_rec.calls);
+      return false;
+    }
+  return true;
+}
+
+// Seed inputs for a message: synthetic encodings (+ callback fields)
+static size_t
+make_seed(const message_case_t *mc, void *scratch, uint8_t *out)
+{
+  size_t size = synth_message(mc->desc, scratch, mc->size, out, FUZZ_MAX_INPUT);
+
+  // Callback fields are not filled by the encoder; add raw ones
+  pb_field_iter_t it;
+  if (pb_field_iter_begin(&it, mc->desc, scratch))
+    {
+      do
+        {
+          if (PB_ATYPE(it.type) == PB_ATYPE_CALLBACK && rng_below(2))
+            {
+              int n = 1 + (int)rng_below(3);
+              for (int i = 0; i < n; i++)
+                size = append_bytes_field(out, size, it.tag, rng_below(64));
+            }
+        }
+      while (pb_field_iter_next(&it));
+    }
+  return size;
+}
+
+static uint8_t *
+read_file(const char *path, size_t *size)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return NULL;
+
+  uint8_t *buf = malloc(FUZZ_MAX_INPUT);
+  *size        = fread(buf, 1, FUZZ_MAX_INPUT, f);
+  fclose(f);
+  return buf;
+}
+
+static double
+now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* ============================================================
+ * Benchmark
+ * ============================================================ */
+
+static volatile uint32_t g_sink;
+
+static void
+benchmark(const char *label, const uint8_t *data, size_t size, uint32_t mask)
+{
+  static ser_JonGUIState state;
+  const int iterations = 200000;
+  const message_case_t *mc = &CASES[0];
+
+  double t0 = now_ns();
+  for (int i = 0; i < iterations; i++)
+    {
+      memset(&state, 0, sizeof(state));
+      if (mask == PBFAST_ALL_FIELDS)
+        {
+          pb_istream_t s = pb_istream_from_buffer(data, size);
+          g_sink += pb_decode_ex(&s, ser_JonGUIState_fields, &state,
+                                 PB_DECODE_NOINIT);
+        }
+      else
+        {
+          g_sink += ref_decode_masked(mc, data, size, mask, &state);
+        }
+    }
+  double t1 = now_ns();
+  for (int i = 0; i < iterations; i++)
+    {
+      memset(&state, 0, sizeof(state));
+      pb_istream_t s = pb_istream_from_buffer(data, size);
+      g_sink += pbfast_decode_ser_JonGUIState(&s, &state, mask);
+    }
+  double t2 = now_ns();
+
+  double ref_ns  = (t1 - t0) / iterations;
+  double fast_ns = (t2 - t1) / iterations;
+  printf("  %-28s pb_decode %8.1f ns   fast %8.1f ns   %5.2fx\n", label,
+         ref_ns, fast_ns, ref_ns / fast_ns);
+}
+
+int
+main(int argc, char *argv[])
+{
+  const char *snapshot_path = (argc > 1) ? argv[1] : "test/proto_snapshot.bin";
+  long iterations           = (argc > 2) ? atol(argv[2]) : 20000;
+
+  printf("========================================\n");
+  printf("  Generated decoder equivalence test\n");
+  printf("========================================\n\n");
+
+  size_t snapshot_size = 0;
+  uint8_t *snapshot    = read_file(snapshot_path, &snapshot_size);
+  if (!snapshot)
+    {
+      fprintf(stderr, "error: cannot read %s\n", snapshot_path);
+      return 1;
+    }
+  printf("Snapshot: %s (%zu bytes)\n", snapshot_path, snapshot_size);
+
+  size_t scratch_size = max_case_size();
+  void *scratch       = malloc(scratch_size);
+  g_ref_msg           = malloc(scratch_size);
+  g_fast_msg          = malloc(scratch_size);
+  uint8_t *seed       = malloc(FUZZ_MAX_INPUT);
+  uint8_t *input      = malloc(FUZZ_MAX_INPUT);
+
+  // The snapshot itself, full and masked
+  stats_t snap_stats = { 0, 0, 0 };
+  if (!compare_decode(&CASES[0], snapshot, snapshot_size, PBFAST_ALL_FIELDS,
+                      &snap_stats)
+      || snap_stats.accepted != 1)
+    {
+      fprintf(stderr, "FAIL: snapshot\n");
+      return 1;
+    }
+
+  for (size_t c = 0; c < NUM_CASES; c++)
+    {
+      const message_case_t *mc = &CASES[c];
+      stats_t stats            = { 0, 0, 0 };
+
+      for (long i = 0; i < iterations; i++)
+        {
+          size_t size;
+          if (c == 0 && rng_below(4) == 0)
+            {
+              memcpy(seed, snapshot, snapshot_size);
+              size = snapshot_size;
+            }
+          else
+            {
+              size = make_seed(mc, scratch, seed);
+            }
+
+          uint32_t mask = PBFAST_ALL_FIELDS;
+          if (rng_below(3) == 0)
+            mask = (uint32_t)rng_next();
+
+          // Clean input first, then a few mutants of it
+          if (!compare_decode(mc, seed, size, mask, &stats))
+            return 1;
+          for (int m = 0; m < 4; m++)
+            {
+              memcpy(input, seed, size);
+              size_t mutated = mutate(input, size);
+              if (!compare_decode(mc, input, mutated, mask, &stats))
+                return 1;
+            }
+        }
+
+      printf("  %-26s %8lu inputs  %8lu accepted  %8lu rejected\n", mc->name,
+             stats.runs, stats.accepted, stats.rejected);
+    }
+
+  printf("\nAll decoders agree with pb_decode\n\n");
+
+  printf("Benchmark (JonGUIState snapshot, per decode):\n");
+  benchmark("full state", snapshot, snapshot_size, PBFAST_ALL_FIELDS);
+  benchmark("navball + crosshair fields", snapshot, snapshot_size,
+            (1u << ser_JonGUIState_rotary_tag)
+              | (1u << ser_JonGUIState_rec_osd_tag)
+              | (1u << ser_JonGUIState_time_tag)
+              | (1u << ser_JonGUIState_actual_space_time_tag));
+
+  size_t synth_size = make_seed(&CASES[0], scratch, seed);
+  benchmark("synthetic (all fields set)", seed, synth_size,
+            PBFAST_ALL_FIELDS);
+
+  free(input);
+  free(seed);
+  free(g_fast_msg);
+  free(g_ref_msg);
+  free(scratch);
+  free(snapshot);
+  return 0;
+}
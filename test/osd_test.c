@@ -23,14 +23,24 @@
 #include "opaque/detection_common.pb.h"
 #include "opaque/object_detections_day.pb.h"
 #include "opaque/object_detections_heat.pb.h"
+#include "opaque/sam_tracking_day.pb.h"
+#include "opaque/sam_tracking_heat.pb.h"
 #include "pb_encode.h"
 
 #define OUTPUT_PNG "snapshot/osd_render.png"
 
+// wasm_osd_render_step() result while the frame is unfinished, and the
+// wasm_osd_frame() flag that re-renders an unchanged frame (must match
+// wasm_exports.h)
+#define WASM_OSD_STEP_PENDING 2
+#define WASM_OSD_FRAME_FORCE_RENDER 0x1
+
 // Opaque payload UUIDs (must match osd_plugin.c)
 #define CV_META_UUID "019c3e33-d52d-7552-b36b-6fdcaa5d59b8"
 #define OBJECT_DETECTIONS_DAY_UUID "019c40f6-825c-7f4c-8284-ddad4375ed9b"
 #define OBJECT_DETECTIONS_HEAT_UUID "019c40f6-825d-7e0e-9893-87c7b167a751"
+#define SAM_TRACKING_DAY_UUID "019f4a7c-8b2d-7a1e-9c3f-2e8d5f1a4b6e"
+#define SAM_TRACKING_HEAT_UUID "019f4a7c-8b2e-7f3c-a1d2-4e9b7c5f8a3d"
 
 /* ============================================================
  * Nanopb encoding callbacks for CALLBACK fields
@@ -356,6 +366,76 @@ build_synthetic_state (const char *variant_name, size_t *out_size)
   return state_buf;
 }
 
+// Build a JonGUIState whose only payload is a SAM track with a 4x4 mask:
+// its top two rows set, or its bottom two. The mask covers the 512x512
+// crop in the middle of the frame, so the set half is the 512x256 area
+// above or below the frame center.
+// Returns pointer to static buffer; caller must not free.
+static uint8_t *
+build_sam_state (bool is_day, bool bottom, size_t *out_size)
+{
+  // [run_length:u16 LE, value:u8] runs over the 16 mask cells
+  static const uint8_t rle_top[] = { 8, 0, 1, 8, 0, 0 };
+  static const uint8_t rle_bottom[] = { 8, 0, 0, 8, 0, 1 };
+  bytes_ctx_t rle = { .data = bottom ? rle_bottom : rle_top,
+                      .size = sizeof (rle_top) };
+
+  // SamTrackingDay and SamTrackingHeat share one layout
+  ser_SamTrackingDay sam = ser_SamTrackingDay_init_zero;
+  sam.status = ser_SamTrackingStatus_SAM_TRACKING_STATUS_OK;
+  sam.state = ser_SamTrackingState_SAM_TRACKING_STATE_TRACKING;
+  sam.bbox_x1 = -0.9;
+  sam.bbox_y1 = -0.9;
+  sam.bbox_x2 = 0.9;
+  sam.bbox_y2 = 0.9;
+  sam.confidence = 0.9f;
+  sam.mask_rle.funcs.encode = encode_bytes_cb;
+  sam.mask_rle.arg = &rle;
+  sam.mask_width = 4;
+  sam.mask_height = 4;
+  sam.mask_pixels = 8;
+
+  static uint8_t sam_buf[256];
+  pb_ostream_t sam_stream = pb_ostream_from_buffer (sam_buf, sizeof (sam_buf));
+  if (!pb_encode (&sam_stream,
+                  is_day ? ser_SamTrackingDay_fields
+                         : ser_SamTrackingHeat_fields,
+                  &sam))
+    {
+      fprintf (stderr, "error: SamTracking encode failed: %s\n",
+               PB_GET_ERROR (&sam_stream));
+      return NULL;
+    }
+
+  bytes_ctx_t sam_payload = { .data = sam_buf,
+                              .size = sam_stream.bytes_written };
+  ser_JonOpaquePayload opaque = ser_JonOpaquePayload_init_zero;
+  opaque.type_uuid.funcs.encode = encode_string_cb;
+  opaque.type_uuid.arg
+      = (void *)(is_day ? SAM_TRACKING_DAY_UUID : SAM_TRACKING_HEAT_UUID);
+  opaque.payload.funcs.encode = encode_bytes_cb;
+  opaque.payload.arg = &sam_payload;
+  opaque_array_ctx_t opaque_ctx = { .payloads = &opaque, .count = 1 };
+
+  ser_JonGUIState state = ser_JonGUIState_init_zero;
+  state.system_monotonic_time_us = 2000000;
+  state.opaque_payloads.funcs.encode = encode_opaque_payloads_cb;
+  state.opaque_payloads.arg = &opaque_ctx;
+
+  static uint8_t state_buf[512];
+  pb_ostream_t state_stream
+      = pb_ostream_from_buffer (state_buf, sizeof (state_buf));
+  if (!pb_encode (&state_stream, ser_JonGUIState_fields, &state))
+    {
+      fprintf (stderr, "error: JonGUIState encode failed: %s\n",
+               PB_GET_ERROR (&state_stream));
+      return NULL;
+    }
+
+  *out_size = state_stream.bytes_written;
+  return state_buf;
+}
+
 typedef struct {
   const char *name;
   uint32_t width;
@@ -404,6 +484,59 @@ exit_with_error(const char *message, wasmtime_error_t *error, wasm_trap_t *trap)
   exit(1);
 }
 
+// Reference decoder for wasm_osd_get_sparse_frame() blocks: expands the
+// occupied tiles into a width * height RGBA image (zeroed by the caller).
+// The block layout is twelve little-endian 32-bit words (magic, width,
+// height, tile_size, tiles_x, tiles_y, tile_count, tile_bytes, occupancy,
+// tiles, size, generation), the occupancy bitmap and the packed tiles.
+static bool
+decode_sparse_frame(const uint8_t *block,
+                    size_t block_size,
+                    uint8_t *out,
+                    uint32_t width,
+                    uint32_t height)
+{
+  uint32_t h[12];
+  if (block_size < sizeof(h))
+    return false;
+  memcpy(h, block, sizeof(h));
+
+  uint32_t tile_size = h[3], tiles_x = h[4], tiles_y = h[5];
+  uint32_t tile_count = h[6], tile_bytes = h[7];
+  if (h[0] != 0x5053534fu || h[1] != width || h[2] != height
+      || h[10] > block_size || tile_bytes != tile_size * tile_size * 4
+      || (size_t)h[8] + (tiles_x * tiles_y + 31) / 32 * 4 > h[9]
+      || (size_t)h[9] + (size_t)tile_count * tile_bytes > h[10])
+    return false;
+
+  const uint8_t *bitmap = block + h[8];
+  const uint8_t *tile = block + h[9];
+  uint32_t decoded = 0;
+
+  for (uint32_t i = 0; i < tiles_x * tiles_y; i++)
+    {
+      uint32_t word;
+      memcpy(&word, bitmap + i / 32 * 4, sizeof(word));
+      if (!(word & (1u << (i % 32))))
+        continue;
+      if (decoded++ == tile_count)
+        return false;
+
+      // Clip the tile to the image; padding past the edges is skipped
+      uint32_t x0 = i % tiles_x * tile_size;
+      uint32_t y0 = i / tiles_x * tile_size;
+      uint32_t w = width - x0 < tile_size ? width - x0 : tile_size;
+      uint32_t rows = height - y0 < tile_size ? height - y0 : tile_size;
+      for (uint32_t y = 0; y < rows; y++)
+        {
+          memcpy(out + ((size_t)(y0 + y) * width + x0) * 4,
+                  tile + (size_t)y * tile_size * 4, (size_t)w * 4);
+        }
+      tile += tile_bytes;
+    }
+  return decoded == tile_count;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -600,7 +733,7 @@ main(int argc, char *argv[])
 
   // Get exports
   printf("Getting exported functions...\n");
-  wasmtime_extern_t init_extern, render_extern, get_fb_extern;
+  wasmtime_extern_t init_extern, render_extern, get_fb_extern, frame_extern;
 
   if (!wasmtime_instance_export_get(context, &instance, "wasm_osd_init",
                                      strlen("wasm_osd_init"), &init_extern))
@@ -626,6 +759,13 @@ main(int argc, char *argv[])
       return 1;
     }
 
+  if (!wasmtime_instance_export_get(context, &instance, "wasm_osd_frame",
+                                     strlen("wasm_osd_frame"), &frame_extern))
+    {
+      fprintf(stderr, "error: failed to find wasm_osd_frame export\n");
+      return 1;
+    }
+
   // Call wasm_osd_init()
   printf("Calling wasm_osd_init()...\n");
   wasmtime_val_t results_init[1];
@@ -651,7 +791,7 @@ main(int argc, char *argv[])
   uint32_t proto_ptr = 0;
   uint32_t proto_size = 0;
   bool proto_loaded = false;
-  wasmtime_extern_t update_state_extern;
+  wasmtime_extern_t commit_state_extern;
 
   size_t synthetic_size = 0;
   uint8_t *proto_data
@@ -672,46 +812,68 @@ main(int argc, char *argv[])
         }
 
       wasmtime_memory_t *memory = &memory_extern.of.memory;
-      uint8_t *memory_data = wasmtime_memory_data (context, memory);
-      size_t memory_size = wasmtime_memory_data_size (context, memory);
 
-      // Place proto at 9MB offset (safe beyond framebuffer)
-      proto_ptr = 0x900000;
-      if (proto_ptr + proto_size > memory_size)
+      // Get state buffer exports
+      wasmtime_extern_t state_buffer_extern;
+      if (!wasmtime_instance_export_get (
+              context, &instance, "wasm_osd_get_state_buffer",
+              strlen ("wasm_osd_get_state_buffer"), &state_buffer_extern))
         {
           fprintf (stderr,
-                   "error: not enough WASM memory for proto data\n");
+                   "error: failed to find wasm_osd_get_state_buffer "
+                   "export\n");
           return 1;
         }
 
-      // Copy proto data into WASM memory
-      memcpy (memory_data + proto_ptr, proto_data, proto_size);
-      printf ("  Copied to WASM memory at 0x%08x\n", proto_ptr);
-
-      // Get wasm_osd_update_state export
       if (!wasmtime_instance_export_get (
-              context, &instance, "wasm_osd_update_state",
-              strlen ("wasm_osd_update_state"), &update_state_extern))
+              context, &instance, "wasm_osd_commit_state",
+              strlen ("wasm_osd_commit_state"), &commit_state_extern))
         {
           fprintf (stderr,
-                   "error: failed to find wasm_osd_update_state export\n");
+                   "error: failed to find wasm_osd_commit_state export\n");
           return 1;
         }
 
-      // Call wasm_osd_update_state(proto_ptr, proto_size)
-      printf ("Calling wasm_osd_update_state()...\n");
-      wasmtime_val_t update_args[2];
+      // Ask the module where to put the state
+      wasmtime_val_t buffer_args[1];
+      buffer_args[0].kind = WASMTIME_I32;
+      buffer_args[0].of.i32 = proto_size;
+
+      wasmtime_val_t buffer_results[1];
+      error = wasmtime_func_call (context, &state_buffer_extern.of.func,
+                                   buffer_args, 1, buffer_results, 1, &trap);
+      if (error != NULL || trap != NULL)
+        {
+          exit_with_error ("failed to call wasm_osd_get_state_buffer", error,
+                           trap);
+        }
+
+      proto_ptr = (uint32_t)buffer_results[0].of.i32;
+      if (proto_ptr == 0)
+        {
+          fprintf (stderr,
+                   "error: state (%u bytes) exceeds module state buffer\n",
+                   proto_size);
+          return 1;
+        }
+
+      // Copy proto data straight into the module's state buffer
+      uint8_t *memory_data = wasmtime_memory_data (context, memory);
+      memcpy (memory_data + proto_ptr, proto_data, proto_size);
+      printf ("  Copied to state buffer at 0x%08x\n", proto_ptr);
+
+      // Call wasm_osd_commit_state(proto_size)
+      printf ("Calling wasm_osd_commit_state()...\n");
+      wasmtime_val_t update_args[1];
       update_args[0].kind = WASMTIME_I32;
-      update_args[0].of.i32 = proto_ptr;
-      update_args[1].kind = WASMTIME_I32;
-      update_args[1].of.i32 = proto_size;
+      update_args[0].of.i32 = proto_size;
 
       wasmtime_val_t update_results[1];
-      error = wasmtime_func_call (context, &update_state_extern.of.func,
-                                   update_args, 2, update_results, 1, &trap);
+      error = wasmtime_func_call (context, &commit_state_extern.of.func,
+                                   update_args, 1, update_results, 1, &trap);
       if (error != NULL || trap != NULL)
         {
-          exit_with_error ("failed to call wasm_osd_update_state", error,
+          exit_with_error ("failed to call wasm_osd_commit_state", error,
                            trap);
         }
 
@@ -726,71 +888,64 @@ main(int argc, char *argv[])
               "defaults\n");
     }
 
-  // Call wasm_osd_render() and measure performance
+  // Call wasm_osd_frame() and measure performance
   // (Checkerboard background is now drawn inside WASM)
-  printf("Calling wasm_osd_render()...\n");
-
-  // Warm-up render (JIT compilation, cache loading)
+  printf("Calling wasm_osd_frame()...\n");
+
+  // wasm_osd_frame(state_ptr, state_size, flags, out_info_ptr): the state
+  // is already in the module's state buffer; size 0 renders without one
+  wasmtime_val_t frame_args[4];
+  frame_args[0].kind = WASMTIME_I32;
+  frame_args[0].of.i32 = (int32_t)proto_ptr;
+  frame_args[1].kind = WASMTIME_I32;
+  frame_args[1].of.i32 = proto_loaded ? (int32_t)proto_size : 0;
+  frame_args[2].kind = WASMTIME_I32;
+  frame_args[2].of.i32 = 0;
+  frame_args[3].kind = WASMTIME_I32;
+  frame_args[3].of.i32 = 0;
+
+  // Warm-up frame (JIT compilation, cache loading)
   wasmtime_val_t warmup_results[1];
-  wasmtime_func_call(context, &render_extern.of.func, NULL, 0,
+  wasmtime_func_call(context, &frame_extern.of.func, frame_args, 4,
                       warmup_results, 1, NULL);
 
   // Performance measurement - run many times for accuracy
   const int ITERATIONS = 100;
   struct timespec start, end;
 
-  if (proto_loaded)
+  // One host call per frame: state update and render. The state never
+  // changes, so every frame is forced; otherwise all of them would be
+  // skipped after the warm-up
+  printf("  Benchmarking %s...\n", proto_loaded
+                                      ? "with protobuf state updates"
+                                      : "with default state");
+  frame_args[2].of.i32 = WASM_OSD_FRAME_FORCE_RENDER;
+  int rendered = 0;
+  int skipped  = 0;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for (int i = 0; i < ITERATIONS; i++)
     {
-      // Benchmark with protobuf state updates (realistic production scenario)
-      printf("  Benchmarking with protobuf state updates...\n");
-
-      wasmtime_val_t update_args[2];
-      update_args[0].kind = WASMTIME_I32;
-      update_args[0].of.i32 = proto_ptr;
-      update_args[1].kind = WASMTIME_I32;
-      update_args[1].of.i32 = proto_size;
-
-      clock_gettime(CLOCK_MONOTONIC, &start);
-
-      for (int i = 0; i < ITERATIONS; i++)
+      wasmtime_val_t results_frame[1];
+      error = wasmtime_func_call(context, &frame_extern.of.func, frame_args,
+                                  4, results_frame, 1, &trap);
+      if (error != NULL || trap != NULL)
         {
-          // Update state (sets needs_render = true)
-          wasmtime_val_t update_results[1];
-          wasmtime_func_call(context, &update_state_extern.of.func,
-                              update_args, 2, update_results, 1, NULL);
-
-          // Render
-          wasmtime_val_t results_render[1];
-          error = wasmtime_func_call(context, &render_extern.of.func, NULL, 0,
-                                      results_render, 1, &trap);
-          if (error != NULL || trap != NULL)
-            {
-              exit_with_error("failed to call wasm_osd_render", error, trap);
-            }
+          exit_with_error("failed to call wasm_osd_frame", error, trap);
         }
-
-      clock_gettime(CLOCK_MONOTONIC, &end);
-    }
-  else
-    {
-      // Benchmark with default state (no protobuf updates)
-      printf("  Benchmarking with default state...\n");
-      clock_gettime(CLOCK_MONOTONIC, &start);
-
-      for (int i = 0; i < ITERATIONS; i++)
+      if (results_frame[0].of.i32 == 1)
         {
-          wasmtime_val_t results_render[1];
-          error = wasmtime_func_call(context, &render_extern.of.func, NULL, 0,
-                                      results_render, 1, &trap);
-          if (error != NULL || trap != NULL)
-            {
-              exit_with_error("failed to call wasm_osd_render", error, trap);
-            }
+          rendered++;
+        }
+      else
+        {
+          skipped++;
         }
-
-      clock_gettime(CLOCK_MONOTONIC, &end);
     }
 
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  frame_args[2].of.i32 = 0;
+
   // Calculate average time in microseconds
   long long start_ns = start.tv_sec * 1000000000LL + start.tv_nsec;
   long long end_ns = end.tv_sec * 1000000000LL + end.tv_nsec;
@@ -801,10 +956,17 @@ main(int argc, char *argv[])
 
   printf("✓ Render complete\n");
   printf("  Total time: %.1f ms for %d iterations\n", total_ms, ITERATIONS);
+  printf("  Frames: %d rendered, %d skipped\n", rendered, skipped);
   printf("  Performance: %.2f μs/frame (%.4f ms/frame)\n", avg_us, avg_ms);
 
-  // Show target achievement
-  if (avg_ms < 1.0)
+  // Show target achievement (skipped frames say nothing about rendering)
+  if (rendered != ITERATIONS)
+    {
+      printf("  ⚠️  %d of %d frames skipped - timing does not measure "
+             "rendering\n",
+             skipped, ITERATIONS);
+    }
+  else if (avg_ms < 1.0)
     {
       printf("  ✅ TARGET ACHIEVED: <1ms rendering (%.1f%% of target)\n",
              (avg_ms / 1.0) * 100.0);
@@ -817,6 +979,109 @@ main(int argc, char *argv[])
              avg_us / 3.0, avg_ms / 3.0);
     }
 
+  // Host call overhead with nothing to re-render: the old per-frame
+  // sequence (render + get_framebuffer, plus an update call when there is
+  // state) against one wasm_osd_frame() call
+  const int OVERHEAD_ITERATIONS = 10000;
+  frame_args[1].of.i32 = 0;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int i = 0; i < OVERHEAD_ITERATIONS; i++)
+    {
+      wasmtime_val_t call_results[1];
+      wasmtime_func_call(context, &render_extern.of.func, NULL, 0,
+                          call_results, 1, NULL);
+      wasmtime_func_call(context, &get_fb_extern.of.func, NULL, 0,
+                          call_results, 1, NULL);
+    }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double legacy_ns = ((end.tv_sec - start.tv_sec) * 1000000000.0
+                      + (end.tv_nsec - start.tv_nsec))
+                     / OVERHEAD_ITERATIONS;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int i = 0; i < OVERHEAD_ITERATIONS; i++)
+    {
+      wasmtime_val_t call_results[1];
+      wasmtime_func_call(context, &frame_extern.of.func, frame_args, 4,
+                          call_results, 1, NULL);
+    }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double frame_ns = ((end.tv_sec - start.tv_sec) * 1000000000.0
+                     + (end.tv_nsec - start.tv_nsec))
+                    / OVERHEAD_ITERATIONS;
+
+  // The old sequence also paid an update call per frame
+  int legacy_calls = proto_loaded ? 3 : 2;
+  printf("  Host call overhead (idle frame):\n");
+  printf("    before: %d calls, ~%.0f ns/frame (%.0f ns/call)\n",
+         legacy_calls, legacy_ns / 2.0 * legacy_calls, legacy_ns / 2.0);
+  printf("    after:  1 call (wasm_osd_frame), %.0f ns/frame\n", frame_ns);
+
+  // Sliced rendering with a state committed between every two steps, as
+  // a host stepping once per animation frame sees it when states arrive
+  // faster: each frame must still complete
+  wasmtime_extern_t step_extern;
+  if (proto_loaded
+      && wasmtime_instance_export_get(context, &instance,
+                                      "wasm_osd_render_step",
+                                      strlen("wasm_osd_render_step"),
+                                      &step_extern))
+    {
+      const int STEP_FRAMES = 10;
+      const int MAX_STEPS = 1000;
+      int max_steps = 0;
+
+      for (int f = 0; f < STEP_FRAMES; f++)
+        {
+          wasmtime_val_t commit_args[1];
+          wasmtime_val_t step_args[1];
+          wasmtime_val_t call_results[1];
+          commit_args[0].kind = WASMTIME_I32;
+          commit_args[0].of.i32 = (int32_t)proto_size;
+          step_args[0].kind = WASMTIME_I32;
+          step_args[0].of.i32 = 1; // 1 us: about one widget per call
+
+          int steps = 0;
+          int step_result = WASM_OSD_STEP_PENDING;
+          while (step_result == WASM_OSD_STEP_PENDING && steps < MAX_STEPS)
+            {
+              error = wasmtime_func_call(context, &commit_state_extern.of.func,
+                                          commit_args, 1, call_results, 1,
+                                          &trap);
+              if (error == NULL && trap == NULL)
+                {
+                  error = wasmtime_func_call(context, &step_extern.of.func,
+                                              step_args, 1, call_results, 1,
+                                              &trap);
+                }
+              if (error != NULL || trap != NULL)
+                {
+                  exit_with_error("failed to call wasm_osd_render_step",
+                                  error, trap);
+                }
+              step_result = call_results[0].of.i32;
+              steps++;
+            }
+
+          if (step_result == WASM_OSD_STEP_PENDING)
+            {
+              fprintf(stderr,
+                      "error: stepped frame %d unfinished after %d steps "
+                      "with updates in between\n",
+                      f, MAX_STEPS);
+              return 1;
+            }
+          if (steps > max_steps)
+            {
+              max_steps = steps;
+            }
+        }
+      printf("  Stepped rendering with updates between steps: %d frames, "
+             "at most %d steps each\n",
+             STEP_FRAMES, max_steps);
+    }
+
   // Call wasm_osd_get_framebuffer()
   printf("Getting framebuffer pointer...\n");
   wasmtime_val_t results_fb[1];
@@ -845,6 +1110,39 @@ main(int argc, char *argv[])
 
   printf("WASM memory: %zu bytes\n", memory_size);
 
+  // Frame-budget governor after the benchmark: wasm_osd_budget_stats_t is
+  // twelve little-endian 32-bit words (level, quality, budget_us, avg_us,
+  // last_us, level_changes, ...)
+  wasmtime_extern_t budget_extern;
+  if (wasmtime_instance_export_get(context, &instance,
+                                   "wasm_osd_get_budget_stats",
+                                   strlen("wasm_osd_get_budget_stats"),
+                                   &budget_extern))
+    {
+      wasmtime_val_t budget_results[1];
+      error = wasmtime_func_call(context, &budget_extern.of.func, NULL, 0,
+                                  budget_results, 1, &trap);
+      uint32_t budget_ptr = (error == NULL && trap == NULL)
+                              ? (uint32_t)budget_results[0].of.i32
+                              : 0;
+      if (budget_ptr && budget_ptr + 12 * sizeof(uint32_t) <= memory_size)
+        {
+          uint32_t budget[12];
+          memcpy(budget, memory_data + budget_ptr, sizeof(budget));
+          if (budget[2] > 0)
+            {
+              printf("Render budget: level %u (quality 0x%02x), "
+                     "avg %u us of %u us, %u level changes\n",
+                     budget[0], budget[1], budget[3], budget[2], budget[5]);
+            }
+          else
+            {
+              printf("Render budget: off (avg %u us/frame in widgets)\n",
+                     budget[3]);
+            }
+        }
+    }
+
   // Verify framebuffer pointer is within memory bounds
   size_t fb_size = WIDTH * HEIGHT * 4; // RGBA
   if (fb_ptr + fb_size > memory_size)
@@ -855,6 +1153,52 @@ main(int argc, char *argv[])
       return 1;
     }
 
+  // Sparse transfer form of the same frame must decode to it exactly
+  wasmtime_extern_t sparse_extern;
+  if (wasmtime_instance_export_get(context, &instance,
+                                   "wasm_osd_get_sparse_frame",
+                                   strlen("wasm_osd_get_sparse_frame"),
+                                   &sparse_extern))
+    {
+      wasmtime_val_t sparse_args[1];
+      wasmtime_val_t sparse_results[1];
+      sparse_args[0].kind = WASMTIME_I32;
+      sparse_args[0].of.i32 = 0; // Default tile size
+      error = wasmtime_func_call(context, &sparse_extern.of.func,
+                                  sparse_args, 1, sparse_results, 1, &trap);
+      if (error != NULL || trap != NULL)
+        {
+          exit_with_error("failed to call wasm_osd_get_sparse_frame", error,
+                          trap);
+        }
+
+      // The call may have grown the memory
+      memory_data = wasmtime_memory_data(context, memory);
+      memory_size = wasmtime_memory_data_size(context, memory);
+
+      uint32_t sparse_ptr = (uint32_t)sparse_results[0].of.i32;
+      uint8_t *decoded = (uint8_t *)calloc(fb_size, 1);
+      if (!sparse_ptr || sparse_ptr >= memory_size || !decoded
+          || !decode_sparse_frame(memory_data + sparse_ptr,
+                                  memory_size - sparse_ptr, decoded, WIDTH,
+                                  HEIGHT)
+          || memcmp(decoded, memory_data + fb_ptr, fb_size) != 0)
+        {
+          fprintf(stderr, "error: sparse frame does not match the "
+                          "framebuffer\n");
+          free(decoded);
+          return 1;
+        }
+      free(decoded);
+
+      uint32_t sparse_header[12];
+      memcpy(sparse_header, memory_data + sparse_ptr, sizeof(sparse_header));
+      printf("Sparse frame: %u of %u tiles, %u bytes (%.1f%% of %zu)\n",
+             sparse_header[6], sparse_header[4] * sparse_header[5],
+             sparse_header[10], 100.0 * sparse_header[10] / fb_size,
+             fb_size);
+    }
+
   // Get framebuffer data (RGBA format from WASM)
   uint8_t *fb_data_wasm = memory_data + fb_ptr;
 
@@ -927,6 +1271,74 @@ main(int argc, char *argv[])
   free(fb_data_output);
 
   printf("✓ PNG saved successfully\n");
+
+  // A new SAM payload must move the mask: render a mask over the top half
+  // of the crop, then one over the bottom half, and probe a pixel in each
+  // half (off the crosshair's axes and diagonals)
+  wasmtime_extern_t sam_buffer_extern;
+  if (proto_loaded
+      && wasmtime_instance_export_get(context, &instance,
+                                      "wasm_osd_get_state_buffer",
+                                      strlen("wasm_osd_get_state_buffer"),
+                                      &sam_buffer_extern))
+    {
+      bool is_day = strstr(variant->name, "day") != NULL;
+      size_t probe_x = WIDTH / 2 - 160;
+      size_t probe_top = ((HEIGHT / 2 - 96) * WIDTH + probe_x) * 4;
+      size_t probe_bottom = ((HEIGHT / 2 + 96) * WIDTH + probe_x) * 4;
+      uint32_t top[2], bottom[2];
+
+      for (int m = 0; m < 2; m++)
+        {
+          size_t sam_size = 0;
+          uint8_t *sam_state = build_sam_state(is_day, m == 1, &sam_size);
+          if (!sam_state)
+            {
+              return 1;
+            }
+
+          wasmtime_val_t sam_args[4];
+          wasmtime_val_t call_results[1];
+          sam_args[0].kind = WASMTIME_I32;
+          sam_args[0].of.i32 = (int32_t)sam_size;
+          error = wasmtime_func_call(context, &sam_buffer_extern.of.func,
+                                      sam_args, 1, call_results, 1, &trap);
+          if (error != NULL || trap != NULL || call_results[0].of.i32 == 0)
+            {
+              exit_with_error("failed to get a SAM state buffer", error,
+                              trap);
+            }
+          uint32_t sam_ptr = (uint32_t)call_results[0].of.i32;
+          memcpy(wasmtime_memory_data(context, memory) + sam_ptr, sam_state,
+                 sam_size);
+
+          sam_args[0].of.i32 = (int32_t)sam_ptr;
+          sam_args[1].kind = WASMTIME_I32;
+          sam_args[1].of.i32 = (int32_t)sam_size;
+          sam_args[2].kind = WASMTIME_I32;
+          sam_args[2].of.i32 = 0;
+          sam_args[3].kind = WASMTIME_I32;
+          sam_args[3].of.i32 = 0;
+          error = wasmtime_func_call(context, &frame_extern.of.func, sam_args,
+                                      4, call_results, 1, &trap);
+          if (error != NULL || trap != NULL)
+            {
+              exit_with_error("failed to call wasm_osd_frame", error, trap);
+            }
+
+          const uint8_t *fb = wasmtime_memory_data(context, memory) + fb_ptr;
+          memcpy(&top[m], fb + probe_top, sizeof(top[m]));
+          memcpy(&bottom[m], fb + probe_bottom, sizeof(bottom[m]));
+        }
+
+      printf("SAM mask: top 0x%08x -> 0x%08x, bottom 0x%08x -> 0x%08x\n",
+             top[0], top[1], bottom[0], bottom[1]);
+      if (top[0] == top[1] || bottom[0] == bottom[1])
+        {
+          fprintf(stderr, "error: SAM mask did not follow the new payload\n");
+          return 1;
+        }
+    }
   printf("\n");
   printf("========================================\n");
   printf("✅ Test complete!\n");
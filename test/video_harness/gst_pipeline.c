@@ -54,18 +54,116 @@ bus_callback (GstBus *bus, GstMessage *message, gpointer data)
   return TRUE;
 }
 
+// Overlay mode: compositor mixes the RGBA overlay onto the background
+static bool
+link_overlay (gst_pipeline_t *ctx)
+{
+  // Add elements to pipeline
+  gst_bin_add_many (GST_BIN (ctx->pipeline), ctx->videotestsrc,
+                    ctx->capsfilter, ctx->appsrc, ctx->mixer,
+                    ctx->videoconvert, ctx->videoscale, ctx->encoder,
+                    ctx->muxer, ctx->filesink, NULL);
+
+  // Link pipeline:
+  // videotestsrc → capsfilter → mixer sink_0 (background)
+  // appsrc → mixer sink_1 (overlay with alpha)
+  // mixer → videoconvert → videoscale → encoder → muxer → filesink
+
+  // Link background: videotestsrc → capsfilter → mixer sink pad 0
+  if (!gst_element_link (ctx->videotestsrc, ctx->capsfilter))
+    {
+      g_printerr (
+        "[GST_PIPELINE] Failed to link videotestsrc to capsfilter\n");
+      return false;
+    }
+
+  GstPad *mixer_sink0 = gst_element_request_pad_simple (ctx->mixer, "sink_0");
+  GstPad *capsfilter_src = gst_element_get_static_pad (ctx->capsfilter, "src");
+  if (gst_pad_link (capsfilter_src, mixer_sink0) != GST_PAD_LINK_OK)
+    {
+      g_printerr ("[GST_PIPELINE] Failed to link capsfilter to mixer\n");
+      gst_object_unref (capsfilter_src);
+      gst_object_unref (mixer_sink0);
+      return false;
+    }
+  gst_object_unref (capsfilter_src);
+  gst_object_unref (mixer_sink0);
+
+  // Link overlay: appsrc → mixer sink pad 1 (with alpha blending)
+  GstPad *mixer_sink1 = gst_element_request_pad_simple (ctx->mixer, "sink_1");
+  g_object_set (mixer_sink1, "alpha", 1.0, NULL); // Full alpha from source
+  GstPad *appsrc_src = gst_element_get_static_pad (ctx->appsrc, "src");
+  if (gst_pad_link (appsrc_src, mixer_sink1) != GST_PAD_LINK_OK)
+    {
+      g_printerr ("[GST_PIPELINE] Failed to link appsrc to mixer\n");
+      gst_object_unref (appsrc_src);
+      gst_object_unref (mixer_sink1);
+      return false;
+    }
+  gst_object_unref (appsrc_src);
+  gst_object_unref (mixer_sink1);
+
+  // Link post-mixer: mixer → videoconvert → videoscale → encoder → muxer → filesink
+  // Force I420 format before encoding (ensures standard H.264 profile, not 4:4:4)
+  GstCaps *i420_caps = gst_caps_new_simple (
+    "video/x-raw", "format", G_TYPE_STRING, "I420", NULL);
+
+  if (!gst_element_link_many (ctx->mixer, ctx->videoconvert, ctx->videoscale, NULL))
+    {
+      g_printerr ("[GST_PIPELINE] Failed to link mixer → videoconvert → videoscale\n");
+      gst_caps_unref (i420_caps);
+      return false;
+    }
+
+  if (!gst_element_link_filtered (ctx->videoscale, ctx->encoder, i420_caps))
+    {
+      g_printerr ("[GST_PIPELINE] Failed to link videoscale → encoder with I420 filter\n");
+      gst_caps_unref (i420_caps);
+      return false;
+    }
+  gst_caps_unref (i420_caps);
+
+  if (!gst_element_link_many (ctx->encoder, ctx->muxer, ctx->filesink, NULL))
+    {
+      g_printerr ("[GST_PIPELINE] Failed to link encoder → muxer → filesink\n");
+      return false;
+    }
+
+  return true;
+}
+
+// Direct YUV mode: finished I420 frames go straight to the encoder
+static bool
+link_direct_yuv (gst_pipeline_t *ctx)
+{
+  gst_bin_add_many (GST_BIN (ctx->pipeline), ctx->appsrc, ctx->encoder,
+                    ctx->muxer, ctx->filesink, NULL);
+
+  if (!gst_element_link_many (ctx->appsrc, ctx->encoder, ctx->muxer,
+                              ctx->filesink, NULL))
+    {
+      g_printerr ("[GST_PIPELINE] Failed to link appsrc → encoder → muxer "
+                  "→ filesink\n");
+      return false;
+    }
+  return true;
+}
+
 gst_pipeline_t *
 gst_pipeline_create (uint32_t width,
                       uint32_t height,
                       uint32_t fps,
                       uint32_t num_frames,
-                      const char *output_file)
+                      const char *output_file,
+                      bool direct_yuv)
 {
   g_print ("[GST_PIPELINE] Creating pipeline\n");
   g_print ("[GST_PIPELINE]   Resolution: %ux%u\n", width, height);
   g_print ("[GST_PIPELINE]   FPS: %u\n", fps);
   g_print ("[GST_PIPELINE]   Frames: %u\n", num_frames);
   g_print ("[GST_PIPELINE]   Output: %s\n", output_file);
+  g_print ("[GST_PIPELINE]   Compositing: %s\n",
+           direct_yuv ? "direct YUV (module)" : "compositor");
 
   gst_pipeline_t *ctx = g_malloc0 (sizeof (gst_pipeline_t));
   if (!ctx)
@@ -80,55 +178,75 @@ gst_pipeline_create (uint32_t width,
   ctx->output_file = g_strdup (output_file);
   ctx->frame_count = 0;
 
+  // GStreamer's default I420 layout: planes back to back, rows padded to
+  // 4 bytes
+  ctx->direct_yuv = direct_yuv;
+  ctx->y_stride = GST_ROUND_UP_4 (width);
+  ctx->uv_stride = GST_ROUND_UP_4 ((width + 1) / 2);
+  ctx->frame_size = direct_yuv ? (size_t)ctx->y_stride * height
+                                   + 2 * (size_t)ctx->uv_stride
+                                       * ((height + 1) / 2)
+                               : (size_t)width * height * 4; // RGBA
+
   // Initialize GStreamer
   gst_init (NULL, NULL);
 
   // Create pipeline
   ctx->pipeline = gst_pipeline_new ("video-encoder");
 
-  // Create elements
-  ctx->videotestsrc = gst_element_factory_make ("videotestsrc", "background");
-  ctx->capsfilter = gst_element_factory_make ("capsfilter", "capsfilter");
+  // Create elements (direct YUV frames need no background, mixer or
+  // conversion)
   ctx->appsrc = gst_element_factory_make ("appsrc", "source");
-  ctx->mixer = gst_element_factory_make ("compositor", "mixer");
-  ctx->videoconvert
-    = gst_element_factory_make ("videoconvert", "videoconvert");
-  ctx->videoscale = gst_element_factory_make ("videoscale", "videoscale");
   ctx->encoder = gst_element_factory_make ("x264enc", "encoder");
   ctx->muxer = gst_element_factory_make ("mp4mux", "muxer");
   ctx->filesink = gst_element_factory_make ("filesink", "filesink");
+  if (!direct_yuv)
+    {
+      ctx->videotestsrc
+        = gst_element_factory_make ("videotestsrc", "background");
+      ctx->capsfilter = gst_element_factory_make ("capsfilter", "capsfilter");
+      ctx->mixer = gst_element_factory_make ("compositor", "mixer");
+      ctx->videoconvert
+        = gst_element_factory_make ("videoconvert", "videoconvert");
+      ctx->videoscale = gst_element_factory_make ("videoscale", "videoscale");
+    }
 
-  if (!ctx->videotestsrc || !ctx->capsfilter || !ctx->appsrc || !ctx->mixer
-      || !ctx->videoconvert || !ctx->videoscale || !ctx->encoder
-      || !ctx->muxer || !ctx->filesink)
+  if (!ctx->appsrc || !ctx->encoder || !ctx->muxer || !ctx->filesink
+      || (!direct_yuv
+          && (!ctx->videotestsrc || !ctx->capsfilter || !ctx->mixer
+              || !ctx->videoconvert || !ctx->videoscale)))
     {
       g_printerr ("[GST_PIPELINE] Failed to create elements\n");
       gst_pipeline_destroy (ctx);
       return NULL;
     }
 
-  // Configure videotestsrc (noise/static background at full resolution)
-  // Set num-buffers so it auto-sends EOS after exact frame count
-  g_object_set (G_OBJECT (ctx->videotestsrc),
-                "pattern", 1,             // 1 = snow (static noise)
-                "is-live", FALSE,
-                "num-buffers", num_frames, // Auto-EOS after this many frames
-                NULL);
-
-  // Configure capsfilter to force videotestsrc to output at full resolution
-  GstCaps *bg_caps = gst_caps_new_simple (
-    "video/x-raw", "width", G_TYPE_INT, width, "height", G_TYPE_INT, height,
-    "framerate", GST_TYPE_FRACTION, fps, 1, NULL);
-  g_object_set (G_OBJECT (ctx->capsfilter), "caps", bg_caps, NULL);
-  gst_caps_unref (bg_caps);
+  if (!direct_yuv)
+    {
+      // Configure videotestsrc (noise/static background at full resolution)
+      // Set num-buffers so it auto-sends EOS after exact frame count
+      g_object_set (G_OBJECT (ctx->videotestsrc),
+                    "pattern", 1,             // 1 = snow (static noise)
+                    "is-live", FALSE,
+                    "num-buffers", num_frames, // Auto-EOS after this many frames
+                    NULL);
+
+      // Configure capsfilter to force videotestsrc to output at full resolution
+      GstCaps *bg_caps = gst_caps_new_simple (
+        "video/x-raw", "width", G_TYPE_INT, width, "height", G_TYPE_INT,
+        height, "framerate", GST_TYPE_FRACTION, fps, 1, NULL);
+      g_object_set (G_OBJECT (ctx->capsfilter), "caps", bg_caps, NULL);
+      gst_caps_unref (bg_caps);
+    }
 
   // Configure appsrc
   // Our framebuffer format: uint32_t 0xAABBGGRR = [RR, GG, BB, AA] in memory (little-endian)
-  // This is RGBA byte order (standard format for WebGL2 and GStreamer)
+  // This is RGBA byte order (standard format for WebGL2 and GStreamer);
+  // direct YUV frames are I420
   GstCaps *caps = gst_caps_new_simple (
-    "video/x-raw", "format", G_TYPE_STRING, "RGBA", "width", G_TYPE_INT,
-    width, "height", G_TYPE_INT, height, "framerate", GST_TYPE_FRACTION, fps,
-    1, NULL);
+    "video/x-raw", "format", G_TYPE_STRING, direct_yuv ? "I420" : "RGBA",
+    "width", G_TYPE_INT, width, "height", G_TYPE_INT, height, "framerate",
+    GST_TYPE_FRACTION, fps, 1, NULL);
 
   g_object_set (G_OBJECT (ctx->appsrc), "caps", caps, "format",
                 GST_FORMAT_TIME, "is-live", FALSE, "block", FALSE, NULL);
@@ -150,79 +268,9 @@ gst_pipeline_create (uint32_t width,
   // Configure filesink
   g_object_set (G_OBJECT (ctx->filesink), "location", output_file, NULL);
 
-  // Add elements to pipeline
-  gst_bin_add_many (GST_BIN (ctx->pipeline), ctx->videotestsrc,
-                    ctx->capsfilter, ctx->appsrc, ctx->mixer,
-                    ctx->videoconvert, ctx->videoscale, ctx->encoder,
-                    ctx->muxer, ctx->filesink, NULL);
-
-  // Link pipeline:
-  // videotestsrc → capsfilter → mixer sink_0 (background)
-  // appsrc → mixer sink_1 (overlay with alpha)
-  // mixer → videoconvert → videoscale → encoder → muxer → filesink
-
-  // Link background: videotestsrc → capsfilter → mixer sink pad 0
-  if (!gst_element_link (ctx->videotestsrc, ctx->capsfilter))
-    {
-      g_printerr (
-        "[GST_PIPELINE] Failed to link videotestsrc to capsfilter\n");
-      gst_pipeline_destroy (ctx);
-      return NULL;
-    }
-
-  GstPad *mixer_sink0 = gst_element_request_pad_simple (ctx->mixer, "sink_0");
-  GstPad *capsfilter_src = gst_element_get_static_pad (ctx->capsfilter, "src");
-  if (gst_pad_link (capsfilter_src, mixer_sink0) != GST_PAD_LINK_OK)
+  // Add and link elements
+  if (!(direct_yuv ? link_direct_yuv (ctx) : link_overlay (ctx)))
     {
-      g_printerr ("[GST_PIPELINE] Failed to link capsfilter to mixer\n");
-      gst_object_unref (capsfilter_src);
-      gst_object_unref (mixer_sink0);
-      gst_pipeline_destroy (ctx);
-      return NULL;
-    }
-  gst_object_unref (capsfilter_src);
-  gst_object_unref (mixer_sink0);
-
-  // Link overlay: appsrc → mixer sink pad 1 (with alpha blending)
-  GstPad *mixer_sink1 = gst_element_request_pad_simple (ctx->mixer, "sink_1");
-  g_object_set (mixer_sink1, "alpha", 1.0, NULL); // Full alpha from source
-  GstPad *appsrc_src = gst_element_get_static_pad (ctx->appsrc, "src");
-  if (gst_pad_link (appsrc_src, mixer_sink1) != GST_PAD_LINK_OK)
-    {
-      g_printerr ("[GST_PIPELINE] Failed to link appsrc to mixer\n");
-      gst_object_unref (appsrc_src);
-      gst_object_unref (mixer_sink1);
-      gst_pipeline_destroy (ctx);
-      return NULL;
-    }
-  gst_object_unref (appsrc_src);
-  gst_object_unref (mixer_sink1);
-
-  // Link post-mixer: mixer → videoconvert → videoscale → encoder → muxer → filesink
-  // Force I420 format before encoding (ensures standard H.264 profile, not 4:4:4)
-  GstCaps *i420_caps = gst_caps_new_simple (
-    "video/x-raw", "format", G_TYPE_STRING, "I420", NULL);
-
-  if (!gst_element_link_many (ctx->mixer, ctx->videoconvert, ctx->videoscale, NULL))
-    {
-      g_printerr ("[GST_PIPELINE] Failed to link mixer → videoconvert → videoscale\n");
-      gst_caps_unref (i420_caps);
-      gst_pipeline_destroy (ctx);
-      return NULL;
-    }
-
-  if (!gst_element_link_filtered (ctx->videoscale, ctx->encoder, i420_caps))
-    {
-      g_printerr ("[GST_PIPELINE] Failed to link videoscale → encoder with I420 filter\n");
-      gst_caps_unref (i420_caps);
-      gst_pipeline_destroy (ctx);
-      return NULL;
-    }
-  gst_caps_unref (i420_caps);
-
-  if (!gst_element_link_many (ctx->encoder, ctx->muxer, ctx->filesink, NULL))
-    {
-      g_printerr ("[GST_PIPELINE] Failed to link encoder → muxer → filesink\n");
       gst_pipeline_destroy (ctx);
       return NULL;
     }
@@ -279,13 +327,13 @@ gst_pipeline_start (gst_pipeline_t *pipeline)
 
 bool
 gst_pipeline_push_frame (gst_pipeline_t *pipeline,
-                          const uint8_t *rgba_data,
+                          const uint8_t *frame_data,
                           uint64_t timestamp)
 {
-  if (!pipeline || !rgba_data)
+  if (!pipeline || !frame_data)
     return false;
 
-  size_t frame_size = pipeline->width * pipeline->height * 4; // RGBA
+  size_t frame_size = pipeline->frame_size;
 
   // Create GStreamer buffer
   GstBuffer *buffer = gst_buffer_new_allocate (NULL, frame_size, NULL);
@@ -295,7 +343,7 @@ gst_pipeline_push_frame (gst_pipeline_t *pipeline,
       return false;
     }
 
-  // Copy RGBA data to buffer
+  // Copy frame data to buffer
   GstMapInfo map;
   if (!gst_buffer_map (buffer, &map, GST_MAP_WRITE))
     {
@@ -304,7 +352,7 @@ gst_pipeline_push_frame (gst_pipeline_t *pipeline,
       return false;
     }
 
-  memcpy (map.data, rgba_data, frame_size);
+  memcpy (map.data, frame_data, frame_size);
   gst_buffer_unmap (buffer, &map);
 
   // Set buffer timestamp
@@ -341,7 +389,8 @@ gst_pipeline_finish (gst_pipeline_t *pipeline)
   g_print ("[GST_PIPELINE] Finishing pipeline (total frames: %lu)\n",
            pipeline->frame_count);
 
-  // Send EOS on appsrc (videotestsrc already sent EOS via num-buffers)
+  // Send EOS on appsrc (videotestsrc, if any, already sent EOS via
+  // num-buffers)
   GstFlowReturn eos_ret;
   g_signal_emit_by_name (pipeline->appsrc, "end-of-stream", &eos_ret);
 
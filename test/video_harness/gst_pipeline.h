@@ -4,6 +4,12 @@
  *
  * Creates appsrc → encoder → filesink pipeline for OSD testing.
  * Based on jettison appsrc_osd architecture.
+ *
+ * Two compositing modes:
+ * - Overlay: the RGBA framebuffer is mixed onto a videotestsrc background
+ *   by compositor, and the whole frame converted to I420 for encoding.
+ * - Direct YUV: the host pushes finished I420 frames, with the overlay
+ *   already burned in by the module (wasm_osd_blend_yuv()).
  */
 
 #ifndef GST_PIPELINE_H
@@ -12,6 +18,7 @@
 #include <gst/app/gstappsrc.h>
 #include <gst/gst.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // Video pipeline context
@@ -35,6 +42,12 @@ typedef struct
   uint32_t fps;
   const char *output_file;
 
+  // Frames pushed to appsrc
+  bool direct_yuv;    // I420 frames instead of the RGBA overlay
+  uint32_t y_stride;  // I420 luma row bytes (direct YUV only)
+  uint32_t uv_stride; // I420 chroma row bytes (direct YUV only)
+  size_t frame_size;  // Bytes per pushed frame
+
   // State
   GMainLoop *loop;
   bool is_playing;
@@ -49,18 +62,26 @@ typedef struct
  *   appsrc (OSD overlay) → mixer sink_1
  *   mixer → videoconvert → videoscale → x264enc → mp4mux → filesink
  *
+ * Direct YUV pipeline:
+ *   appsrc (I420, overlay burned in) → x264enc → mp4mux → filesink
+ *
+ * I420 frames use GStreamer's default layout: Y, U and V planes back to
+ * back, rows padded to 4 bytes (y_stride, uv_stride).
+ *
  * @param width Video width
  * @param height Video height
  * @param fps Frames per second
  * @param num_frames Total number of frames (videotestsrc will auto-EOS after this)
  * @param output_file Output MP4 file path
+ * @param direct_yuv Push I420 frames instead of the RGBA overlay
  * @return Initialized pipeline, or NULL on error
  */
 gst_pipeline_t *gst_pipeline_create (uint32_t width,
                                       uint32_t height,
                                       uint32_t fps,
                                       uint32_t num_frames,
-                                      const char *output_file);
+                                      const char *output_file,
+                                      bool direct_yuv);
 
 /**
  * Start pipeline playback
@@ -71,15 +92,16 @@ gst_pipeline_t *gst_pipeline_create (uint32_t width,
 bool gst_pipeline_start (gst_pipeline_t *pipeline);
 
 /**
- * Push RGBA frame to pipeline
+ * Push a frame to pipeline
  *
  * @param pipeline Pipeline context
- * @param rgba_data RGBA frame data (width × height × 4 bytes)
+ * @param frame_data RGBA overlay (width × height × 4 bytes), or the I420
+ *                   frame in direct YUV mode (pipeline->frame_size bytes)
  * @param timestamp Frame timestamp in nanoseconds
  * @return true on success, false on error
  */
 bool gst_pipeline_push_frame (gst_pipeline_t *pipeline,
-                               const uint8_t *rgba_data,
+                               const uint8_t *frame_data,
                                uint64_t timestamp);
 
 /**
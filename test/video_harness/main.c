@@ -8,6 +8,10 @@
  * 3. Creating GStreamer pipeline (noise/static background + OSD overlay)
  * 4. Generating synthetic protobuf states
  * 5. Rendering frames and encoding to MP4
+ *
+ * Recording variants composite like a recorder would: the noise frames are
+ * I420, generated here, and the module burns the OSD into them in place
+ * (wasm_osd_blend_yuv()) before they go to the encoder.
  */
 
 #include "config_validator.h"
@@ -18,6 +22,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <time.h>
 
 // Variant configuration
 typedef struct
@@ -28,6 +33,7 @@ typedef struct
   const char *output_path;
   uint32_t width;
   uint32_t height;
+  bool direct_yuv; // Module blends into I420 frames (no compositor)
 } variant_config_t;
 
 static const variant_config_t VARIANTS[] = {
@@ -48,13 +54,15 @@ static const variant_config_t VARIANTS[] = {
     .config_path = "../../resources/recording_day.json",
     .output_path = "../output/recording_day.mp4",
     .width = 1920,
-    .height = 1080 },
+    .height = 1080,
+    .direct_yuv = true },
   { .name = "recording_thermal",
     .wasm_path = "../../build/recording_thermal.wasm",
     .config_path = "../../resources/recording_thermal.json",
     .output_path = "../output/recording_thermal.mp4",
     .width = 900,
-    .height = 720 },
+    .height = 720,
+    .direct_yuv = true },
 };
 
 #define NUM_VARIANTS (sizeof (VARIANTS) / sizeof (VARIANTS[0]))
@@ -74,6 +82,35 @@ ensure_output_directory (void)
     }
 }
 
+static uint64_t
+now_us (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+// Fill an I420 frame with luma snow on neutral chroma (what videotestsrc
+// pattern=snow gives the overlay path)
+static void
+fill_noise_i420 (uint8_t *frame,
+                 const gst_pipeline_t *pipeline,
+                 uint32_t *seed)
+{
+  size_t luma_size = (size_t)pipeline->y_stride * pipeline->height;
+  uint32_t x = *seed;
+
+  for (size_t i = 0; i < luma_size; i++)
+    {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      frame[i] = (uint8_t)(x >> 24);
+    }
+  memset (frame + luma_size, 128, pipeline->frame_size - luma_size);
+  *seed = x;
+}
+
 static bool
 generate_video_for_variant (const variant_config_t *variant)
 {
@@ -119,7 +156,8 @@ generate_video_for_variant (const variant_config_t *variant)
   printf ("[MAIN] Creating GStreamer pipeline\n");
   uint32_t num_frames = (uint32_t)(VIDEO_DURATION_SECONDS * VIDEO_FPS);
   pipeline = gst_pipeline_create (variant->width, variant->height, VIDEO_FPS,
-                                   num_frames, variant->output_path);
+                                   num_frames, variant->output_path,
+                                   variant->direct_yuv);
   if (!pipeline)
     {
       fprintf (stderr, "[MAIN] Failed to create pipeline\n");
@@ -149,6 +187,11 @@ generate_video_for_variant (const variant_config_t *variant)
   uint64_t timestamp = 0;
   uint64_t frame_duration_ns = 1000000000 / VIDEO_FPS;
   uint32_t frame_count = 0;
+  uint32_t rendered_frames = 0;
+  uint64_t total_update_us = 0;
+  uint64_t total_render_us = 0;
+  uint64_t total_blend_us = 0;
+  uint32_t noise_seed = 0x9E3779B9;
 
   while (synthetic_state_next_frame (state_gen))
     {
@@ -162,31 +205,46 @@ generate_video_for_variant (const variant_config_t *variant)
           goto cleanup;
         }
 
-      // Update WASM state
-      if (wasm_module_update_state (wasm, state_data, state_size) != 0)
+      // Update state and render in one call
+      osd_frame_result_t frame;
+      if (wasm_module_frame (wasm, state_data, state_size, &frame) != 0)
         {
-          fprintf (stderr, "[MAIN] Failed to update WASM state\n");
+          fprintf (stderr, "[MAIN] Failed to render frame\n");
           goto cleanup;
         }
+      total_update_us += frame.update_us;
+      total_render_us += frame.render_us;
+      rendered_frames += frame.changed ? 1 : 0;
 
-      // Get framebuffer pointer BEFORE rendering
-      uint8_t *framebuffer = wasm_module_get_framebuffer (wasm);
-      if (!framebuffer)
+      // Burn the OSD into the video frame, or leave that to the compositor
+      const uint8_t *frame_data = frame.framebuffer;
+      if (variant->direct_yuv)
         {
-          fprintf (stderr, "[MAIN] Failed to get framebuffer\n");
-          goto cleanup;
-        }
+          uint8_t *yuv = wasm_module_video_buffer (
+            wasm, (uint32_t)pipeline->frame_size);
+          if (!yuv)
+            {
+              fprintf (stderr, "[MAIN] Failed to get video buffer\n");
+              goto cleanup;
+            }
+          fill_noise_i420 (yuv, pipeline, &noise_seed);
 
-      // Render OSD (will be composited with checkerboard background by GStreamer)
-      int render_ret = wasm_module_render (wasm);
-      if (render_ret < 0)
-        {
-          fprintf (stderr, "[MAIN] Failed to render frame\n");
-          goto cleanup;
+          uint64_t blend_start = now_us ();
+          if (wasm_module_blend_i420 (wasm, pipeline->y_stride,
+                                      pipeline->uv_stride)
+              != 0)
+            {
+              fprintf (stderr, "[MAIN] Failed to blend frame\n");
+              goto cleanup;
+            }
+          total_blend_us += now_us () - blend_start;
+
+          frame_data = wasm_module_video_buffer (
+            wasm, (uint32_t)pipeline->frame_size);
         }
 
       // Push frame to GStreamer
-      if (!gst_pipeline_push_frame (pipeline, framebuffer, timestamp))
+      if (!gst_pipeline_push_frame (pipeline, frame_data, timestamp))
         {
           fprintf (stderr, "[MAIN] Failed to push frame\n");
           goto cleanup;
@@ -206,6 +264,18 @@ generate_video_for_variant (const variant_config_t *variant)
     }
 
   printf ("[MAIN] Rendered %u frames\n", frame_count);
+  if (frame_count > 0)
+    {
+      printf ("[MAIN] Module time per frame: update %.1f us, render %.1f us "
+              "(%u re-rendered)\n",
+              (double)total_update_us / frame_count,
+              (double)total_render_us / frame_count, rendered_frames);
+      if (variant->direct_yuv)
+        {
+          printf ("[MAIN] YUV burn-in per frame: %.1f us\n",
+                  (double)total_blend_us / frame_count);
+        }
+    }
 
   // 5. Finish pipeline
   printf ("[MAIN] Finalizing video...\n");
@@ -228,43 +228,80 @@ wasm_module_load (const char *wasm_path, uint32_t width, uint32_t height)
     }
   module->init_func = initialize_extern.of.func;
 
-  wasmtime_extern_t update_extern;
+  wasmtime_extern_t state_buffer_extern;
   if (!wasmtime_instance_export_get (module->context, &module->instance,
-                                      "wasm_osd_update_state",
-                                      strlen ("wasm_osd_update_state"),
-                                      &update_extern))
+                                      "wasm_osd_get_state_buffer",
+                                      strlen ("wasm_osd_get_state_buffer"),
+                                      &state_buffer_extern))
     {
       fprintf (stderr,
-               "[WASM_LOADER] wasm_osd_update_state export not found\n");
+               "[WASM_LOADER] wasm_osd_get_state_buffer export not found\n");
       free (module);
       return NULL;
     }
-  module->update_state_func = update_extern.of.func;
+  module->get_state_buffer_func = state_buffer_extern.of.func;
 
-  wasmtime_extern_t render_extern;
+  wasmtime_extern_t frame_extern;
   if (!wasmtime_instance_export_get (module->context, &module->instance,
-                                      "wasm_osd_render",
-                                      strlen ("wasm_osd_render"),
-                                      &render_extern))
+                                      "wasm_osd_frame",
+                                      strlen ("wasm_osd_frame"),
+                                      &frame_extern))
     {
-      fprintf (stderr, "[WASM_LOADER] wasm_osd_render export not found\n");
+      fprintf (stderr, "[WASM_LOADER] wasm_osd_frame export not found\n");
       free (module);
       return NULL;
     }
-  module->render_func = render_extern.of.func;
+  module->frame_func = frame_extern.of.func;
 
-  wasmtime_extern_t get_fb_extern;
+  wasmtime_extern_t video_buffer_extern;
   if (!wasmtime_instance_export_get (module->context, &module->instance,
-                                      "wasm_osd_get_framebuffer",
-                                      strlen ("wasm_osd_get_framebuffer"),
-                                      &get_fb_extern))
+                                      "wasm_osd_get_video_buffer",
+                                      strlen ("wasm_osd_get_video_buffer"),
+                                      &video_buffer_extern))
     {
       fprintf (stderr,
-               "[WASM_LOADER] wasm_osd_get_framebuffer export not found\n");
+               "[WASM_LOADER] wasm_osd_get_video_buffer export not found\n");
       free (module);
       return NULL;
     }
-  module->get_framebuffer_func = get_fb_extern.of.func;
+  module->get_video_buffer_func = video_buffer_extern.of.func;
+
+  wasmtime_extern_t blend_yuv_extern;
+  if (!wasmtime_instance_export_get (module->context, &module->instance,
+                                      "wasm_osd_blend_yuv",
+                                      strlen ("wasm_osd_blend_yuv"),
+                                      &blend_yuv_extern))
+    {
+      fprintf (stderr, "[WASM_LOADER] wasm_osd_blend_yuv export not found\n");
+      free (module);
+      return NULL;
+    }
+  module->blend_yuv_func = blend_yuv_extern.of.func;
+
+  // The frame info block never moves; look it up once
+  wasmtime_extern_t frame_info_extern;
+  if (!wasmtime_instance_export_get (module->context, &module->instance,
+                                      "wasm_osd_get_frame_info",
+                                      strlen ("wasm_osd_get_frame_info"),
+                                      &frame_info_extern))
+    {
+      fprintf (stderr,
+               "[WASM_LOADER] wasm_osd_get_frame_info export not found\n");
+      free (module);
+      return NULL;
+    }
+
+  wasmtime_val_t info_results[1];
+  trap = NULL;
+  error = wasmtime_func_call (module->context, &frame_info_extern.of.func,
+                              NULL, 0, info_results, 1, &trap);
+  if (error != NULL || trap != NULL)
+    {
+      exit_with_error ("wasm_osd_get_frame_info() failed", error, trap);
+      free (module);
+      return NULL;
+    }
+  module->frame_info_ptr = (uint32_t)info_results[0].of.i32;
 
   // Get memory export
   wasmtime_extern_t memory_extern;
@@ -318,99 +355,186 @@ wasm_module_init (osd_wasm_module_t *module)
   return 0;
 }
 
+// Layout of wasm_osd_frame_info_t (src/wasm/wasm_exports.h)
+typedef struct
+{
+  uint32_t framebuffer;
+  uint32_t width;
+  uint32_t height;
+  uint32_t changed;
+  int32_t state_result;
+  uint32_t dirty_x;
+  uint32_t dirty_y;
+  uint32_t dirty_width;
+  uint32_t dirty_height;
+  uint32_t update_us;
+  uint32_t render_us;
+  uint32_t frame_count;
+} wasm_frame_info_t;
+
 int
-wasm_module_update_state (osd_wasm_module_t *module,
-                          const uint8_t *state_data,
-                          uint32_t state_size)
+wasm_module_frame (osd_wasm_module_t *module,
+                   const uint8_t *state_data,
+                   uint32_t state_size,
+                   osd_frame_result_t *result)
 {
-  if (!module || !state_data)
+  if (!module || !state_data || !result)
     return -1;
 
-  // Calculate safe proto offset: after framebuffer
-  // Framebuffer is at framebuffer_ptr with size width*height*4
-  uint32_t fb_size = module->framebuffer_width * module->framebuffer_height * 4;
-  uint32_t fb_end = module->framebuffer_ptr + fb_size;
-
-  // Align to 64KB boundary after framebuffer
-  uint32_t proto_ptr = ((fb_end + 0xFFFF) & ~0xFFFF);
+  wasmtime_val_t args[4];
+  wasmtime_val_t results[1];
+  wasm_trap_t *trap = NULL;
+  wasmtime_error_t *error = NULL;
 
-  // Verify bounds
-  if (proto_ptr + state_size > module->memory_size)
+  // Ask the module for its input buffer (once, or when a larger state shows
+  // up) instead of guessing a free address in linear memory
+  if (module->state_buffer_ptr == 0
+      || state_size > module->state_buffer_capacity)
     {
-      fprintf (stderr, "[WASM_LOADER] State too large for WASM memory (need %u, have %zu)\n",
-               proto_ptr + state_size, module->memory_size);
-      return -1;
+      args[0].kind = WASMTIME_I32;
+      args[0].of.i32 = state_size;
+
+      error = wasmtime_func_call (module->context,
+                                  &module->get_state_buffer_func, args, 1,
+                                  results, 1, &trap);
+      if (error != NULL || trap != NULL)
+        {
+          exit_with_error ("wasm_osd_get_state_buffer() failed", error, trap);
+          return -1;
+        }
+
+      module->state_buffer_ptr = (uint32_t)results[0].of.i32;
+      if (module->state_buffer_ptr == 0)
+        {
+          fprintf (stderr,
+                   "[WASM_LOADER] State too large for module buffer (%u "
+                   "bytes)\n",
+                   state_size);
+          return -1;
+        }
+      module->state_buffer_capacity = state_size;
     }
 
-  memcpy (module->memory_data + proto_ptr, state_data, state_size);
+  // Refresh memory pointer (in case it grew)
+  module->memory_data
+    = wasmtime_memory_data (module->context, &module->memory);
 
-  // Call wasm_osd_update_state(proto_ptr, state_size)
-  wasmtime_val_t args[2];
+  // Single copy: host bytes straight into the buffer the module decodes
+  memcpy (module->memory_data + module->state_buffer_ptr, state_data,
+          state_size);
+
+  // Call wasm_osd_frame(state_ptr, state_size, 0, 0): decode, render and
+  // report through the module-owned info block in one transition
   args[0].kind = WASMTIME_I32;
-  args[0].of.i32 = proto_ptr;
+  args[0].of.i32 = (int32_t)module->state_buffer_ptr;
   args[1].kind = WASMTIME_I32;
-  args[1].of.i32 = state_size;
-
-  wasmtime_val_t results[1];
-  wasm_trap_t *trap = NULL;
-  wasmtime_error_t *error = wasmtime_func_call (
-    module->context, &module->update_state_func, args, 2, results, 1, &trap);
-
+  args[1].of.i32 = (int32_t)state_size;
+  args[2].kind = WASMTIME_I32;
+  args[2].of.i32 = 0;
+  args[3].kind = WASMTIME_I32;
+  args[3].of.i32 = 0;
+
+  error = wasmtime_func_call (module->context, &module->frame_func, args, 4,
+                              results, 1, &trap);
   if (error != NULL || trap != NULL)
     {
-      exit_with_error ("wasm_osd_update_state() failed", error, trap);
+      exit_with_error ("wasm_osd_frame() failed", error, trap);
       return -1;
     }
 
-  return results[0].of.i32;
+  // Rendering may have grown memory
+  module->memory_data
+    = wasmtime_memory_data (module->context, &module->memory);
+
+  wasm_frame_info_t info;
+  memcpy (&info, module->memory_data + module->frame_info_ptr, sizeof (info));
+
+  module->framebuffer_ptr = info.framebuffer;
+  result->framebuffer = module->memory_data + info.framebuffer;
+  result->changed = info.changed != 0;
+  result->dirty_x = info.dirty_x;
+  result->dirty_y = info.dirty_y;
+  result->dirty_width = info.dirty_width;
+  result->dirty_height = info.dirty_height;
+  result->update_us = info.update_us;
+  result->render_us = info.render_us;
+
+  return (results[0].of.i32 < 0) ? results[0].of.i32 : 0;
 }
 
-int
-wasm_module_render (osd_wasm_module_t *module)
+uint8_t *
+wasm_module_video_buffer (osd_wasm_module_t *module, uint32_t frame_size)
 {
   if (!module)
-    return -1;
-
-  wasmtime_val_t results[1];
-  wasm_trap_t *trap = NULL;
-  wasmtime_error_t *error = wasmtime_func_call (
-    module->context, &module->render_func, NULL, 0, results, 1, &trap);
+    return NULL;
 
-  if (error != NULL || trap != NULL)
+  if (module->video_buffer_ptr == 0
+      || frame_size > module->video_buffer_capacity)
     {
-      exit_with_error ("wasm_osd_render() failed", error, trap);
-      return -1;
+      wasmtime_val_t args[1];
+      wasmtime_val_t results[1];
+      wasm_trap_t *trap = NULL;
+
+      args[0].kind = WASMTIME_I32;
+      args[0].of.i32 = (int32_t)frame_size;
+
+      wasmtime_error_t *error = wasmtime_func_call (
+        module->context, &module->get_video_buffer_func, args, 1, results,
+        1, &trap);
+      if (error != NULL || trap != NULL)
+        {
+          exit_with_error ("wasm_osd_get_video_buffer() failed", error, trap);
+          return NULL;
+        }
+
+      module->video_buffer_ptr = (uint32_t)results[0].of.i32;
+      if (module->video_buffer_ptr == 0)
+        {
+          fprintf (stderr,
+                   "[WASM_LOADER] No video buffer for %u-byte frames\n",
+                   frame_size);
+          return NULL;
+        }
+      module->video_buffer_capacity = frame_size;
     }
 
-  return results[0].of.i32;
+  // Refresh memory pointer (in case it grew)
+  module->memory_data
+    = wasmtime_memory_data (module->context, &module->memory);
+  return module->memory_data + module->video_buffer_ptr;
 }
 
-uint8_t *
-wasm_module_get_framebuffer (osd_wasm_module_t *module)
+int
+wasm_module_blend_i420 (osd_wasm_module_t *module,
+                        uint32_t y_stride,
+                        uint32_t uv_stride)
 {
-  if (!module)
-    return NULL;
+  if (!module || module->video_buffer_ptr == 0)
+    return -1;
 
-  // Call wasm_osd_get_framebuffer() to get pointer
+  // wasm_osd_blend_yuv(WASM_OSD_YUV_I420, frame_ptr, y_stride, uv_stride)
+  wasmtime_val_t args[4];
   wasmtime_val_t results[1];
   wasm_trap_t *trap = NULL;
-  wasmtime_error_t *error
-    = wasmtime_func_call (module->context, &module->get_framebuffer_func,
-                          NULL, 0, results, 1, &trap);
 
+  args[0].kind = WASMTIME_I32;
+  args[0].of.i32 = 1;
+  args[1].kind = WASMTIME_I32;
+  args[1].of.i32 = (int32_t)module->video_buffer_ptr;
+  args[2].kind = WASMTIME_I32;
+  args[2].of.i32 = (int32_t)y_stride;
+  args[3].kind = WASMTIME_I32;
+  args[3].of.i32 = (int32_t)uv_stride;
+
+  wasmtime_error_t *error = wasmtime_func_call (
+    module->context, &module->blend_yuv_func, args, 4, results, 1, &trap);
   if (error != NULL || trap != NULL)
     {
-      exit_with_error ("wasm_osd_get_framebuffer() failed", error, trap);
-      return NULL;
+      exit_with_error ("wasm_osd_blend_yuv() failed", error, trap);
+      return -1;
     }
 
-  module->framebuffer_ptr = results[0].of.i32;
-
-  // Refresh memory pointer (in case it grew)
-  module->memory_data
-    = wasmtime_memory_data (module->context, &module->memory);
-
-  return module->memory_data + module->framebuffer_ptr;
+  return results[0].of.i32;
 }
 
 void
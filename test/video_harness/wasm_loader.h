@@ -26,9 +26,10 @@ typedef struct
 
   // Exported functions
   wasmtime_func_t init_func;
-  wasmtime_func_t update_state_func;
-  wasmtime_func_t render_func;
-  wasmtime_func_t get_framebuffer_func;
+  wasmtime_func_t get_state_buffer_func;
+  wasmtime_func_t frame_func;
+  wasmtime_func_t get_video_buffer_func;
+  wasmtime_func_t blend_yuv_func;
   wasmtime_func_t destroy_func;
 
   // Memory access
@@ -36,12 +37,36 @@ typedef struct
   uint8_t *memory_data;
   size_t memory_size;
 
+  // State input buffer (owned by the module)
+  uint32_t state_buffer_ptr;
+  uint32_t state_buffer_capacity; // Largest capacity requested so far
+
+  // Video frame buffer for direct YUV compositing (owned by the module)
+  uint32_t video_buffer_ptr;
+  uint32_t video_buffer_capacity;
+
+  // Module-owned wasm_osd_frame_info_t block
+  uint32_t frame_info_ptr;
+
   // Framebuffer info
   uint32_t framebuffer_ptr;
   uint32_t framebuffer_width;
   uint32_t framebuffer_height;
 } osd_wasm_module_t;
 
+// Result of one wasm_osd_frame() call
+typedef struct
+{
+  uint8_t *framebuffer; // RGBA framebuffer in WASM memory
+  bool changed;         // Framebuffer was re-rendered
+  uint32_t dirty_x;     // Region that differs from the previous frame
+  uint32_t dirty_y;
+  uint32_t dirty_width;
+  uint32_t dirty_height;
+  uint32_t update_us;   // Time spent decoding the state (module clock)
+  uint32_t render_us;   // Time spent rendering (module clock)
+} osd_frame_result_t;
+
 /**
  * Load WASM module from file
  *
@@ -63,34 +88,52 @@ osd_wasm_module_t *wasm_module_load (const char *wasm_path,
 int wasm_module_init (osd_wasm_module_t *module);
 
 /**
- * Call wasm_osd_update_state()
+ * Write state into the module's state buffer and call wasm_osd_frame()
+ *
+ * One host call per frame: the module decodes the state, renders and
+ * reports the framebuffer location, dirty region and timing. The buffer
+ * is (re)queried with wasm_osd_get_state_buffer() whenever a state larger
+ * than any previous one arrives.
  *
  * @param module WASM module
  * @param state_data Protobuf state bytes
  * @param state_size Size of state data
+ * @param result Filled with the frame result
  * @return 0 on success, non-zero on error
  */
-int wasm_module_update_state (osd_wasm_module_t *module,
-                               const uint8_t *state_data,
-                               uint32_t state_size);
+int wasm_module_frame (osd_wasm_module_t *module,
+                       const uint8_t *state_data,
+                       uint32_t state_size,
+                       osd_frame_result_t *result);
 
 /**
- * Call wasm_osd_render()
+ * Get the module's video frame buffer (wasm_osd_get_video_buffer())
+ *
+ * The buffer is (re)requested only when frame_size exceeds what was asked
+ * for before. The returned pointer is into WASM memory and is invalidated
+ * by anything that grows it: get it again after other module calls.
  *
  * @param module WASM module
- * @return 1 if rendered, 0 if skipped, negative on error
+ * @param frame_size Bytes of the video frames to be written
+ * @return Host pointer to the buffer, or NULL on error
  */
-int wasm_module_render (osd_wasm_module_t *module);
+uint8_t *wasm_module_video_buffer (osd_wasm_module_t *module,
+                                   uint32_t frame_size);
 
 /**
- * Get framebuffer pointer
+ * Burn the last rendered frame into the I420 frame in the video buffer
  *
- * Returns pointer to RGBA framebuffer in WASM memory.
+ * Calls wasm_osd_blend_yuv(); the planes follow each other in the buffer
+ * (GStreamer's default I420 layout).
  *
  * @param module WASM module
- * @return Pointer to framebuffer, or NULL on error
+ * @param y_stride Bytes per luma row
+ * @param uv_stride Bytes per chroma row
+ * @return 0 on success, non-zero on error
  */
-uint8_t *wasm_module_get_framebuffer (osd_wasm_module_t *module);
+int wasm_module_blend_i420 (osd_wasm_module_t *module,
+                            uint32_t y_stride,
+                            uint32_t uv_stride);
 
 /**
  * Cleanup and free WASM module
@@ -90,10 +90,15 @@ case "$BUILD_MODE" in
     # Note: UBSan still not available in WASI SDK 29 (missing runtime library)
     HARDENING_FLAGS="-D_FORTIFY_SOURCE=2 -fstack-protector-strong"
 
+    # Dev builds may decode PNG nav ball skins at runtime when no pre-decoded
+    # .nbskin blob is available (production ships blobs only)
+    HARDENING_FLAGS="$HARDENING_FLAGS -DNAVBALL_PNG_FALLBACK"
+
     echo "  + Optimization: -O1 (debug-friendly)"
     echo "  + Debug symbols: -g"
     echo "  + Buffer overflow detection: _FORTIFY_SOURCE=2"
     echo "  + Stack canaries: stack-protector-strong"
+    echo "  + PNG skin fallback: NAVBALL_PNG_FALLBACK"
     echo ""
     echo "  ⚠️  This build will TRAP on buffer overflows!"
     echo ""
@@ -174,6 +179,25 @@ PROTO_FILES=$(find src/proto -name "*.c" 2>/dev/null || true)
 # Find vendor files (excluding test directories)
 VENDOR_FILES=$(find vendor -name "*.c" -not -path "*/test/*" -not -path "*/docs/*" 2>/dev/null || true)
 
+# Ephemeris source for sun/moon indicators:
+#   engine (default) - precomputed table when available, Astronomy Engine otherwise
+#   table            - precomputed table only; Astronomy Engine is not linked
+EPHEMERIS="${EPHEMERIS:-engine}"
+EPHEMERIS_DEFINES=""
+case "$EPHEMERIS" in
+  engine) ;;
+  table)
+    echo "Ephemeris: precomputed table only (Astronomy Engine omitted)"
+    EPHEMERIS_DEFINES="-DCELESTIAL_TABLE_ONLY"
+    VENDOR_FILES=$(echo "$VENDOR_FILES" | grep -v "astronomy.c" || true)
+    ;;
+  *)
+    echo "❌ Unknown ephemeris source: $EPHEMERIS"
+    echo "Valid sources: engine, table"
+    exit 1
+    ;;
+esac
+
 # Compile main source files
 OBJECT_FILES=""
 for c_file in $C_FILES; do
@@ -202,6 +226,7 @@ for c_file in $C_FILES; do
     -DWASI_BUILD \
     $VARIANT_DEFINES \
     $VERSION_DEFINES \
+    $EPHEMERIS_DEFINES \
     -c "$c_file" \
     -o "$obj_file"
 
@@ -0,0 +1,294 @@
+// Sun/Moon Ephemeris Table Generator
+// Fits piecewise Chebyshev polynomials to Astronomy Engine output and writes
+// the table evaluated by celestial_position.c
+// (format: src/utils/ephemeris_table.h)
+//
+// Usage: ephem_gen <start YYYY-MM-DD> <days> <output.bin>
+//
+// Built natively by `make ephemeris`; package.sh ships the resulting table.
+// After fitting, every segment is re-checked against the Astronomy Engine
+// between the fit nodes and generation fails if the worst direction error
+// exceeds EPHEM_MAX_ERROR_ARCSEC.
+
+#include "astronomy.h"
+#include "utils/ephemeris_table.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Error budget for the fit alone (runtime target is ±1 arcminute overall)
+#define EPHEM_MAX_ERROR_ARCSEC 5.0
+
+// Verification samples per segment (placed between the fit nodes)
+#define EPHEM_CHECK_SAMPLES 64
+
+#define EPHEM_PI 3.14159265358979323846
+#define RAD2DEG_D (180.0 / EPHEM_PI)
+
+typedef struct
+{
+  const char *name;
+  uint32_t components;
+  uint32_t coeffs;
+  double segment_days;
+} channel_spec_t;
+
+// Segment lengths/orders chosen so each channel fits well inside the budget
+static const channel_spec_t g_specs[EPHEMERIS_CHANNEL_COUNT] = {
+  [EPHEMERIS_CHANNEL_SUN]      = { "sun", 3, 8, 32.0 },
+  [EPHEMERIS_CHANNEL_MOON]     = { "moon", 3, 10, 8.0 },
+  [EPHEMERIS_CHANNEL_SIDEREAL] = { "sidereal", 1, 6, 32.0 },
+};
+
+// Earth Rotation Angle in degrees (same expression as celestial_position.c)
+static double
+earth_rotation_angle(double ut)
+{
+  double theta
+    = 360.0 * fmod(0.7790572732640 + 0.00273781191135448 * ut + fmod(ut, 1.0),
+                   1.0);
+  return (theta < 0.0) ? theta + 360.0 : theta;
+}
+
+// Evaluate one channel at UT days since J2000
+static bool
+sample_channel(int channel, double ut, double out[3])
+{
+  astro_time_t time = Astronomy_TimeFromDays(ut);
+
+  if (channel == EPHEMERIS_CHANNEL_SIDEREAL)
+    {
+      double diff = 15.0 * Astronomy_SiderealTime(&time)
+                    - earth_rotation_angle(ut);
+      out[0] = diff - 360.0 * floor((diff + 180.0) / 360.0);
+      return true;
+    }
+
+  astro_body_t body = (channel == EPHEMERIS_CHANNEL_SUN) ? BODY_SUN : BODY_MOON;
+  astro_vector_t j2000 = Astronomy_GeoVector(body, time, ABERRATION);
+  if (j2000.status != ASTRO_SUCCESS)
+    return false;
+
+  astro_vector_t of_date = Astronomy_RotateVector(
+    Astronomy_Rotation_EQJ_EQD(&time), j2000);
+
+  out[0] = of_date.x;
+  out[1] = of_date.y;
+  out[2] = of_date.z;
+  return true;
+}
+
+// Chebyshev series (c[0] already halved) at x in [-1, 1], Clenshaw recurrence
+static double
+chebyshev_eval(const float *c, uint32_t n, double x)
+{
+  double b1 = 0.0, b2 = 0.0;
+  for (uint32_t j = n - 1; j > 0; j--)
+    {
+      double b0 = 2.0 * x * b1 - b2 + c[j];
+      b2        = b1;
+      b1        = b0;
+    }
+  return x * b1 - b2 + c[0];
+}
+
+// Angle between two vectors in arcseconds
+static double
+separation_arcsec(const double a[3], const double b[3])
+{
+  double cx = a[1] * b[2] - a[2] * b[1];
+  double cy = a[2] * b[0] - a[0] * b[2];
+  double cz = a[0] * b[1] - a[1] * b[0];
+  double d  = a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+  return atan2(sqrt(cx * cx + cy * cy + cz * cz), d) * RAD2DEG_D * 3600.0;
+}
+
+// Fit one segment: interpolate at Chebyshev nodes, store c[0] halved
+static bool
+fit_segment(int channel, double seg_start, float *out)
+{
+  const channel_spec_t *spec = &g_specs[channel];
+  uint32_t n                 = spec->coeffs;
+  double values[EPHEMERIS_MAX_COEFFS][3];
+
+  for (uint32_t k = 0; k < n; k++)
+    {
+      double x  = cos(EPHEM_PI * (k + 0.5) / n);
+      double ut = seg_start + 0.5 * (x + 1.0) * spec->segment_days;
+      if (!sample_channel(channel, ut, values[k]))
+        return false;
+    }
+
+  for (uint32_t comp = 0; comp < spec->components; comp++)
+    {
+      for (uint32_t j = 0; j < n; j++)
+        {
+          double sum = 0.0;
+          for (uint32_t k = 0; k < n; k++)
+            sum += values[k][comp] * cos(EPHEM_PI * j * (k + 0.5) / n);
+
+          double c            = 2.0 * sum / n;
+          out[comp * n + j] = (float)((j == 0) ? 0.5 * c : c);
+        }
+    }
+
+  return true;
+}
+
+// Worst error of a fitted segment (arcsec; direction for bodies, angle for
+// the sidereal channel)
+static double
+check_segment(int channel, double seg_start, const float *coeffs)
+{
+  const channel_spec_t *spec = &g_specs[channel];
+  double worst               = 0.0;
+
+  for (int i = 0; i < EPHEM_CHECK_SAMPLES; i++)
+    {
+      double x  = -1.0 + 2.0 * (i + 0.37) / EPHEM_CHECK_SAMPLES;
+      double ut = seg_start + 0.5 * (x + 1.0) * spec->segment_days;
+
+      double ref[3], fit[3];
+      if (!sample_channel(channel, ut, ref))
+        return INFINITY;
+
+      for (uint32_t comp = 0; comp < spec->components; comp++)
+        fit[comp] = chebyshev_eval(coeffs + comp * spec->coeffs, spec->coeffs,
+                                   x);
+
+      double err = (spec->components == 3)
+                     ? separation_arcsec(ref, fit)
+                     : fabs(ref[0] - fit[0]) * 3600.0;
+      if (err > worst)
+        worst = err;
+    }
+
+  return worst;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int year, month, day, days;
+
+  if (argc != 4 || sscanf(argv[1], "%d-%d-%d", &year, &month, &day) != 3
+      || (days = atoi(argv[2])) <= 0)
+    {
+      fprintf(stderr, "usage: %s <start YYYY-MM-DD> <days> <output.bin>\n",
+              argv[0]);
+      return 1;
+    }
+
+  // Coefficients are written in host byte order; the format is little-endian
+  const uint16_t probe = 1;
+  if (*(const uint8_t *)&probe != 1)
+    {
+      fprintf(stderr, "error: big-endian hosts are not supported\n");
+      return 1;
+    }
+
+  ephemeris_table_header_t header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, EPHEMERIS_TABLE_MAGIC, 4);
+  header.version     = EPHEMERIS_TABLE_VERSION;
+  header.header_size = EPHEMERIS_TABLE_HEADER_SIZE;
+  header.start_ut    = Astronomy_MakeTime(year, month, day, 0, 0, 0.0).ut;
+  header.span_days   = (uint32_t)days;
+
+  size_t total_floats = 0;
+  for (int ch = 0; ch < EPHEMERIS_CHANNEL_COUNT; ch++)
+    {
+      const channel_spec_t *spec = &g_specs[ch];
+      ephemeris_channel_t *info  = &header.channels[ch];
+
+      info->components    = spec->components;
+      info->coeffs        = spec->coeffs;
+      info->segment_days  = spec->segment_days;
+      info->segment_count = (uint32_t)ceil(days / spec->segment_days);
+      info->offset        = (uint32_t)(EPHEMERIS_TABLE_HEADER_SIZE
+                                + total_floats * sizeof(float));
+
+      total_floats += (size_t)info->segment_count * spec->components
+                      * spec->coeffs;
+    }
+
+  float *data = (float *)calloc(total_floats, sizeof(float));
+  if (!data)
+    {
+      fprintf(stderr, "error: out of memory\n");
+      return 1;
+    }
+
+  bool ok = true;
+  for (int ch = 0; ok && ch < EPHEMERIS_CHANNEL_COUNT; ch++)
+    {
+      const channel_spec_t *spec = &g_specs[ch];
+      ephemeris_channel_t *info  = &header.channels[ch];
+      size_t stride              = spec->components * spec->coeffs;
+      float *base = data + (info->offset - EPHEMERIS_TABLE_HEADER_SIZE)
+                             / sizeof(float);
+      double worst = 0.0;
+
+      for (uint32_t seg = 0; seg < info->segment_count; seg++)
+        {
+          double seg_start = header.start_ut + seg * spec->segment_days;
+          float *coeffs    = base + seg * stride;
+
+          if (!fit_segment(ch, seg_start, coeffs))
+            {
+              fprintf(stderr, "error: %s: Astronomy Engine failed\n",
+                      spec->name);
+              ok = false;
+              break;
+            }
+
+          double err = check_segment(ch, seg_start, coeffs);
+          if (err > worst)
+            worst = err;
+        }
+
+      printf("  %-8s %4u segments × %4.1f d, order %2u: max error %.3f\"\n",
+             spec->name, info->segment_count, spec->segment_days,
+             spec->coeffs - 1, worst);
+
+      if (ok && worst > EPHEM_MAX_ERROR_ARCSEC)
+        {
+          fprintf(stderr, "error: %s fit error %.3f\" exceeds %.1f\"\n",
+                  spec->name, worst, EPHEM_MAX_ERROR_ARCSEC);
+          ok = false;
+        }
+    }
+
+  if (ok)
+    {
+      FILE *out = fopen(argv[3], "wb");
+      if (!out)
+        {
+          fprintf(stderr, "error: failed to create %s\n", argv[3]);
+          free(data);
+          return 1;
+        }
+
+      if (fwrite(&header, 1, sizeof(header), out) != sizeof(header)
+          || fwrite(data, sizeof(float), total_floats, out) != total_floats)
+        ok = false;
+      if (fclose(out) != 0)
+        ok = false;
+      if (!ok)
+        {
+          fprintf(stderr, "error: failed to write %s\n", argv[3]);
+          remove(argv[3]);
+        }
+    }
+  free(data);
+
+  if (!ok)
+    return 1;
+
+  printf("%s: %04d-%02d-%02d + %d days (%zu bytes)\n", argv[3], year, month,
+         day, days, sizeof(header) + total_floats * sizeof(float));
+  return 0;
+}
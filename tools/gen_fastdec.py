@@ -0,0 +1,808 @@
+#!/usr/bin/env python3
+"""Generate straight-line protobuf decoders from nanopb headers.
+
+nanopb's pb_decode() walks field descriptors at runtime for every message.
+For the messages the OSD decodes on every state update, this script emits
+one C function per message that switches directly on the field key
+(tag << 3 | wire type) and stores into the destination struct, so the
+compiler sees every field's type and offset.
+
+The field lists are read from the *_FIELDLIST X-macros in the nanopb
+headers, so the output tracks `make proto`. Decoding follows pb_decode()
+semantics exactly (defaults, overflow checks, callbacks, unknown fields);
+test/fastdec_test.c checks this by fuzzing both against each other.
+
+Usage:
+    tools/gen_fastdec.py <proto_dir> <out_basename> <root message>...
+
+    e.g. tools/gen_fastdec.py src/proto src/proto/pb_fastdec \\
+             ser_JonGUIState ser_CvMeta
+
+Writes <out_basename>.h and <out_basename>.c. Root messages get a public
+pbfast_decode_<name>() entry point; messages they contain as static
+submessages are decoded by internal functions.
+"""
+
+import os
+import re
+import sys
+
+FIELD_RE = re.compile(
+    r"X\(a,\s*(\w+),\s*(\w+),\s*(\w+),\s*(\([^)]*\)|\w+),\s*(\d+)\)")
+DEFINE_RE = re.compile(r"#define\s+(\w+)\s+(.*)")
+
+# ltype -> (wire type, decode helper, C type the helper writes)
+SCALARS = {
+    "BOOL": ("PB_WT_VARINT", "pbfast_bool", "bool"),
+    "INT32": ("PB_WT_VARINT", "pbfast_int32", "int32_t"),
+    "UINT32": ("PB_WT_VARINT", "pbfast_uint32", "uint32_t"),
+    "INT64": ("PB_WT_VARINT", "pbfast_int64", "int64_t"),
+    "UINT64": ("PB_WT_VARINT", "pbfast_uint64", "uint64_t"),
+    "SINT32": ("PB_WT_VARINT", "pbfast_sint32", "int32_t"),
+    "SINT64": ("PB_WT_VARINT", "pbfast_sint64", "int64_t"),
+    "ENUM": ("PB_WT_VARINT", "pbfast_int32", "int32_t"),
+    "UENUM": ("PB_WT_VARINT", "pbfast_uint32", "uint32_t"),
+    "FLOAT": ("PB_WT_32BIT", "pbfast_fixed32", None),
+    "FIXED32": ("PB_WT_32BIT", "pbfast_fixed32", None),
+    "SFIXED32": ("PB_WT_32BIT", "pbfast_fixed32", None),
+    "DOUBLE": ("PB_WT_64BIT", "pbfast_fixed64", None),
+    "FIXED64": ("PB_WT_64BIT", "pbfast_fixed64", None),
+    "SFIXED64": ("PB_WT_64BIT", "pbfast_fixed64", None),
+}
+
+ENUM_LTYPES = ("ENUM", "UENUM")
+
+
+def params_list(name, params):
+    """Function declarator with one parameter per line (clang-format GNU)."""
+    pad = " " * (len(name) + 1)
+    return name + "(" + (",\n" + pad).join(params) + ")"
+
+
+class Field:
+    def __init__(self, atype, htype, ltype, name, tag):
+        self.atype = atype
+        self.htype = htype
+        self.ltype = ltype
+        self.tag = int(tag)
+        if name.startswith("("):
+            # Oneof member: (union name, member name, access path)
+            union, member, path = [s.strip() for s in name[1:-1].split(",")]
+            self.union = union
+            self.name = member
+            self.path = path
+        else:
+            self.union = None
+            self.name = name
+            self.path = name
+
+    def msgtype_key(self, msg):
+        if self.union:
+            return "%s_%s_%s_MSGTYPE" % (msg, self.union, self.name)
+        return "%s_%s_MSGTYPE" % (msg, self.name)
+
+
+def read_logical_lines(path):
+    """Yield preprocessor-style lines with backslash continuations joined."""
+    with open(path) as f:
+        pending = ""
+        for line in f:
+            line = line.rstrip("\n")
+            if line.endswith("\\"):
+                pending += line[:-1] + " "
+                continue
+            yield pending + line
+            pending = ""
+        if pending:
+            yield pending
+
+
+def scan_headers(proto_dir):
+    messages = {}  # name -> [Field]
+    headers = {}   # name -> header path relative to proto_dir
+    defines = {}
+
+    for root, _, files in os.walk(proto_dir):
+        for fname in sorted(files):
+            if not fname.endswith(".pb.h"):
+                continue
+            path = os.path.join(root, fname)
+            rel = os.path.relpath(path, proto_dir)
+            for line in read_logical_lines(path):
+                m = re.match(r"\s*#define\s+(\w+)_FIELDLIST\(X, a\)", line)
+                if m:
+                    messages[m.group(1)] = [
+                        Field(*g) for g in FIELD_RE.findall(line)]
+                    headers[m.group(1)] = rel
+                    continue
+                m = DEFINE_RE.match(line.strip())
+                if m:
+                    defines[m.group(1)] = m.group(2).strip()
+
+    return messages, headers, defines
+
+
+class Generator:
+    def __init__(self, proto_dir, roots):
+        self.messages, self.headers, self.defines = scan_headers(proto_dir)
+        self.roots = roots
+        self.order = []
+        for root in roots:
+            self.collect(root)
+
+    def fail(self, msg):
+        sys.exit("gen_fastdec: " + msg)
+
+    def collect(self, msg):
+        if msg in self.order:
+            return
+        if msg not in self.messages:
+            self.fail("no FIELDLIST for %s" % msg)
+        if self.defines.get(msg + "_DEFAULT", "NULL") != "NULL":
+            self.fail("%s has non-zero defaults (not supported)" % msg)
+        self.order.append(msg)
+        for f in self.messages[msg]:
+            if f.atype == "STATIC" and f.ltype == "MESSAGE":
+                self.collect(self.submsg_type(msg, f))
+
+    def submsg_type(self, msg, f):
+        key = f.msgtype_key(msg)
+        if key not in self.defines:
+            self.fail("no %s" % key)
+        return self.defines[key]
+
+    # ── Emission helpers ───────────────────────────────────────
+
+    def fn_name(self, msg):
+        return "pbfast_msg_" + msg
+
+    def fn_call(self, msg, target):
+        if msg in self.roots:
+            return "%s(c, sub_end, %s, PBFAST_ALL_FIELDS)" % (
+                self.fn_name(msg), target)
+        return "%s(c, sub_end, %s)" % (self.fn_name(msg), target)
+
+    def fn_proto(self, msg):
+        params = ["pbfast_cursor_t *c", "const pb_byte_t *end", msg + " *msg"]
+        if msg in self.roots:
+            params.append("uint32_t fields")
+        return "static bool\n" + params_list(self.fn_name(msg), params)
+
+    def field_case(self, msg, f):
+        """Lines for one field: [(case key, [statements])]."""
+        ref = "msg->" + f.path
+        tag = f.tag
+
+        if f.atype == "CALLBACK":
+            cb = self.defines.get(msg + "_CALLBACK", "NULL")
+            if cb == "NULL":
+                return [("default-skip", tag)]
+            body = []
+            if cb == "pb_default_field_callback":
+                # No decode function set: nanopb skips the field
+                body.append("if (%s.funcs.decode == NULL)" % ref)
+                body.append("  {")
+                body.append("    if (!pbfast_skip(c, end, key))")
+                body.append("      return false;")
+                body.append("    break;")
+                body.append("  }")
+            body.append("if (!pbfast_callback(c, end, key, &%s_msg, msg))" % msg)
+            body.append("  return false;")
+            body.append("break;")
+            return [("any-wire", tag, body)]
+
+        if f.atype != "STATIC":
+            self.fail("%s.%s: %s fields not supported" % (msg, f.name, f.atype))
+        if f.htype == "REPEATED":
+            self.fail("%s.%s: static repeated fields not supported" % (msg, f.name))
+
+        body = []
+        if f.htype == "OPTIONAL":
+            body.append("msg->has_%s = true;" % f.name)
+
+        if f.ltype == "MESSAGE":
+            sub = self.submsg_type(msg, f)
+            if f.htype == "ONEOF":
+                body.append("if (msg->which_%s != %d)" % (f.union, tag))
+                body.append("  memset(&%s, 0, sizeof(%s));" % (ref, ref))
+                body.append("msg->which_%s = %d;" % (f.union, tag))
+            elif f.htype not in("OPTIONAL", "SINGULAR", "REQUIRED"):
+                self.fail("%s.%s: %s not supported" % (msg, f.name, f.htype))
+            body.append("if (!pbfast_length(c, end, &sub_end)")
+            body.append("    || !%s)" % self.fn_call(sub, "&" + ref))
+            body.append("  return false;")
+            body.append("break;")
+            return [("PB_WT_STRING", tag, body)]
+
+        if f.htype not in("OPTIONAL", "SINGULAR", "REQUIRED"):
+            self.fail("%s.%s: %s scalars not supported" % (msg, f.name, f.htype))
+        if f.ltype not in SCALARS:
+            self.fail("%s.%s: ltype %s not supported" % (msg, f.name, f.ltype))
+
+        wire, helper, ctype = SCALARS[f.ltype]
+        if f.ltype in ENUM_LTYPES:
+            # Enums are stored through a 32-bit view, like nanopb's data_size
+            body.append("if (!%s(c, end, (%s *)&%s))" % (helper, ctype, ref))
+        else:
+            body.append("if (!%s(c, end, &%s))" % (helper, ref))
+        body.append("  return false;")
+        body.append("break;")
+        return [(wire, tag, body)]
+
+    def emit_message(self, out, msg):
+        fields = self.messages[msg]
+        cases = []
+        known = []
+        needs_sub = False
+        for f in fields:
+            for entry in self.field_case(msg, f):
+                if entry[0] == "default-skip":
+                    continue
+                known.append(f.tag)
+                cases.append((f, entry))
+                if f.ltype == "MESSAGE" and f.atype == "STATIC":
+                    needs_sub = True
+
+        out.append(self.fn_proto(msg))
+        out.append("{")
+        if needs_sub:
+            out.append("  const pb_byte_t *sub_end;")
+            out.append("")
+        out.append("  while (c->pos < end)")
+        out.append("    {")
+        out.append("      uint32_t key;")
+        out.append("      if (!pbfast_key(c, end, &key))")
+        out.append("        return false;")
+        if msg in self.roots:
+            out.append("      if ((key >> 3) < 32 && !(fields & (1u << (key >> 3))))")
+            out.append("        {")
+            out.append("          if (!pbfast_skip(c, end, key))")
+            out.append("            return false;")
+            out.append("          continue;")
+            out.append("        }")
+        out.append("")
+        out.append("      switch (key)")
+        out.append("        {")
+
+        any_wire = []
+        for f, entry in cases:
+            if entry[0] == "any-wire":
+                any_wire.append((f, entry))
+                continue
+            wire, tag, body = entry
+            out.append("        case PBFAST_KEY(%d, %s): /* %s */" % (tag, wire, f.name))
+            for line in body:
+                out.append("          " + line)
+
+        out.append("        default:")
+        if any_wire:
+            # Callback fields take any wire type; dispatch on the tag
+            out.append("          switch (key >> 3)")
+            out.append("            {")
+            for f, (_, tag, body) in any_wire:
+                out.append("            case %d: /* %s */" % (tag, f.name))
+                for line in body:
+                    out.append("              " + line)
+            out.append("            default:")
+            indent = "              "
+        else:
+            indent = "          "
+
+        static_tags = sorted(set(t for f, e in cases if e[0] != "any-wire"
+                                 for t in [f.tag]))
+        if static_tags:
+            out.append(indent + "if (pbfast_known_%s(key >> 3))" % msg)
+            out.append(indent + "  return pbfast_fail(c, \"wrong wire type\");")
+        out.append(indent + "if (!pbfast_skip(c, end, key))")
+        out.append(indent + "  return false;")
+        out.append(indent + "break;")
+        if any_wire:
+            out.append("            }")
+            out.append("          break;")
+        out.append("        }")
+        out.append("    }")
+        out.append("")
+        out.append("  return true;")
+        out.append("}")
+        out.append("")
+
+    def emit_known(self, out, msg):
+        tags = sorted(set(f.tag for f in self.messages[msg]
+                          if f.atype == "STATIC"))
+        if not tags:
+            return
+        out.append("static inline bool")
+        out.append("pbfast_known_%s(uint32_t tag)" % msg)
+        out.append("{")
+        out.append("  switch (tag)")
+        out.append("    {")
+        for t in tags:
+            out.append("    case %d:" % t)
+        out.append("      return true;")
+        out.append("    default:")
+        out.append("      return false;")
+        out.append("    }")
+        out.append("}")
+        out.append("")
+
+    def emit_enum_asserts(self, out):
+        for msg in self.order:
+            for f in self.messages[msg]:
+                if f.atype == "STATIC" and f.ltype in ENUM_LTYPES:
+                    out.append("_Static_assert(sizeof(((%s *)0)->%s) == 4," % (msg, f.path))
+                    out.append("                \"%s.%s: 32-bit enum expected\");" % (msg, f.path))
+        out.append("")
+
+    def header_includes(self):
+        seen = []
+        for msg in self.order:
+            h = self.headers[msg]
+            if h not in seen:
+                seen.append(h)
+        return sorted(seen)
+
+    def write(self, basename, argv):
+        guard = "PB_FASTDEC_H_INCLUDED"
+        # Record only the roots: paths differ between checkouts
+        cmd = "Roots: " + " ".join(argv[2:])
+        h = []
+        h.append("/* Automatically generated by tools/gen_fastdec.py - do not edit */")
+        h.append("/* %s */" % cmd)
+        h.append("")
+        h.append("#ifndef %s" % guard)
+        h.append("#define %s" % guard)
+        h.append("")
+        h.append("#include <pb.h>")
+        h.append("#include <pb_decode.h>")
+        h.append("")
+        for inc in self.header_includes():
+            h.append("#include \"%s\"" % inc)
+        h.append("")
+        h.append("#ifdef __cplusplus")
+        h.append("extern \"C\"")
+        h.append("{")
+        h.append("#endif")
+        h.append("")
+        h.append("/* Decode every field (see the `fields` argument below) */")
+        h.append("#define PBFAST_ALL_FIELDS 0xffffffffu")
+        h.append("")
+        h.append("/* Decoders behave like pb_decode_ex(stream, fields, msg,")
+        h.append(" * PB_DECODE_NOINIT): msg must be initialized by the caller and")
+        h.append(" * callbacks set in it are invoked as nanopb would. The stream")
+        h.append(" * must be a buffer stream (pb_istream_from_buffer() or a")
+        h.append(" * callback substream of one).")
+        h.append(" *")
+        h.append(" * fields: bit n set = decode tag n; tags outside the mask are")
+        h.append(" * skipped unparsed. Tags >= 32 are always decoded. */")
+        for msg in self.roots:
+            h.append(params_list("bool pbfast_decode_" + msg, [
+                "pb_istream_t *stream", msg + " *msg", "uint32_t fields"]) + ";")
+        h.append("")
+        h.append("#ifdef __cplusplus")
+        h.append("} /* extern \"C\" */")
+        h.append("#endif")
+        h.append("")
+        h.append("#endif")
+
+        c = []
+        c.append("/* Automatically generated by tools/gen_fastdec.py - do not edit */")
+        c.append("/* %s */" % cmd)
+        c.append("")
+        c.append("#include \"%s.h\"" % os.path.basename(basename))
+        c.append("")
+        c.append("#include <pb_common.h>")
+        c.append("#include <string.h>")
+        c.append("")
+        c.append(RUNTIME)
+        self.emit_enum_asserts(c)
+        for msg in self.order:
+            c.append(self.fn_proto(msg) + ";")
+        c.append("")
+        for msg in self.order:
+            self.emit_known(c, msg)
+        for msg in self.order:
+            self.emit_message(c, msg)
+        for msg in self.roots:
+            c.append("bool")
+            c.append(params_list("pbfast_decode_" + msg, [
+                "pb_istream_t *stream", msg + " *msg", "uint32_t fields"]))
+            c.append("{")
+            c.append("  pbfast_cursor_t c;")
+            c.append("  const pb_byte_t *end;")
+            c.append("")
+            c.append("  if (!pbfast_begin(stream, &c, &end))")
+            c.append("    return false;")
+            c.append("  return pbfast_end(stream, &c, end,")
+            c.append("                    %s(&c, end, msg, fields));" % self.fn_name(msg))
+            c.append("}")
+            c.append("")
+
+        with open(basename + ".h", "w") as f:
+            f.write("\n".join(h) + "\n")
+        with open(basename + ".c", "w") as f:
+            f.write("\n".join(c).rstrip("\n") + "\n")
+
+
+# Shared helpers, mirroring pb_decode.c semantics for buffer streams
+RUNTIME = r'''/* Read position within a buffer stream */
+typedef struct
+{
+  const pb_byte_t *pos;
+  const char *errmsg;
+} pbfast_cursor_t;
+
+#define PBFAST_KEY(tag, wire) (((uint32_t)(tag) << 3) | (uint32_t)(wire))
+
+static bool
+pbfast_fail(pbfast_cursor_t *c, const char *errmsg)
+{
+  c->errmsg = errmsg;
+  return false;
+}
+
+/* pb_decode_varint32(): up to 10 bytes, upper bits only as sign extension */
+static bool
+pbfast_varint32_slow(pbfast_cursor_t *c,
+                      const pb_byte_t *end,
+                      uint32_t *dest)
+{
+  const pb_byte_t *p  = c->pos;
+  uint_fast8_t bitpos = 7;
+  uint32_t result     = *p++ & 0x7F;
+  pb_byte_t byte;
+
+  do
+    {
+      if (p >= end)
+        return pbfast_fail(c, "end-of-stream");
+      byte = *p++;
+
+      if (bitpos >= 32)
+        {
+          pb_byte_t sign_extension = (bitpos < 63) ? 0xFF : 0x01;
+          bool valid_extension
+            = ((byte & 0x7F) == 0x00
+               || ((result >> 31) != 0 && byte == sign_extension));
+
+          if (bitpos >= 64 || !valid_extension)
+            return pbfast_fail(c, "varint overflow");
+        }
+      else if (bitpos == 28)
+        {
+          if ((byte & 0x70) != 0 && (byte & 0x78) != 0x78)
+            return pbfast_fail(c, "varint overflow");
+          result |= (uint32_t)(byte & 0x0F) << bitpos;
+        }
+      else
+        {
+          result |= (uint32_t)(byte & 0x7F) << bitpos;
+        }
+      bitpos = (uint_fast8_t)(bitpos + 7);
+    }
+  while (byte & 0x80);
+
+  c->pos = p;
+  *dest  = result;
+  return true;
+}
+
+static inline bool
+pbfast_varint32(pbfast_cursor_t *c, const pb_byte_t *end, uint32_t *dest)
+{
+  if (c->pos >= end)
+    return pbfast_fail(c, "end-of-stream");
+  if (*c->pos < 0x80)
+    {
+      *dest = *c->pos++;
+      return true;
+    }
+  return pbfast_varint32_slow(c, end, dest);
+}
+
+/* pb_decode_varint(): up to 10 bytes, at most 64 significant bits */
+static inline bool
+pbfast_varint64(pbfast_cursor_t *c, const pb_byte_t *end, uint64_t *dest)
+{
+  const pb_byte_t *p  = c->pos;
+  uint_fast8_t bitpos = 0;
+  uint64_t result     = 0;
+  pb_byte_t byte;
+
+  do
+    {
+      if (p >= end)
+        return pbfast_fail(c, "end-of-stream");
+      byte = *p++;
+
+      if (bitpos >= 63 && (byte & 0xFE) != 0)
+        return pbfast_fail(c, "varint overflow");
+
+      result |= (uint64_t)(byte & 0x7F) << bitpos;
+      bitpos = (uint_fast8_t)(bitpos + 7);
+    }
+  while (byte & 0x80);
+
+  c->pos = p;
+  *dest  = result;
+  return true;
+}
+
+static inline bool
+pbfast_key(pbfast_cursor_t *c, const pb_byte_t *end, uint32_t *key)
+{
+  if (!pbfast_varint32(c, end, key))
+    return false;
+  if ((*key >> 3) == 0)
+    return pbfast_fail(c, "zero tag");
+  return true;
+}
+
+/* Length prefix of a length-delimited field; *sub_end is where it ends */
+static inline bool
+pbfast_length(pbfast_cursor_t *c,
+               const pb_byte_t *end,
+               const pb_byte_t **sub_end)
+{
+  uint32_t size;
+  if (!pbfast_varint32(c, end, &size))
+    return false;
+  if ((size_t)(end - c->pos) < size)
+    return pbfast_fail(c, "parent stream too short");
+  *sub_end = c->pos + size;
+  return true;
+}
+
+/* pb_skip_field() */
+static bool
+pbfast_skip(pbfast_cursor_t *c, const pb_byte_t *end, uint32_t key)
+{
+  const pb_byte_t *sub_end;
+
+  switch (key & 7)
+    {
+    case PB_WT_VARINT:
+      do
+        {
+          if (c->pos >= end)
+            return pbfast_fail(c, "end-of-stream");
+        }
+      while (*c->pos++ & 0x80);
+      return true;
+    case PB_WT_64BIT:
+      if (end - c->pos < 8)
+        return pbfast_fail(c, "end-of-stream");
+      c->pos += 8;
+      return true;
+    case PB_WT_STRING:
+      if (!pbfast_length(c, end, &sub_end))
+        return false;
+      c->pos = sub_end;
+      return true;
+    case PB_WT_32BIT:
+      if (end - c->pos < 4)
+        return pbfast_fail(c, "end-of-stream");
+      c->pos += 4;
+      return true;
+    default:
+      return pbfast_fail(c, "invalid wire_type");
+    }
+}
+
+static inline bool
+pbfast_bool(pbfast_cursor_t *c, const pb_byte_t *end, bool *dest)
+{
+  uint32_t value;
+  if (!pbfast_varint32(c, end, &value))
+    return false;
+  *dest = (value != 0);
+  return true;
+}
+
+static inline bool
+pbfast_uint64(pbfast_cursor_t *c, const pb_byte_t *end, uint64_t *dest)
+{
+  return pbfast_varint64(c, end, dest);
+}
+
+static inline bool
+pbfast_int64(pbfast_cursor_t *c, const pb_byte_t *end, int64_t *dest)
+{
+  uint64_t value;
+  if (!pbfast_varint64(c, end, &value))
+    return false;
+  *dest = (int64_t)value;
+  return true;
+}
+
+static inline bool
+pbfast_uint32(pbfast_cursor_t *c, const pb_byte_t *end, uint32_t *dest)
+{
+  uint64_t value;
+  if (!pbfast_varint64(c, end, &value))
+    return false;
+  if (value > UINT32_MAX)
+    return pbfast_fail(c, "integer too large");
+  *dest = (uint32_t)value;
+  return true;
+}
+
+/* Negative int32 values may be encoded in 5 or 10 bytes(nanopb issue 97) */
+static inline bool
+pbfast_int32(pbfast_cursor_t *c, const pb_byte_t *end, int32_t *dest)
+{
+  uint64_t value;
+  if (!pbfast_varint64(c, end, &value))
+    return false;
+  *dest = (int32_t)value;
+  return true;
+}
+
+static inline bool
+pbfast_sint64(pbfast_cursor_t *c, const pb_byte_t *end, int64_t *dest)
+{
+  uint64_t value;
+  if (!pbfast_varint64(c, end, &value))
+    return false;
+  *dest = (value & 1) ? (int64_t)(~(value >> 1)) : (int64_t)(value >> 1);
+  return true;
+}
+
+static inline bool
+pbfast_sint32(pbfast_cursor_t *c, const pb_byte_t *end, int32_t *dest)
+{
+  int64_t value;
+  if (!pbfast_sint64(c, end, &value))
+    return false;
+  if (value < INT32_MIN || value > INT32_MAX)
+    return pbfast_fail(c, "integer too large");
+  *dest = (int32_t)value;
+  return true;
+}
+
+static inline bool
+pbfast_fixed32(pbfast_cursor_t *c, const pb_byte_t *end, void *dest)
+{
+  if (end - c->pos < 4)
+    return pbfast_fail(c, "end-of-stream");
+#if defined(PB_LITTLE_ENDIAN_8BIT) && PB_LITTLE_ENDIAN_8BIT == 1
+  memcpy(dest, c->pos, 4);
+#else
+  uint32_t v = (uint32_t)c->pos[0] | ((uint32_t)c->pos[1] << 8)
+               | ((uint32_t)c->pos[2] << 16) | ((uint32_t)c->pos[3] << 24);
+  memcpy(dest, &v, 4);
+#endif
+  c->pos += 4;
+  return true;
+}
+
+static inline bool
+pbfast_fixed64(pbfast_cursor_t *c, const pb_byte_t *end, void *dest)
+{
+  if (end - c->pos < 8)
+    return pbfast_fail(c, "end-of-stream");
+#if defined(PB_LITTLE_ENDIAN_8BIT) && PB_LITTLE_ENDIAN_8BIT == 1
+  memcpy(dest, c->pos, 8);
+#else
+  uint64_t v = 0;
+  for (int i = 7; i >= 0; i--)
+    v = (v << 8) | c->pos[i];
+  memcpy(dest, &v, 8);
+#endif
+  c->pos += 8;
+  return true;
+}
+
+/* decode_callback_field(): hand the field to the message's field callback
+ * (pb_default_field_callback calls the pb_callback_t stored in msg) */
+static bool
+pbfast_callback(pbfast_cursor_t *c,
+                 const pb_byte_t *end,
+                 uint32_t key,
+                 const pb_msgdesc_t *desc,
+                 void *msg)
+{
+  pb_field_iter_t iter;
+  pb_istream_t sub;
+
+  if (!pb_field_iter_begin(&iter, desc, msg)
+      || !pb_field_iter_find(&iter, key >> 3))
+    return pbfast_fail(c, "invalid field descriptor");
+
+  if ((key & 7) == PB_WT_STRING)
+    {
+      const pb_byte_t *sub_end;
+      size_t prev_bytes_left;
+
+      if (!pbfast_length(c, end, &sub_end))
+        return false;
+
+      sub = pb_istream_from_buffer(c->pos, (size_t)(sub_end - c->pos));
+      do
+        {
+          prev_bytes_left = sub.bytes_left;
+          if (!desc->field_callback(&sub, NULL, &iter))
+            {
+#ifndef PB_NO_ERRMSG
+              if (sub.errmsg)
+                return pbfast_fail(c, sub.errmsg);
+#endif
+              return pbfast_fail(c, "callback failed");
+            }
+        }
+      while (sub.bytes_left > 0 && sub.bytes_left < prev_bytes_left);
+
+      c->pos = sub_end;
+      return true;
+    }
+
+  /* Scalars are passed as a substream of their raw bytes */
+  const pb_byte_t *start = c->pos;
+  switch (key & 7)
+    {
+    case PB_WT_VARINT:
+      do
+        {
+          if (c->pos - start >= 10)
+            return pbfast_fail(c, "varint overflow");
+          if (c->pos >= end)
+            return pbfast_fail(c, "end-of-stream");
+        }
+      while (*c->pos++ & 0x80);
+      break;
+    case PB_WT_64BIT:
+    case PB_WT_32BIT:
+      {
+        size_t size = ((key & 7) == PB_WT_64BIT) ? 8 : 4;
+        if ((size_t)(end - c->pos) < size)
+          return pbfast_fail(c, "end-of-stream");
+        c->pos += size;
+        break;
+      }
+    default:
+      return pbfast_fail(c, "invalid wire_type");
+    }
+
+  sub = pb_istream_from_buffer(start, (size_t)(c->pos - start));
+  return desc->field_callback(&sub, NULL, &iter);
+}
+
+static bool
+pbfast_begin(pb_istream_t *stream,
+              pbfast_cursor_t *c,
+              const pb_byte_t **end)
+{
+#ifndef PB_BUFFER_ONLY
+  pb_istream_t probe = pb_istream_from_buffer(NULL, 0);
+  if (stream->callback != probe.callback)
+    PB_RETURN_ERROR(stream, "not a buffer stream");
+#endif
+  c->pos    = (const pb_byte_t *)stream->state;
+  c->errmsg = NULL;
+  *end      = c->pos + stream->bytes_left;
+  return true;
+}
+
+static bool
+pbfast_end(pb_istream_t *stream,
+            const pbfast_cursor_t *c,
+            const pb_byte_t *end,
+            bool status)
+{
+  stream->state      = (void *)(uintptr_t)c->pos;
+  stream->bytes_left = (size_t)(end - c->pos);
+  if (!status)
+    PB_RETURN_ERROR(stream, c->errmsg ? c->errmsg : "callback failed");
+  return true;
+}
+'''
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.exit(__doc__)
+    proto_dir, basename, roots = argv[0], argv[1], argv[2:]
+    Generator(proto_dir, roots).write(basename, argv)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -188,6 +188,16 @@ check_prerequisites() {
         error "Signing keys not found in $KEYS_DIR"
     fi
 
+    # Check pre-decoded nav ball skins (built by 'make skins')
+    if ! ls "$BUILD_DIR/resources/navball_skins"/*.nbskin &> /dev/null; then
+        error "Pre-decoded navball skins not found in $BUILD_DIR/resources/navball_skins (run 'make skins' first)"
+    fi
+
+    # Check precomputed ephemeris table (built by 'make ephemeris')
+    if [[ ! -f "$BUILD_DIR/resources/ephemeris.bin" ]]; then
+        error "Ephemeris table not found: $BUILD_DIR/resources/ephemeris.bin (run 'make ephemeris' first)"
+    fi
+
     # Check required commands
     for cmd in openssl tar gzip jq; do
         if ! command -v $cmd &> /dev/null; then
@@ -291,14 +301,27 @@ collect_resources() {
         fi
     done
 
-    # Copy all navball skins (schema lists all options)
+    # Copy all pre-decoded navball skins (schema lists all options)
     log "  Copying all navball skins..."
-    for skin in "$RESOURCES_DIR/navball_skins"/*.png; do
+    for skin in "$BUILD_DIR/resources/navball_skins"/*.nbskin; do
         if [ -f "$skin" ]; then
             cp "$skin" "$staging_dir/resources/navball_skins/"
         fi
     done
 
+    # Dev builds can also decode the source PNGs (NAVBALL_PNG_FALLBACK)
+    if [[ "$BUILD_MODE" == "dev" ]]; then
+        for skin in "$RESOURCES_DIR/navball_skins"/*.png; do
+            if [ -f "$skin" ]; then
+                cp "$skin" "$staging_dir/resources/navball_skins/"
+            fi
+        done
+    fi
+
+    # Copy precomputed sun/moon ephemeris table
+    log "  Copying ephemeris table..."
+    cp "$BUILD_DIR/resources/ephemeris.bin" "$staging_dir/resources/"
+
     # Copy all navball indicators (center + celestial)
     log "  Copying all navball indicators..."
     for svg in "$RESOURCES_DIR/navball_indicators"/*.svg; do
@@ -404,6 +427,7 @@ generate_manifest_json() {
             resources/fonts/*) type="font" ;;
             resources/navball_skins/*) type="texture" ;;
             resources/navball_indicators/*) type="svg" ;;
+            resources/ephemeris.bin) type="ephemeris" ;;
             resources/schemas/*|*.schema.json) type="schema" ;;
             *) type="other" ;;
         esac
@@ -0,0 +1,99 @@
+// Nav Ball Skin Packer
+// Converts a skin PNG into the raw RGBA blob loaded by the WASM module
+// (format: src/resources/skin_blob.h)
+//
+// Usage: skin_pack <input.png> <output.nbskin>
+//
+// Built natively by `make skins`; package.sh ships the resulting blobs so
+// production modules never decode PNG at startup.
+
+#include "skin_blob.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+static void
+put_u16(uint8_t *dst, uint16_t value)
+{
+  dst[0] = (uint8_t)(value & 0xFF);
+  dst[1] = (uint8_t)(value >> 8);
+}
+
+static void
+put_u32(uint8_t *dst, uint32_t value)
+{
+  dst[0] = (uint8_t)(value & 0xFF);
+  dst[1] = (uint8_t)((value >> 8) & 0xFF);
+  dst[2] = (uint8_t)((value >> 16) & 0xFF);
+  dst[3] = (uint8_t)(value >> 24);
+}
+
+int
+main(int argc, char *argv[])
+{
+  if (argc != 3)
+    {
+      fprintf(stderr, "usage: %s <input.png> <output%s>\n", argv[0],
+              SKIN_BLOB_EXTENSION);
+      return 1;
+    }
+
+  int width, height, channels;
+  uint8_t *pixels = stbi_load(argv[1], &width, &height, &channels, 4);
+  if (!pixels)
+    {
+      fprintf(stderr, "error: failed to decode %s (%s)\n", argv[1],
+              stbi_failure_reason());
+      return 1;
+    }
+
+  if (width > SKIN_BLOB_MAX_DIMENSION || height > SKIN_BLOB_MAX_DIMENSION)
+    {
+      fprintf(stderr, "error: %s is %dx%d (max %d)\n", argv[1], width, height,
+              SKIN_BLOB_MAX_DIMENSION);
+      stbi_image_free(pixels);
+      return 1;
+    }
+
+  uint8_t header[SKIN_BLOB_HEADER_SIZE] = { 0 };
+  memcpy(header, SKIN_BLOB_MAGIC, 4);
+  put_u16(header + 4, SKIN_BLOB_VERSION);
+  put_u16(header + 6, SKIN_BLOB_HEADER_SIZE);
+  put_u32(header + 8, (uint32_t)width);
+  put_u32(header + 12, (uint32_t)height);
+
+  FILE *out = fopen(argv[2], "wb");
+  if (!out)
+    {
+      fprintf(stderr, "error: failed to create %s\n", argv[2]);
+      stbi_image_free(pixels);
+      return 1;
+    }
+
+  size_t pixel_bytes = (size_t)width * (size_t)height * 4;
+  bool ok            = true;
+
+  if (fwrite(header, 1, sizeof(header), out) != sizeof(header))
+    ok = false;
+  if (ok && fwrite(pixels, 1, pixel_bytes, out) != pixel_bytes)
+    ok = false;
+  if (fclose(out) != 0)
+    ok = false;
+  stbi_image_free(pixels);
+
+  if (!ok)
+    {
+      fprintf(stderr, "error: failed to write %s\n", argv[2]);
+      remove(argv[2]);
+      return 1;
+    }
+
+  printf("%s → %s (%dx%d, %zu bytes)\n", argv[1], argv[2], width, height,
+         sizeof(header) + pixel_bytes);
+  return 0;
+}